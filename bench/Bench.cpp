@@ -0,0 +1,279 @@
+/*******************************************************************************
+ * Bench.cpp - Microbenchmark Runner
+ *
+ * Command line:
+ *   --filter=TEXT     Only run benchmarks whose name contains TEXT
+ *   --min-time=SEC    Minimum measured time per run (default 0.2)
+ *   --json=PATH       Write results as JSON (default: no file)
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "Bench.h"
+#include <chrono>
+#include <ctime>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace bench {
+
+namespace {
+
+int64_t nowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Registered benchmark
+struct Entry {
+    std::string name;
+    BenchFunction function;
+    std::vector<int> arguments;
+};
+
+// One measured result
+struct Result {
+    std::string name;
+    int argument;
+    uint64_t iterations;
+    double nsPerIteration;
+    double itemsPerSecond;
+    double bytesPerSecond;
+    std::string label;
+};
+
+// Function-local static avoids static initialisation order issues
+std::vector<Entry>& registry() {
+    static std::vector<Entry> entries;
+    return entries;
+}
+
+// Escape a string for JSON output
+std::string jsonEscape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+// RUN ONE: Grow the iteration count until the run is long enough
+// Step 1: Start with a single iteration
+// Step 2: Run, and stop once the measured time reaches minNanos
+// Step 3: Otherwise scale iterations towards the target and repeat
+Result runOne(const Entry& entry, int argument, int64_t minNanos) {
+    // Step 1: Single iteration
+    uint64_t iterations = 1;
+
+    while (true) {
+        // Step 2: Run
+        State state(argument, iterations);
+        entry.function(state);
+
+        int64_t elapsed = state.getElapsedNanos();
+        const uint64_t maxIterations = 1000000000ULL;
+
+        if (elapsed >= minNanos || iterations >= maxIterations) {
+            Result result;
+            result.name = entry.name;
+            result.argument = argument;
+            result.iterations = iterations;
+            result.nsPerIteration = static_cast<double>(elapsed) / static_cast<double>(iterations);
+
+            double seconds = static_cast<double>(elapsed) / 1e9;
+            result.itemsPerSecond = seconds > 0.0
+                ? static_cast<double>(state.getItemsProcessed()) / seconds : 0.0;
+            result.bytesPerSecond = seconds > 0.0
+                ? static_cast<double>(state.getBytesProcessed()) / seconds : 0.0;
+            result.label = state.getLabel();
+            return result;
+        }
+
+        // Step 3: Scale up (at most 10x per round, at least 2x)
+        double scale = elapsed > 0
+            ? 1.4 * static_cast<double>(minNanos) / static_cast<double>(elapsed) : 10.0;
+        if (scale > 10.0) scale = 10.0;
+        if (scale < 2.0) scale = 2.0;
+        iterations = static_cast<uint64_t>(static_cast<double>(iterations) * scale);
+        if (iterations > maxIterations) iterations = maxIterations;
+    }
+}
+
+// Write all results as a JSON document
+bool writeJson(const std::string& path, const std::vector<Result>& results, double minTime) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "[Bench] Failed to open JSON output: " << path << std::endl;
+        return false;
+    }
+
+    file << "{\n";
+    file << "  \"context\": {\"timestamp\": " << static_cast<long long>(std::time(nullptr))
+         << ", \"min_time\": " << minTime << "},\n";
+    file << "  \"benchmarks\": [\n";
+
+    file << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        file << "    {\"name\": \"" << jsonEscape(r.name) << "/" << r.argument << "\""
+             << ", \"family\": \"" << jsonEscape(r.name) << "\""
+             << ", \"arg\": " << r.argument
+             << ", \"iterations\": " << r.iterations
+             << ", \"ns_per_iter\": " << r.nsPerIteration
+             << ", \"items_per_second\": " << r.itemsPerSecond
+             << ", \"bytes_per_second\": " << r.bytesPerSecond;
+        if (!r.label.empty()) {
+            file << ", \"label\": \"" << jsonEscape(r.label) << "\"";
+        }
+        file << "}";
+        if (i + 1 < results.size()) file << ",";
+        file << "\n";
+    }
+
+    file << "  ]\n}\n";
+    return true;
+}
+
+} // namespace
+
+/*******************************************************************************
+ * STATE IMPLEMENTATION
+ ******************************************************************************/
+
+State::State(int argument, uint64_t iterations)
+    : argument(argument), maxIterations(iterations), remaining(iterations),
+      started(false), startNanos(0), elapsedNanos(0), paused(false),
+      itemsProcessed(0), bytesProcessed(0) {
+}
+
+bool State::keepRunning() {
+    if (!started) {
+        started = true;
+        startNanos = nowNanos();
+    }
+
+    if (remaining > 0) {
+        remaining--;
+        return true;
+    }
+
+    // Loop finished: close the last timed span
+    if (!paused) {
+        elapsedNanos += nowNanos() - startNanos;
+        paused = true;
+    }
+    return false;
+}
+
+void State::pauseTiming() {
+    if (!paused) {
+        elapsedNanos += nowNanos() - startNanos;
+        paused = true;
+    }
+}
+
+void State::resumeTiming() {
+    if (paused) {
+        startNanos = nowNanos();
+        paused = false;
+    }
+}
+
+/*******************************************************************************
+ * REGISTRATION AND RUNNER
+ ******************************************************************************/
+
+bool registerBenchmark(const char* name, BenchFunction function,
+                       std::initializer_list<int> arguments) {
+    Entry entry;
+    entry.name = name;
+    entry.function = function;
+    entry.arguments.assign(arguments.begin(), arguments.end());
+    if (entry.arguments.empty()) {
+        entry.arguments.push_back(0);
+    }
+    registry().push_back(entry);
+    return true;
+}
+
+#if !defined(__GNUC__) && !defined(__clang__)
+void escape(const void* pointer) {
+    static const void* volatile sink;
+    sink = pointer;
+}
+#endif
+
+// RUN ALL: Parse options, run each benchmark at each size, report
+int runAll(int argc, char** argv) {
+    std::string filter;
+    std::string jsonPath;
+    double minTime = 0.2;
+
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option.rfind("--filter=", 0) == 0) {
+            filter = option.substr(9);
+        } else if (option.rfind("--min-time=", 0) == 0) {
+            minTime = std::atof(option.c_str() + 11);
+        } else if (option.rfind("--json=", 0) == 0) {
+            jsonPath = option.substr(7);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--filter=TEXT] [--min-time=SEC] [--json=PATH]" << std::endl;
+            return 1;
+        }
+    }
+
+    int64_t minNanos = static_cast<int64_t>(minTime * 1e9);
+    std::vector<Result> results;
+
+    // Results go to the real stdout; game logging goes to the null buffer
+    NullBuffer nullBuffer;
+    std::ostream report(std::cout.rdbuf());
+    std::streambuf* original = std::cout.rdbuf(&nullBuffer);
+
+    report << std::left << std::setw(40) << "Benchmark"
+           << std::right << std::setw(14) << "ns/iter"
+           << std::setw(14) << "Iterations"
+           << std::setw(16) << "Items/s"
+           << std::setw(12) << "MB/s" << std::endl;
+    report << std::string(96, '-') << std::endl;
+
+    for (const Entry& entry : registry()) {
+        if (!filter.empty() && entry.name.find(filter) == std::string::npos) continue;
+
+        for (int argument : entry.arguments) {
+            Result result = runOne(entry, argument, minNanos);
+            results.push_back(result);
+
+            report << std::left << std::setw(40) << (entry.name + "/" + std::to_string(argument))
+                   << std::right << std::fixed << std::setprecision(1)
+                   << std::setw(14) << result.nsPerIteration
+                   << std::setw(14) << result.iterations
+                   << std::setw(16) << std::setprecision(0) << result.itemsPerSecond
+                   << std::setw(12) << std::setprecision(1) << result.bytesPerSecond / 1e6
+                   << (result.label.empty() ? "" : "  ") << result.label
+                   << std::endl;
+        }
+    }
+
+    std::cout.rdbuf(original);
+
+    if (!jsonPath.empty()) {
+        if (!writeJson(jsonPath, results, minTime)) return 1;
+        std::cout << "[Bench] Results written: " << jsonPath
+                  << " (" << results.size() << " runs)" << std::endl;
+    }
+
+    return 0;
+}
+
+} // namespace bench
+
+int main(int argc, char** argv) {
+    return bench::runAll(argc, argv);
+}
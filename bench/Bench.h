@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Bench.h - Minimal Microbenchmark Harness
+ *
+ * A small Google-Benchmark-style runner so the containers can be measured
+ * without an external dependency:
+ *
+ *   static void BM_StackPush(bench::State& state) {
+ *       Stack<int> stack;
+ *       while (state.keepRunning()) {
+ *           stack.push(1);
+ *       }
+ *       state.setItemsProcessed(state.iterations());
+ *   }
+ *   BENCHMARK(BM_StackPush, 64, 1024, 16384);
+ *
+ * Each registered benchmark is run once per argument. The iteration count
+ * grows until a run lasts at least the minimum time, then ns/iteration
+ * (and items/second and MB/second when reported) is printed and written
+ * as JSON.
+ *
+ * std::cout is redirected to a null buffer while benchmarks run, since the
+ * game containers log every operation.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <streambuf>
+#include <initializer_list>
+
+namespace bench {
+
+/*******************************************************************************
+ * State - Passed to each benchmark function
+ ******************************************************************************/
+class State {
+private:
+    int argument;               // Size parameter for this run
+    uint64_t maxIterations;     // Iterations requested by the runner
+    uint64_t remaining;         // Iterations left in keepRunning()
+    bool started;
+
+    int64_t startNanos;         // Start of the current timed span
+    int64_t elapsedNanos;       // Accumulated timed nanoseconds
+    bool paused;
+
+    uint64_t itemsProcessed;
+    uint64_t bytesProcessed;
+    std::string label;          // Free-form note shown next to the result
+
+public:
+    State(int argument, uint64_t iterations);
+
+    // Loop condition: starts the timer on the first call, stops it on the last
+    bool keepRunning();
+
+    // Exclude setup/teardown from the measurement
+    void pauseTiming();
+    void resumeTiming();
+
+    int arg() const { return argument; }
+    uint64_t iterations() const { return maxIterations; }
+
+    void setItemsProcessed(uint64_t items) { itemsProcessed = items; }
+    void setBytesProcessed(uint64_t bytes) { bytesProcessed = bytes; }
+    void setLabel(const std::string& text) { label = text; }
+
+    int64_t getElapsedNanos() const { return elapsedNanos; }
+    uint64_t getItemsProcessed() const { return itemsProcessed; }
+    uint64_t getBytesProcessed() const { return bytesProcessed; }
+    const std::string& getLabel() const { return label; }
+};
+
+typedef void (*BenchFunction)(State&);
+
+/*******************************************************************************
+ * NullBuffer - Stream buffer that discards everything
+ *
+ * Swap into std::cout to silence game logging while measuring.
+ ******************************************************************************/
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+// Register a benchmark (used by the BENCHMARK macro)
+bool registerBenchmark(const char* name, BenchFunction function,
+                       std::initializer_list<int> arguments);
+
+// Run all registered benchmarks; returns process exit code
+int runAll(int argc, char** argv);
+
+/*******************************************************************************
+ * doNotOptimize - Keep a computed value alive so the work is not elided
+ ******************************************************************************/
+#if defined(__GNUC__) || defined(__clang__)
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+#else
+void escape(const void* pointer);
+
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    escape(&value);
+}
+#endif
+
+} // namespace bench
+
+#define BENCH_CONCAT_INNER(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_INNER(a, b)
+
+// BENCHMARK(function, sizes...) - register function for each size
+#define BENCHMARK(function, ...) \
+    static const bool BENCH_CONCAT(benchRegistered_, function) = \
+        bench::registerBenchmark(#function, function, {__VA_ARGS__})
+
+#endif // BENCH_H
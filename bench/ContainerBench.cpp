@@ -0,0 +1,575 @@
+/*******************************************************************************
+ * ContainerBench.cpp - Microbenchmarks for the Game Containers
+ *
+ * Covers every hand-written data structure at several sizes:
+ * - HashTable insert/get/remove (ItemDatabase backing store)
+ * - Stack<T> push/pop and Queue<T> enqueue/dequeue
+ * - EventLog addEvent/displayRecent
+ * - GridMap navigation and findSector
+ * - AbilityTree findAbility/canUnlock
+ * - Inventory filtered iteration
+ *
+ * Run with "make bench" (results also written to bench_results.json).
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "Bench.h"
+#include "../include/HashTable.h"
+#include "../include/Stack.h"
+#include "../include/Queue.h"
+#include "../include/LinkedList.h"
+#include "../include/Tree.h"
+#include "../include/Iterator.h"
+#include "../include/Entity.h"
+#include "../include/MemoryTracker.h"
+#include <string>
+#include <vector>
+
+namespace {
+
+// Keys "ITEM_0" .. "ITEM_n-1"
+std::vector<std::string> makeKeys(const std::string& prefix, int count) {
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (int i = 0; i < count; i++) {
+        keys.push_back(prefix + std::to_string(i));
+    }
+    return keys;
+}
+
+Item* makeItem(const std::string& code, int index) {
+    static const Item::Type types[] = {
+        Item::Type::WEAPON, Item::Type::CONSUMABLE, Item::Type::HACK_TOOL, Item::Type::KEY_ITEM
+    };
+    return new Item(code, "Bench Item", "Benchmark item", types[index % 4], index);
+}
+
+// Fill a table with count items using the given keys
+void fillTable(HashTable& table, const std::vector<std::string>& keys) {
+    for (size_t i = 0; i < keys.size(); i++) {
+        table.insert(keys[i], makeItem(keys[i], static_cast<int>(i)));
+    }
+}
+
+// Chain of sectors linked west -> east, all registered with the map
+void buildCorridor(GridMap& map, int count) {
+    SectorNode* previous = nullptr;
+    for (int i = 0; i < count; i++) {
+        SectorNode* sector = new SectorNode("Sector_" + std::to_string(i), "Bench sector", i % 10);
+        map.addSector(sector);
+        if (previous == nullptr) {
+            map.setStartSector(sector);
+            map.setCurrentSector(sector);
+        } else {
+            GridMap::connectSectors(previous, sector, "east");
+        }
+        previous = sector;
+    }
+}
+
+// Complete binary tree of count abilities: node i hangs under (i - 1) / 2
+void buildAbilityTree(AbilityTree& tree, const std::vector<std::string>& codes) {
+    tree.setRoot(Ability(codes[0], "Root", "Bench root", Ability::Type::COMBAT, 0, 1));
+    for (size_t i = 1; i < codes.size(); i++) {
+        Ability ability(codes[i], "Ability", "Bench ability",
+                        Ability::Type::SUPPORT, 1 + static_cast<int>(i % 3), 1);
+        tree.insert(ability, codes[(i - 1) / 2], (i % 2) == 1);
+    }
+}
+
+} // namespace
+
+/*******************************************************************************
+ * HASH TABLE
+ ******************************************************************************/
+
+// Insert n items into an empty table
+static void BM_HashTableInsert(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> keys = makeKeys("ITEM_", n);
+    std::vector<Item*> items(n);
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        HashTable* table = new HashTable();
+        for (int i = 0; i < n; i++) {
+            items[i] = makeItem(keys[i], i);
+        }
+        state.resumeTiming();
+
+        for (int i = 0; i < n; i++) {
+            table->insert(keys[i], items[i]);
+        }
+
+        state.pauseTiming();
+        delete table;
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_HashTableInsert, 16, 128, 1024);
+
+// Lookup (hit) in a table of n items
+static void BM_HashTableGet(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> keys = makeKeys("ITEM_", n);
+    HashTable table;
+    fillTable(table, keys);
+
+    int index = 0;
+    while (state.keepRunning()) {
+        bench::doNotOptimize(table.get(keys[index]));
+        if (++index == n) index = 0;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HashTableGet, 16, 128, 1024, 8192);
+
+// Lookup (miss) in a table of n items
+static void BM_HashTableGetMiss(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> keys = makeKeys("ITEM_", n);
+    std::vector<std::string> missing = makeKeys("NONE_", 64);
+    HashTable table;
+    fillTable(table, keys);
+
+    int index = 0;
+    while (state.keepRunning()) {
+        bench::doNotOptimize(table.get(missing[index]));
+        index = (index + 1) & 63;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HashTableGetMiss, 16, 128, 1024, 8192);
+
+// Remove all n items from a full table
+static void BM_HashTableRemove(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> keys = makeKeys("ITEM_", n);
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        HashTable* table = new HashTable();
+        fillTable(*table, keys);
+        state.resumeTiming();
+
+        for (int i = 0; i < n; i++) {
+            table->remove(keys[i]);
+        }
+
+        state.pauseTiming();
+        delete table;
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_HashTableRemove, 16, 128, 1024);
+
+/*******************************************************************************
+ * STACK AND QUEUE
+ ******************************************************************************/
+
+// Push n ints then pop them all
+static void BM_StackPushPop(bench::State& state) {
+    int n = state.arg();
+    Stack<int> stack;
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < n; i++) {
+            stack.push(i);
+        }
+        for (int i = 0; i < n; i++) {
+            bench::doNotOptimize(stack.pop());
+        }
+    }
+    state.setItemsProcessed(state.iterations() * n * 2);
+}
+BENCHMARK(BM_StackPushPop, 8, 64, 1024, 16384);
+
+// Push n hacking actions then pop them all (string payload)
+static void BM_StackPushPopAction(bench::State& state) {
+    int n = state.arg();
+    Stack<Action> stack;
+    Action action("INJECT", "Bench code injection", 10, true);
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < n; i++) {
+            stack.push(action);
+        }
+        for (int i = 0; i < n; i++) {
+            bench::doNotOptimize(stack.pop());
+        }
+    }
+    state.setItemsProcessed(state.iterations() * n * 2);
+}
+BENCHMARK(BM_StackPushPopAction, 8, 64, 1024);
+
+// Enqueue n pointers then dequeue them all
+static void BM_QueueEnqueueDequeue(bench::State& state) {
+    int n = state.arg();
+    Queue<int*> queue;
+    int value = 0;
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < n; i++) {
+            queue.enqueue(&value);
+        }
+        for (int i = 0; i < n; i++) {
+            bench::doNotOptimize(queue.dequeue());
+        }
+    }
+    state.setItemsProcessed(state.iterations() * n * 2);
+}
+BENCHMARK(BM_QueueEnqueueDequeue, 8, 64, 1024, 16384);
+
+// Steady-state rotation (combat turn order): dequeue one, enqueue it again
+static void BM_QueueRotate(bench::State& state) {
+    int n = state.arg();
+    Queue<int*> queue;
+    std::vector<int> values(n);
+    for (int i = 0; i < n; i++) {
+        queue.enqueue(&values[i]);
+    }
+
+    while (state.keepRunning()) {
+        queue.enqueue(queue.dequeue());
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_QueueRotate, 4, 16, 256);
+
+/*******************************************************************************
+ * EVENT LOG
+ ******************************************************************************/
+
+// Add n events to an empty log
+static void BM_EventLogAddEvent(bench::State& state) {
+    int n = state.arg();
+    const std::string description = "Sentinel patrol detected in Firewall Array";
+    const std::string type = "COMBAT";
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        EventLog* log = new EventLog();
+        state.resumeTiming();
+
+        for (int i = 0; i < n; i++) {
+            log->addEvent(description, type);
+        }
+
+        state.pauseTiming();
+        delete log;
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_EventLogAddEvent, 16, 256, 4096);
+
+// Display the n most recent events of a 4096-event log
+static void BM_EventLogDisplayRecent(bench::State& state) {
+    int n = state.arg();
+    EventLog log;
+    for (int i = 0; i < 4096; i++) {
+        log.addEvent("Event " + std::to_string(i), "SYSTEM");
+    }
+
+    while (state.keepRunning()) {
+        log.displayRecent(n);
+    }
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_EventLogDisplayRecent, 5, 50, 500);
+
+/*******************************************************************************
+ * GRID MAP (capacity is 50 sectors)
+ ******************************************************************************/
+
+// Walk east to the end of an n-sector corridor and back
+static void BM_GridMapNavigate(bench::State& state) {
+    int n = state.arg();
+    GridMap map;
+    buildCorridor(map, n);
+
+    while (state.keepRunning()) {
+        while (map.moveEast()) {
+        }
+        while (map.moveWest()) {
+        }
+    }
+    state.setItemsProcessed(state.iterations() * (n - 1) * 2);
+}
+BENCHMARK(BM_GridMapNavigate, 4, 16, 48);
+
+// Find each sector by name in an n-sector map
+static void BM_GridMapFindSector(bench::State& state) {
+    int n = state.arg();
+    GridMap map;
+    buildCorridor(map, n);
+    std::vector<std::string> names = makeKeys("Sector_", n);
+
+    int index = 0;
+    while (state.keepRunning()) {
+        bench::doNotOptimize(map.findSector(names[index]));
+        if (++index == n) index = 0;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GridMapFindSector, 4, 16, 48);
+
+/*******************************************************************************
+ * ABILITY TREE
+ ******************************************************************************/
+
+// Find each ability by code in an n-node tree
+static void BM_AbilityTreeFindAbility(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> codes = makeKeys("ABILITY_", n);
+    AbilityTree tree;
+    buildAbilityTree(tree, codes);
+
+    int index = 0;
+    while (state.keepRunning()) {
+        bench::doNotOptimize(tree.findAbility(codes[index]));
+        if (++index == n) index = 0;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AbilityTreeFindAbility, 7, 63, 1023);
+
+// Check unlockability of each ability in an n-node tree
+static void BM_AbilityTreeCanUnlock(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> codes = makeKeys("ABILITY_", n);
+    AbilityTree tree;
+    buildAbilityTree(tree, codes);
+    tree.addSkillPoints(2);
+
+    int index = 0;
+    while (state.keepRunning()) {
+        bench::doNotOptimize(tree.canUnlock(codes[index]));
+        if (++index == n) index = 0;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AbilityTreeCanUnlock, 7, 63, 1023);
+
+// List unlockable abilities; the answer is the two root children in every size
+static void BM_AbilityTreeAvailable(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> codes = makeKeys("ABILITY_", n);
+    AbilityTree tree;
+    buildAbilityTree(tree, codes);
+    tree.addSkillPoints(3);
+
+    while (state.keepRunning()) {
+        int count = 0;
+        Ability** available = tree.getAvailableAbilities(count);
+        bench::doNotOptimize(available[0]);
+        delete[] available;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AbilityTreeAvailable, 7, 63, 1023);
+
+// Clone a player's progress (simulation snapshot)
+static void BM_AbilityProgressClone(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> codes = makeKeys("ABILITY_", n);
+    AbilityTree tree;
+    buildAbilityTree(tree, codes);
+    AbilityProgress* source = tree.createProgress();
+    AbilityProgress copy;
+
+    while (state.keepRunning()) {
+        copy = *source;
+        bench::doNotOptimize(copy.unlockedCount);
+    }
+    state.setItemsProcessed(state.iterations());
+    delete source;
+}
+BENCHMARK(BM_AbilityProgressClone, 7, 63, 1023);
+
+// Count differing unlocks between two builds
+static void BM_AbilityProgressDiff(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> codes = makeKeys("ABILITY_", n);
+    AbilityTree tree;
+    buildAbilityTree(tree, codes);
+    AbilityProgress* a = tree.createProgress();
+    AbilityProgress* b = tree.createProgress();
+    tree.addSkillPoints(*a, 1000);
+    for (int i = 1; i < n; i += 2) {
+        tree.unlock(*a, i);
+    }
+
+    while (state.keepRunning()) {
+        bench::doNotOptimize(a->diffCount(*b));
+    }
+    state.setItemsProcessed(state.iterations());
+    delete a;
+    delete b;
+}
+BENCHMARK(BM_AbilityProgressDiff, 7, 63, 1023);
+
+/*******************************************************************************
+ * INVENTORY
+ ******************************************************************************/
+
+// Iterate weapons (1 in 4 items) in an n-item inventory
+static void BM_InventoryFilteredIteration(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> codes = makeKeys("ITEM_", n);
+    Inventory inventory(n);
+    for (int i = 0; i < n; i++) {
+        inventory.addItem(makeItem(codes[i], i));
+    }
+
+    while (state.keepRunning()) {
+        InventoryIterator* it = inventory.createIterator("weapons");
+        int total = 0;
+        while (it->hasNext()) {
+            total += it->next()->value;
+        }
+        delete it;
+        bench::doNotOptimize(total);
+    }
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_InventoryFilteredIteration, 8, 64, 512);
+
+// Iterate everything in an n-item inventory
+static void BM_InventoryFullIteration(bench::State& state) {
+    int n = state.arg();
+    std::vector<std::string> codes = makeKeys("ITEM_", n);
+    Inventory inventory(n);
+    for (int i = 0; i < n; i++) {
+        inventory.addItem(makeItem(codes[i], i));
+    }
+
+    while (state.keepRunning()) {
+        InventoryIterator* it = inventory.createIterator("all");
+        int total = 0;
+        while (it->hasNext()) {
+            total += it->next()->value;
+        }
+        delete it;
+        bench::doNotOptimize(total);
+    }
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_InventoryFullIteration, 8, 64, 512);
+
+/*******************************************************************************
+ * ENTITY STORE
+ ******************************************************************************/
+
+// Victory-style check over n Sentinels: sweep their store slots
+static void BM_EntityStoreCountAlive(bench::State& state) {
+    int n = state.arg();
+    std::vector<Sentinel*> sentinels(n);
+    std::vector<int> slots(n);
+    for (int i = 0; i < n; i++) {
+        sentinels[i] = new Sentinel("Bench", Sentinel::Type::SCOUT);
+        slots[i] = sentinels[i]->getSlot();
+        if (i % 3 == 0) sentinels[i]->setHealth(0);
+    }
+
+    const EntityStore& store = EntityStore::getInstance();
+    while (state.keepRunning()) {
+        bench::doNotOptimize(store.countAlive(slots.data(), n));
+    }
+    state.setItemsProcessed(state.iterations() * n);
+
+    for (Sentinel* sentinel : sentinels) {
+        delete sentinel;
+    }
+}
+BENCHMARK(BM_EntityStoreCountAlive, 16, 256, 4096);
+
+// AoE hit on n Sentinels: one applyDamage batch (health reset each pass)
+static void BM_EntityStoreApplyDamage(bench::State& state) {
+    int n = state.arg();
+    std::vector<Sentinel*> sentinels(n);
+    std::vector<int> slots(n);
+    std::vector<int> amounts(n);
+    std::vector<int> dealt(n);
+    for (int i = 0; i < n; i++) {
+        sentinels[i] = new Sentinel("Bench", Sentinel::Type::SCOUT);
+        slots[i] = sentinels[i]->getSlot();
+        amounts[i] = 10 + (i % 9);
+    }
+
+    EntityStore& store = EntityStore::getInstance();
+    while (state.keepRunning()) {
+        for (int i = 0; i < n; i++) {
+            store.health(slots[i]) = 1000;
+            store.alive(slots[i]) = 1;
+        }
+        bench::doNotOptimize(store.applyDamage(slots.data(), amounts.data(), n, dealt.data()));
+    }
+    state.setItemsProcessed(state.iterations() * n);
+
+    for (Sentinel* sentinel : sentinels) {
+        delete sentinel;
+    }
+}
+BENCHMARK(BM_EntityStoreApplyDamage, 16, 256, 4096);
+
+// One AI tick for n Sentinels of mixed types (shared compiled trees)
+static void BM_SentinelBehaviorTick(bench::State& state) {
+    int n = state.arg();
+    std::vector<SentinelBlackboard> blackboards(n);
+    std::vector<BehaviorContext> contexts(n);
+    for (int i = 0; i < n; i++) {
+        contexts[i].health = 10 + (i * 7) % 90;
+        contexts[i].maxHealth = 100;
+        contexts[i].targetHealth = 20 + (i * 13) % 80;
+        contexts[i].targetMaxHealth = 100;
+        contexts[i].aggression = 3 + i % 8;
+    }
+
+    const BehaviorLibrary& library = BehaviorLibrary::getInstance();
+    while (state.keepRunning()) {
+        for (int i = 0; i < n; i++) {
+            const BehaviorTree& tree = library.get(i % 4);
+            bench::doNotOptimize(tree.evaluate(contexts[i], blackboards[i]));
+        }
+    }
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_SentinelBehaviorTick, 16, 256, 4096);
+
+// Spawn and despawn a wave of n Sentinels (pooled storage, shared names)
+// Label: heap allocations for one more wave after the timed ones, which
+// must stay at 1 or fewer once the pool and store are warm (counted only
+// with allocation tracking: make bench BENCH_FLAGS=-DDEXODUS_MEMPROFILE)
+static const uint64_t SPAWN_WAVE_ALLOCATION_TARGET = 1;
+
+static void BM_SentinelSpawnWave(bench::State& state) {
+    int n = state.arg();
+    std::vector<Sentinel*> wave(n);
+    while (state.keepRunning()) {
+        Sentinel::createRandomBatch(7, n, wave.data());
+        for (Sentinel* sentinel : wave) {
+            delete sentinel;
+        }
+    }
+    state.setItemsProcessed(state.iterations() * n);
+
+    if (!MemoryTracker::isEnabled()) {
+        state.setLabel("allocs/wave: build with DEXODUS_MEMPROFILE");
+        return;
+    }
+    uint64_t allocations = MemoryTracker::getTotalAllocations();
+    Sentinel::createRandomBatch(7, n, wave.data());
+    allocations = MemoryTracker::getTotalAllocations() - allocations;
+    for (Sentinel* sentinel : wave) {
+        delete sentinel;
+    }
+    state.setLabel(std::to_string(allocations) + " allocs/wave" +
+                   (allocations <= SPAWN_WAVE_ALLOCATION_TARGET ? " (target <= 1)"
+                                                                 : " OVER TARGET (<= 1)"));
+}
+BENCHMARK(BM_SentinelSpawnWave, 4, 64, 1024);
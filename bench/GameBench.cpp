@@ -0,0 +1,379 @@
+/*******************************************************************************
+ * GameBench.cpp - End-to-End Throughput Benchmark
+ *
+ * Drives the real Game class through Game::step() with scripted bot players
+ * (exploration, resting, terminal hacking, combat, menus) and reports:
+ * - game turns and input steps per second
+ * - allocations and bytes allocated per turn (memprofile builds)
+ * - resident set size at start, peak and end (Linux /proc/self/statm)
+ *
+ * Bots play one after another: the Overseer is a process-wide singleton,
+ * so two live Game instances would share it. Each bot gets an equal share
+ * of the turn budget; a bot that dies simply starts a new game.
+ *
+ * Command line:
+ *   --bots=N      Number of scripted bots (default 4)
+ *   --seed=N      Base random seed (default 1)
+ *   --turns=N     Total game turns across all bots (default 1000000)
+ *   --json=PATH   Write results as JSON
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "Bench.h"
+#include "../include/Game.h"
+#include "../include/MemoryTracker.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace {
+
+int64_t nowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Resident set size in bytes (0 where unsupported)
+uint64_t residentBytes() {
+#if defined(__linux__)
+    FILE* file = std::fopen("/proc/self/statm", "r");
+    if (file == nullptr) return 0;
+
+    unsigned long totalPages = 0;
+    unsigned long residentPages = 0;
+    int read = std::fscanf(file, "%lu %lu", &totalPages, &residentPages);
+    std::fclose(file);
+
+    if (read != 2) return 0;
+    return static_cast<uint64_t>(residentPages) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+/*******************************************************************************
+ * ScriptedBot - Chooses the next input from the game's visible state
+ *
+ * Uses its own xorshift generator so bot decisions never disturb the game's
+ * rand() stream (which is reseeded per bot for reproducible runs).
+ ******************************************************************************/
+class ScriptedBot {
+private:
+    int id;
+    uint32_t rng;
+
+    // Counters
+    uint64_t steps;
+    uint64_t combats;
+    uint64_t hacks;
+    uint64_t deaths;
+    uint64_t peakResident;      // Highest RSS sampled while playing
+    GameState lastState;
+
+    uint32_t nextRandom() {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        return rng;
+    }
+
+    int roll(int range) {
+        return static_cast<int>(nextRandom() % static_cast<uint32_t>(range));
+    }
+
+    int healthPercent(const Game& game) const {
+        Player* player = game.getPlayer();
+        if (player == nullptr || player->getMaxHealth() <= 0) return 100;
+        return (player->getHealth() * 100) / player->getMaxHealth();
+    }
+
+    bool hasConsumable(const Game& game) const {
+        InventoryIterator* it = game.getInventory()->createIterator("consumables");
+        bool found = it->hasNext();
+        delete it;
+        return found;
+    }
+
+    std::string exploreInput() {
+        static const char* directions[] = {"n", "s", "e", "w"};
+        return directions[roll(4)];
+    }
+
+    // Pick an input for the current state
+    std::string chooseInput(const Game& game) {
+        switch (game.getState()) {
+            case GameState::MAIN_MENU:
+                return "1";
+
+            case GameState::NEW_GAME:
+                return "Bot" + std::to_string(id);
+
+            case GameState::PLAYING: {
+                if (healthPercent(game) < 35) return "r";
+
+                int r = roll(100);
+                if (r < 62) return exploreInput();
+                if (r < 74) return "h";
+                if (r < 82) return "r";
+                if (r < 86) return "i";
+                if (r < 90) return "l";
+                if (r < 94) return "a";
+                return exploreInput();
+            }
+
+            case GameState::COMBAT: {
+                if (healthPercent(game) < 30 && hasConsumable(game)) return "4";
+
+                int r = roll(100);
+                if (r < 3) return "5";
+                if (r < 8) return "3";
+                if (r < 12) return "2";
+                return "1";
+            }
+
+            case GameState::HACKING: {
+                int r = roll(10);
+                if (r == 0) return "4";
+                return std::to_string(1 + r % 3);
+            }
+
+            case GameState::INVENTORY:
+                return roll(2) == 0 ? "4" : std::to_string(1 + roll(3));
+
+            case GameState::ABILITIES: {
+                int r = roll(10);
+                if (r < 3) return "1";
+                if (r < 5) return "2";
+                return "3";
+            }
+
+            case GameState::UNLOCK_ABILITY: {
+                int count = 0;
+                Ability** available = game.getAbilities()->getAvailableAbilities(count);
+                std::string code = count > 0 ? available[roll(count)]->code : "";
+                delete[] available;
+                return code;
+            }
+
+            case GameState::COMBAT_ABILITY: {
+                int count = game.getAbilities()->getUnlockedCount();
+                return count > 0 ? std::to_string(1 + roll(count)) : "back";
+            }
+
+            case GameState::EVENT_LOG:
+                return roll(3) == 0 ? "1" : "3";
+
+            case GameState::SAVE_MENU:
+                return "back";
+
+            default:
+                return "";      // GAME_OVER / VICTORY: any input continues
+        }
+    }
+
+public:
+    ScriptedBot(int id, uint32_t seed)
+        : id(id), rng(seed * 2654435761u + 1u), steps(0), combats(0),
+          hacks(0), deaths(0), peakResident(0), lastState(GameState::MAIN_MENU) {
+        if (rng == 0) rng = 1;
+    }
+
+    // Play until the game has advanced the given number of turns
+    // Step 1: Start a game and reseed the game's random stream
+    // Step 2: Feed one input per step, counting state entries
+    // Step 3: Quit cleanly when the budget is spent
+    uint64_t play(Game& game, uint64_t turnBudget, unsigned int seed) {
+        uint64_t turnsPlayed = 0;
+
+        // Step 1: New game
+        game.step("1");
+        game.step("Bot" + std::to_string(id));
+        srand(seed);
+        int lastTurn = game.getTurnCount();
+
+        // Step 2: Drive the state machine
+        while (turnsPlayed < turnBudget && game.isActive()) {
+            game.step(chooseInput(game));
+            steps++;
+
+            if ((steps & 8191) == 0) {
+                uint64_t rss = residentBytes();
+                if (rss > peakResident) peakResident = rss;
+            }
+
+            GameState state = game.getState();
+            if (state != lastState) {
+                if (state == GameState::COMBAT && lastState != GameState::COMBAT_ABILITY) {
+                    combats++;
+                }
+                else if (state == GameState::HACKING) hacks++;
+                else if (state == GameState::GAME_OVER) deaths++;
+                lastState = state;
+            }
+
+            // Turn counter restarts with each new game
+            int turn = game.getTurnCount();
+            if (turn > lastTurn) turnsPlayed += static_cast<uint64_t>(turn - lastTurn);
+            lastTurn = turn;
+        }
+
+        // Step 3: Leave the session and exit
+        if (game.getState() == GameState::PLAYING) game.step("q");
+        game.quit();
+
+        return turnsPlayed;
+    }
+
+    uint64_t getSteps() const { return steps; }
+    uint64_t getCombats() const { return combats; }
+    uint64_t getHacks() const { return hacks; }
+    uint64_t getDeaths() const { return deaths; }
+    uint64_t getPeakResident() const { return peakResident; }
+};
+
+} // namespace
+
+/*******************************************************************************
+ * MAIN
+ ******************************************************************************/
+int main(int argc, char** argv) {
+    int bots = 4;
+    unsigned int seed = 1;
+    uint64_t totalTurns = 1000000;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option.rfind("--bots=", 0) == 0) {
+            bots = std::atoi(option.c_str() + 7);
+        } else if (option.rfind("--seed=", 0) == 0) {
+            seed = static_cast<unsigned int>(std::strtoul(option.c_str() + 7, nullptr, 10));
+        } else if (option.rfind("--turns=", 0) == 0) {
+            totalTurns = std::strtoull(option.c_str() + 8, nullptr, 10);
+        } else if (option.rfind("--json=", 0) == 0) {
+            jsonPath = option.substr(7);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--bots=N] [--seed=N] [--turns=N] [--json=PATH]" << std::endl;
+            return 1;
+        }
+    }
+    if (bots < 1) bots = 1;
+
+    uint64_t turnsPerBot = totalTurns / static_cast<uint64_t>(bots);
+    if (turnsPerBot == 0) turnsPerBot = 1;
+
+    // Game output goes to the null buffer for the whole run
+    bench::NullBuffer nullBuffer;
+    std::ostream report(std::cout.rdbuf());
+    std::streambuf* original = std::cout.rdbuf(&nullBuffer);
+
+    uint64_t rssStart = residentBytes();
+    uint64_t rssPeak = rssStart;
+    uint64_t allocationsStart = MemoryTracker::getTotalAllocations();
+    uint64_t bytesStart = 0;
+    for (int t = 0; t < static_cast<int>(MemSubsystem::SUBSYSTEM_COUNT); t++) {
+        bytesStart += MemoryTracker::getStats(static_cast<MemSubsystem>(t)).bytesAllocated;
+    }
+
+    uint64_t turnsPlayed = 0;
+    uint64_t steps = 0, combats = 0, hacks = 0, deaths = 0;
+    int64_t start = nowNanos();
+
+    for (int b = 0; b < bots; b++) {
+        ScriptedBot bot(b, seed + static_cast<unsigned int>(b));
+        Game* game = new Game();
+        game->setAutoSaveInterval(0);   // Measure game logic, not save files
+
+        turnsPlayed += bot.play(*game, turnsPerBot, seed + static_cast<unsigned int>(b));
+        steps += bot.getSteps();
+        combats += bot.getCombats();
+        hacks += bot.getHacks();
+        deaths += bot.getDeaths();
+
+        // Sample before the session's memory is released
+        uint64_t rss = residentBytes();
+        if (rss > rssPeak) rssPeak = rss;
+        if (bot.getPeakResident() > rssPeak) rssPeak = bot.getPeakResident();
+
+        delete game;
+    }
+
+    int64_t elapsed = nowNanos() - start;
+    uint64_t rssEnd = residentBytes();
+    uint64_t allocations = MemoryTracker::getTotalAllocations() - allocationsStart;
+    uint64_t bytes = 0;
+    for (int t = 0; t < static_cast<int>(MemSubsystem::SUBSYSTEM_COUNT); t++) {
+        bytes += MemoryTracker::getStats(static_cast<MemSubsystem>(t)).bytesAllocated;
+    }
+    bytes -= bytesStart;
+
+    std::cout.rdbuf(original);
+
+    double seconds = static_cast<double>(elapsed) / 1e9;
+    double turnsPerSecond = seconds > 0.0 ? static_cast<double>(turnsPlayed) / seconds : 0.0;
+    double stepsPerSecond = seconds > 0.0 ? static_cast<double>(steps) / seconds : 0.0;
+    double turns = turnsPlayed > 0 ? static_cast<double>(turnsPlayed) : 1.0;
+    bool tracked = MemoryTracker::isEnabled();
+
+    report << "\n=== GAME THROUGHPUT (" << bots << " bots, seed " << seed << ") ===" << std::endl;
+    report << std::fixed << std::setprecision(1);
+    report << "Turns:            " << turnsPlayed << " (" << steps << " inputs)" << std::endl;
+    report << "Elapsed:          " << std::setprecision(3) << seconds << " s" << std::endl;
+    report << std::setprecision(0);
+    report << "Turns/sec:        " << turnsPerSecond << std::endl;
+    report << "Inputs/sec:       " << stepsPerSecond << std::endl;
+    report << "Combats/hacks:    " << combats << " / " << hacks << " (" << deaths << " deaths)" << std::endl;
+    report << std::setprecision(2);
+    if (tracked) {
+        report << "Allocs/turn:      " << static_cast<double>(allocations) / turns << std::endl;
+        report << "Bytes/turn:       " << static_cast<double>(bytes) / turns << std::endl;
+    } else {
+        report << "Allocs/turn:      n/a (build with DEXODUS_MEMPROFILE)" << std::endl;
+    }
+    report << "RSS start/peak/end: " << rssStart / 1024 << " / " << rssPeak / 1024
+           << " / " << rssEnd / 1024 << " KiB" << std::endl;
+    report << "RSS growth/turn:  " << static_cast<double>(rssPeak - rssStart) / turns
+           << " bytes" << std::endl;
+
+    if (!jsonPath.empty()) {
+        std::ofstream file(jsonPath);
+        if (!file.is_open()) {
+            std::cerr << "[GameBench] Failed to open JSON output: " << jsonPath << std::endl;
+            return 1;
+        }
+
+        file << std::fixed << std::setprecision(3);
+        file << "{\n"
+             << "  \"bots\": " << bots << ",\n"
+             << "  \"seed\": " << seed << ",\n"
+             << "  \"turns\": " << turnsPlayed << ",\n"
+             << "  \"inputs\": " << steps << ",\n"
+             << "  \"seconds\": " << seconds << ",\n"
+             << "  \"turns_per_second\": " << turnsPerSecond << ",\n"
+             << "  \"inputs_per_second\": " << stepsPerSecond << ",\n"
+             << "  \"combats\": " << combats << ",\n"
+             << "  \"hacks\": " << hacks << ",\n"
+             << "  \"deaths\": " << deaths << ",\n"
+             << "  \"allocations_tracked\": " << (tracked ? "true" : "false") << ",\n"
+             << "  \"allocations_per_turn\": " << static_cast<double>(allocations) / turns << ",\n"
+             << "  \"bytes_per_turn\": " << static_cast<double>(bytes) / turns << ",\n"
+             << "  \"rss_start_bytes\": " << rssStart << ",\n"
+             << "  \"rss_peak_bytes\": " << rssPeak << ",\n"
+             << "  \"rss_end_bytes\": " << rssEnd << "\n"
+             << "}\n";
+
+        report << "[GameBench] Results written: " << jsonPath << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,267 @@
+/*******************************************************************************
+ * SaveBench.cpp - Save Format Benchmarks (raw vs compressed)
+ *
+ * Encodes and decodes a synthetic save at several sizes, once with the raw
+ * chunk layout and once with the body packed into ZBLK blocks. The size
+ * argument is the number of logged events; inventory and sector enemies
+ * grow with it. Compressed runs report their file size as a share of the
+ * raw file in the label column. The PREVIEW benchmarks read a save file
+ * from disk: whole file + decode against a mapped SaveView. CHECKSUM
+ * compares the CRC-32C paths and times a full integrity check.
+ *
+ * Run with "make bench BENCH_ARGS=--filter=Save".
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "Bench.h"
+#include "../include/SaveFormat.h"
+#include "../include/SaveLoad.h"
+#include "../include/SaveView.h"
+#include "../include/SaveChecksum.h"
+#include "../include/AutoSave.h"
+#include <cstdio>
+#include <string>
+
+namespace {
+
+// A save the size of a long session (same vocabulary the game logs)
+void buildState(SaveState& state, int events, bool compressed) {
+    static const char* sectorNames[] = {
+        "Central Nexus", "Data Stream Junction", "Firewall Array", "Memory Archives",
+        "Neural Pathway", "Quarantine Zone", "The Core"
+    };
+    static const char* itemCodes[] = {
+        "WEAPON_BASIC", "HEAL_START", "HACK_REWARD", "HEAL_SMALL", "DATA_SHARD"
+    };
+    static const char* eventTypes[] = {"COMBAT", "EXPLORE", "SYSTEM", "STORY"};
+
+    state.version = SAVE_VERSION;
+    state.compressed = compressed;
+    state.playerName = "Bench Runner";
+    state.level = 12;
+    state.saveTime = 1760000000;
+    state.health = 140;
+    state.maxHealth = 180;
+    state.currentSector = sectorNames[1];
+
+    int sectors = events / 16 > 7 ? events / 16 : 7;
+    state.sectorCount = sectors;
+    state.setVisitedWordCount((sectors + 63) / 64);
+    for (int i = 0; i < sectors; i += 2) {
+        state.visitedSectors[i / 64] |= 1ULL << (i % 64);
+    }
+    state.setSectorEnemyCount(sectors * 2);
+    for (int i = 0; i < state.sectorEnemyCount; i++) {
+        state.enemySectors[i] = i / 2;
+        state.enemyTypes[i] = i % 3;
+        state.enemyHealth[i] = 30 + i % 40;
+        state.enemyNames[i] = i % 3 == 0 ? "Sentinel Drone" : "Sentinel Hunter";
+    }
+
+    state.setInventoryCount(events / 4 + 1);
+    for (int i = 0; i < state.inventoryCount; i++) {
+        state.inventoryCodes[i] = itemCodes[i % 5];
+        state.inventoryQuantities[i] = 1 + i % 3;
+    }
+
+    int first = state.appendEvents(events);
+    for (int i = first; i < state.eventCount; i++) {
+        char timestamp[32];
+        snprintf(timestamp, sizeof(timestamp), "Sat Oct 18 %02d:%02d:%02d 2026",
+                 (i / 3600) % 24, (i / 60) % 60, i % 60);
+        state.eventTypes[i] = eventTypes[i % 4];
+        state.eventTimestamps[i] = timestamp;
+        state.eventDescriptions[i] = i % 2 == 0
+            ? std::string("Entered ") + sectorNames[i % 7]
+            : "Defeated " + std::to_string(1 + i % 3) + " Sentinel(s), +35 XP";
+    }
+    state.turnCount = events * 2;
+}
+
+// "1234 B (27.5% of raw)"
+std::string sizeLabel(std::size_t size, std::size_t rawSize) {
+    char text[64];
+    snprintf(text, sizeof(text), "%zu B (%.1f%% of raw)", size,
+             rawSize > 0 ? 100.0 * static_cast<double>(size) / static_cast<double>(rawSize) : 0.0);
+    return text;
+}
+
+std::size_t rawSizeFor(int events) {
+    SaveState state;
+    buildState(state, events, false);
+    std::string bytes;
+    encodeSave(state, bytes);
+    return bytes.size();
+}
+
+void runEncode(bench::State& state, bool compressed) {
+    SaveState save;
+    buildState(save, state.arg(), compressed);
+    std::size_t rawSize = rawSizeFor(state.arg());
+
+    std::string bytes;
+    while (state.keepRunning()) {
+        encodeSave(save, bytes);
+        bench::doNotOptimize(bytes.data());
+    }
+    state.setItemsProcessed(state.iterations());          // One save per iteration
+    state.setBytesProcessed(state.iterations() * rawSize);
+    state.setLabel(sizeLabel(bytes.size(), rawSize));
+}
+
+void runDecode(bench::State& state, bool compressed) {
+    SaveState save;
+    buildState(save, state.arg(), compressed);
+    std::string bytes;
+    encodeSave(save, bytes);
+    std::size_t rawSize = rawSizeFor(state.arg());
+
+    while (state.keepRunning()) {
+        SaveState loaded;
+        bool ok = decodeSave(reinterpret_cast<const unsigned char*>(bytes.data()),
+                             bytes.size(), loaded);
+        bench::doNotOptimize(ok);
+    }
+    state.setItemsProcessed(state.iterations());          // One save per iteration
+    state.setBytesProcessed(state.iterations() * rawSize);
+    state.setLabel(sizeLabel(bytes.size(), rawSize));
+}
+
+} // namespace
+
+/*******************************************************************************
+ * ENCODE
+ ******************************************************************************/
+
+static void BM_SaveEncodeRaw(bench::State& state) {
+    runEncode(state, false);
+}
+BENCHMARK(BM_SaveEncodeRaw, 64, 1024, 16384, 131072);
+
+static void BM_SaveEncodeCompressed(bench::State& state) {
+    runEncode(state, true);
+}
+BENCHMARK(BM_SaveEncodeCompressed, 64, 1024, 16384, 131072);
+
+/*******************************************************************************
+ * DECODE
+ ******************************************************************************/
+
+static void BM_SaveDecodeRaw(bench::State& state) {
+    runDecode(state, false);
+}
+BENCHMARK(BM_SaveDecodeRaw, 64, 1024, 16384, 131072);
+
+static void BM_SaveDecodeCompressed(bench::State& state) {
+    runDecode(state, true);
+}
+BENCHMARK(BM_SaveDecodeCompressed, 64, 1024, 16384, 131072);
+
+/*******************************************************************************
+ * INFO (slot listing reads only the uncompressed INFO chunk)
+ ******************************************************************************/
+
+static void BM_SaveInfoCompressed(bench::State& state) {
+    SaveState save;
+    buildState(save, state.arg(), true);
+    std::string bytes;
+    encodeSave(save, bytes);
+
+    while (state.keepRunning()) {
+        SaveState info;
+        bool ok = decodeSave(reinterpret_cast<const unsigned char*>(bytes.data()),
+                             bytes.size(), info, true);
+        bench::doNotOptimize(ok);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SaveInfoCompressed, 64, 131072);
+
+/*******************************************************************************
+ * PREVIEW (save file on disk: read() + decode vs mapped SaveView)
+ ******************************************************************************/
+
+static const char* PREVIEW_FILE = "bench_preview.dat";
+
+// Helper: Write the synthetic save (compressed, as the game writes it)
+static void writePreviewFile(int events) {
+    SaveState save;
+    buildState(save, events, true);
+    std::string bytes;
+    encodeSave(save, bytes);
+    writeFileAtomic(PREVIEW_FILE, bytes.data(), bytes.size());
+}
+
+static void BM_SavePreviewRead(bench::State& state) {
+    writePreviewFile(state.arg());
+    while (state.keepRunning()) {
+        std::string bytes;
+        readFileBytes(PREVIEW_FILE, bytes);
+        SaveState info;
+        bool ok = decodeSave(reinterpret_cast<const unsigned char*>(bytes.data()),
+                             bytes.size(), info, true);
+        bench::doNotOptimize(ok);
+    }
+    state.setItemsProcessed(state.iterations());
+    std::remove(PREVIEW_FILE);
+}
+BENCHMARK(BM_SavePreviewRead, 1024, 131072);
+
+static void BM_SavePreviewMapped(bench::State& state) {
+    writePreviewFile(state.arg());
+    while (state.keepRunning()) {
+        SaveView view;
+        SaveState info;
+        bool ok = view.open(PREVIEW_FILE) && view.readInfo(info);
+        bench::doNotOptimize(ok);
+    }
+    state.setItemsProcessed(state.iterations());
+    std::remove(PREVIEW_FILE);
+}
+BENCHMARK(BM_SavePreviewMapped, 1024, 131072);
+
+/*******************************************************************************
+ * CHECKSUM (CRC-32C paths, whole-save integrity check)
+ ******************************************************************************/
+
+static void runChecksum(bench::State& state, bool hardware) {
+    std::string bytes(static_cast<std::size_t>(state.arg()), '\0');
+    for (std::size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = static_cast<char>(i * 131 + (i >> 7));
+    }
+    while (state.keepRunning()) {
+        unsigned int crc = hardware ? crc32c(0, bytes.data(), bytes.size())
+                                    : crc32cPortable(0, bytes.data(), bytes.size());
+        bench::doNotOptimize(crc);
+    }
+    state.setBytesProcessed(state.iterations() * bytes.size());
+    state.setLabel(hardware && !crc32cHardware() ? "no CRC instruction" : "");
+}
+
+static void BM_Crc32c(bench::State& state) {
+    runChecksum(state, true);
+}
+BENCHMARK(BM_Crc32c, 256, 65536, 1048576);
+
+static void BM_Crc32cPortable(bench::State& state) {
+    runChecksum(state, false);
+}
+BENCHMARK(BM_Crc32cPortable, 256, 65536, 1048576);
+
+static void BM_SaveVerify(bench::State& state) {
+    SaveState save;
+    buildState(save, state.arg(), true);
+    std::string bytes;
+    encodeSave(save, bytes);
+
+    while (state.keepRunning()) {
+        SaveIntegrity integrity = verifySave(reinterpret_cast<const unsigned char*>(bytes.data()),
+                                             bytes.size());
+        bench::doNotOptimize(integrity);
+    }
+    state.setItemsProcessed(state.iterations());
+    state.setBytesProcessed(state.iterations() * bytes.size());
+}
+BENCHMARK(BM_SaveVerify, 1024, 131072);
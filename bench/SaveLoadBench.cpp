@@ -0,0 +1,386 @@
+/*******************************************************************************
+ * SaveLoadBench.cpp - Save/Load Throughput Benchmark
+ *
+ * Builds synthetic game worlds of increasing size out of the real game
+ * objects (Player, Inventory, AbilityTree, GridMap, EventLog) and times
+ * SaveLoadManager::saveGame() and loadGame() on them, raw and compressed.
+ * Per world size and mode it reports:
+ * - median and best latency of a full save and a full load
+ * - bytes written (size of the save file)
+ * - allocations and bytes allocated per save / load (allocation tracking
+ *   is compiled in by "make savebench")
+ *
+ * World scale N holds 8N inventory items, 4N abilities (half unlocked),
+ * 64N logged events and 6 + N sectors (capped at the map's 50), each with
+ * a few Sentinels. Saves go through the normal path, fsync included.
+ *
+ * Command line:
+ *   --scales=A,B,... World scales (default 1,4,16,64,256)
+ *   --reps=N         Saves and loads per scale and mode (default 15)
+ *   --json=PATH      Write results as JSON
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "Bench.h"
+#include "../include/Game.h"
+#include "../include/SaveLoad.h"
+#include "../include/MemoryTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+namespace {
+
+const char* SAVE_DIRECTORY = "bench_saves";
+const char* SAVE_SLOT = "savebench";
+const int MAX_SCALES = 16;
+
+int64_t nowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t bytesAllocated() {
+    uint64_t total = 0;
+    for (int t = 0; t < static_cast<int>(MemSubsystem::SUBSYSTEM_COUNT); t++) {
+        total += MemoryTracker::getStats(static_cast<MemSubsystem>(t)).bytesAllocated;
+    }
+    return total;
+}
+
+/*******************************************************************************
+ * World - One synthetic game session (owns every object)
+ ******************************************************************************/
+struct World {
+    ItemDatabase* items;
+    Inventory* inventory;
+    AbilityTree* abilities;
+    GridMap* map;
+    EventLog* events;
+    Player* player;
+    SessionStats stats;
+
+    World() : items(nullptr), inventory(nullptr), abilities(nullptr), map(nullptr),
+              events(nullptr), player(nullptr) {}
+
+    ~World() {
+        delete player;
+        delete events;
+        delete map;
+        delete abilities;
+        delete inventory;
+        delete items;
+    }
+};
+
+// Build a world of the given scale
+// Step 1: Item database + inventory (8N distinct stacks)
+// Step 2: Ability tree (complete binary tree of 4N nodes, first half unlocked)
+// Step 3: Sector chain with Sentinels, every other sector visited
+// Step 4: Player, event log (64N events), session counters
+void buildWorld(World& world, int scale) {
+    static const char* eventTypes[] = {"COMBAT", "EXPLORE", "SYSTEM", "STORY"};
+
+    // Step 1
+    int itemCount = 8 * scale;
+    world.items = new ItemDatabase();
+    world.inventory = new Inventory(itemCount);
+    for (int i = 0; i < itemCount; i++) {
+        std::string code = "SYN_ITEM_" + std::to_string(i);
+        Item* item = i % 2 == 0
+            ? ItemDatabase::createWeapon(code, "Synthetic Blade " + std::to_string(i),
+                                         "Generated for the benchmark", 10 + i % 40)
+            : ItemDatabase::createConsumable(code, "Synthetic Patch " + std::to_string(i),
+                                             "Generated for the benchmark", 5 + i % 25);
+        world.items->addItem(item);
+        Item* stack = new Item(*item);
+        stack->quantity = 1 + i % 5;
+        world.inventory->addItem(stack);
+    }
+
+    // Step 2
+    int abilityCount = 4 * scale;
+    world.abilities = new AbilityTree();
+    world.abilities->setRoot(Ability("SYN_ABILITY_0", "Synthetic Root", "Generated",
+                                     Ability::Type::COMBAT, 0, 10));
+    for (int i = 1; i < abilityCount; i++) {
+        Ability ability("SYN_ABILITY_" + std::to_string(i), "Synthetic " + std::to_string(i),
+                        "Generated", static_cast<Ability::Type>(i % 4), 1, 5 + i % 20);
+        world.abilities->insert(ability, "SYN_ABILITY_" + std::to_string((i - 1) / 2),
+                                i % 2 == 1);
+    }
+    world.abilities->addSkillPoints(abilityCount);
+    for (int i = 1; i < abilityCount / 2; i++) {
+        world.abilities->unlock("SYN_ABILITY_" + std::to_string(i));
+    }
+
+    // Step 3
+    int sectorCount = std::min(6 + scale, 50);
+    world.map = new GridMap();
+    SectorNode* previous = nullptr;
+    for (int i = 0; i < sectorCount; i++) {
+        SectorNode* sector = new SectorNode("Synthetic Sector " + std::to_string(i),
+                                            "Generated for the benchmark", 1 + i % 10);
+        sector->visited = i % 2 == 0;
+        for (int e = 0; e < 1 + i % 4; e++) {
+            sector->addEnemy(new Sentinel(e % 2 == 0 ? "Sentinel Drone" : "Sentinel Hunter",
+                                          static_cast<Sentinel::Type>(e % 4)));
+        }
+        world.map->addSector(sector);
+        if (previous != nullptr) {
+            GridMap::connectSectors(previous, sector, "east");
+        } else {
+            world.map->setStartSector(sector);
+        }
+        previous = sector;
+    }
+    world.map->setCurrentSector(world.map->getStartSector());
+
+    // Step 4
+    world.player = new Player("Bench Runner");
+    world.player->setLevel(1 + scale % 50);
+    world.player->setExperience(scale * 37);
+    world.player->setCurrentSector(world.map->getCurrentSector()->name);
+
+    int eventCount = 64 * scale;
+    world.events = new EventLog();
+    for (int i = 0; i < eventCount; i++) {
+        world.events->addEvent("Synthetic event " + std::to_string(i) + " in sector " +
+                               std::to_string(i % sectorCount), eventTypes[i % 4]);
+    }
+
+    world.stats.turnCount = eventCount * 2;
+    world.stats.sectorsExplored = sectorCount / 2;
+    world.stats.enemiesDefeated = eventCount / 4;
+    world.stats.hacksCompleted = eventCount / 8;
+    world.stats.eventsTriggered = eventCount;
+}
+
+/*******************************************************************************
+ * Measurement
+ ******************************************************************************/
+struct Result {
+    int scale;
+    bool compressed;
+    long long fileBytes;
+    double saveMedianUs;
+    double saveBestUs;
+    double loadMedianUs;
+    double loadBestUs;
+    double saveAllocations;     // Per operation
+    double saveBytes;
+    double loadAllocations;
+    double loadBytes;
+    bool loaded;                // Every load succeeded
+};
+
+double median(int64_t* samples, int count) {
+    std::sort(samples, samples + count);
+    return count % 2 == 1 ? static_cast<double>(samples[count / 2])
+                          : (samples[count / 2 - 1] + samples[count / 2]) / 2.0;
+}
+
+long long fileSize(const std::string& path) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return -1;
+    return static_cast<long long>(st.st_size);
+}
+
+// Step 1: Save the source world reps times (timed, allocations counted)
+// Step 2: Load into a same-shaped target world reps times
+Result measure(int scale, bool compressed, int reps) {
+    SaveLoadManager& manager = SaveLoadManager::getInstance();
+    manager.setCompression(compressed);
+
+    World source;
+    World target;
+    buildWorld(source, scale);
+    buildWorld(target, scale);
+
+    Result result = Result();
+    result.scale = scale;
+    result.compressed = compressed;
+    result.loaded = true;
+    int64_t* samples = new int64_t[reps];
+
+    // Step 1
+    uint64_t allocations = MemoryTracker::getTotalAllocations();
+    uint64_t bytes = bytesAllocated();
+    for (int r = 0; r < reps; r++) {
+        int64_t start = nowNanos();
+        manager.saveGame(SAVE_SLOT, source.player, source.inventory, source.abilities,
+                         source.map, source.events, source.stats);
+        samples[r] = nowNanos() - start;
+    }
+    result.saveAllocations = static_cast<double>(MemoryTracker::getTotalAllocations() -
+                                                 allocations) / reps;
+    result.saveBytes = static_cast<double>(bytesAllocated() - bytes) / reps;
+    result.saveBestUs = *std::min_element(samples, samples + reps) / 1e3;
+    result.saveMedianUs = median(samples, reps) / 1e3;
+    result.fileBytes = fileSize(manager.getSavePath() + "/" + SAVE_SLOT + ".dat");
+
+    // Step 2
+    allocations = MemoryTracker::getTotalAllocations();
+    bytes = bytesAllocated();
+    for (int r = 0; r < reps; r++) {
+        SessionStats stats;
+        int64_t start = nowNanos();
+        bool loaded = manager.loadGame(SAVE_SLOT, target.player, target.inventory,
+                                       target.abilities, target.map, target.events,
+                                       stats, target.items);
+        samples[r] = nowNanos() - start;
+        result.loaded = result.loaded && loaded;
+    }
+    result.loadAllocations = static_cast<double>(MemoryTracker::getTotalAllocations() -
+                                                 allocations) / reps;
+    result.loadBytes = static_cast<double>(bytesAllocated() - bytes) / reps;
+    result.loadBestUs = *std::min_element(samples, samples + reps) / 1e3;
+    result.loadMedianUs = median(samples, reps) / 1e3;
+
+    delete[] samples;
+    return result;
+}
+
+} // namespace
+
+/*******************************************************************************
+ * MAIN
+ ******************************************************************************/
+int main(int argc, char** argv) {
+    int scales[MAX_SCALES] = {1, 4, 16, 64, 256};
+    int scaleCount = 5;
+    int reps = 15;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option.rfind("--scales=", 0) == 0) {
+            scaleCount = 0;
+            const char* cursor = option.c_str() + 9;
+            while (*cursor != '\0' && scaleCount < MAX_SCALES) {
+                char* end = nullptr;
+                long value = std::strtol(cursor, &end, 10);
+                if (end == cursor) break;
+                if (value > 0) scales[scaleCount++] = static_cast<int>(value);
+                cursor = *end == ',' ? end + 1 : end;
+            }
+        } else if (option.rfind("--reps=", 0) == 0) {
+            reps = std::atoi(option.c_str() + 7);
+        } else if (option.rfind("--json=", 0) == 0) {
+            jsonPath = option.substr(7);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--scales=1,4,16] [--reps=N] [--json=PATH]" << std::endl;
+            return 1;
+        }
+    }
+    if (reps < 1) reps = 1;
+    if (scaleCount == 0) {
+        std::cerr << "[SaveLoadBench] No valid scales given." << std::endl;
+        return 1;
+    }
+
+    // Game output goes to the null buffer for the whole run
+    bench::NullBuffer nullBuffer;
+    std::ostream report(std::cout.rdbuf());
+    std::streambuf* original = std::cout.rdbuf(&nullBuffer);
+
+#ifdef _WIN32
+    _mkdir(SAVE_DIRECTORY);
+#else
+    mkdir(SAVE_DIRECTORY, 0755);
+#endif
+    SaveLoadManager& manager = SaveLoadManager::getInstance();
+    manager.initialize(SAVE_DIRECTORY);
+
+    Result results[MAX_SCALES * 2];
+    int resultCount = 0;
+    for (int s = 0; s < scaleCount; s++) {
+        results[resultCount++] = measure(scales[s], false, reps);
+        results[resultCount++] = measure(scales[s], true, reps);
+    }
+    manager.deleteSave(SAVE_SLOT);
+    manager.setCompression(true);
+
+    std::cout.rdbuf(original);
+
+    bool tracked = MemoryTracker::isEnabled();
+    bool allLoaded = true;
+    report << "\n=== SAVE/LOAD THROUGHPUT (" << reps << " reps, median / best) ===" << std::endl;
+    report << std::left << std::setw(7) << "Scale" << std::setw(6) << "Mode"
+           << std::right << std::setw(11) << "File B"
+           << std::setw(20) << "Save us" << std::setw(20) << "Load us"
+           << std::setw(13) << "Save allocs" << std::setw(13) << "Load allocs"
+           << std::setw(13) << "Load KiB" << std::endl;
+    report << std::fixed;
+    for (int i = 0; i < resultCount; i++) {
+        const Result& r = results[i];
+        allLoaded = allLoaded && r.loaded;
+
+        std::ostringstream save;
+        std::ostringstream load;
+        save << std::fixed << std::setprecision(1) << r.saveMedianUs << " / " << r.saveBestUs;
+        load << std::fixed << std::setprecision(1) << r.loadMedianUs << " / " << r.loadBestUs;
+        report << std::left << std::setw(7) << r.scale << std::setw(6)
+               << (r.compressed ? "lz" : "raw") << std::right << std::setw(11) << r.fileBytes
+               << std::setw(20) << save.str() << std::setw(20) << load.str()
+               << std::setprecision(0);
+        if (tracked) {
+            report << std::setw(13) << r.saveAllocations << std::setw(13) << r.loadAllocations
+                   << std::setprecision(1) << std::setw(13) << r.loadBytes / 1024.0;
+        } else {
+            report << std::setw(13) << "n/a" << std::setw(13) << "n/a" << std::setw(13) << "n/a";
+        }
+        report << (r.loaded ? "" : "  LOAD FAILED") << std::endl;
+    }
+    if (!tracked) {
+        report << "(allocations: build with DEXODUS_MEMPROFILE, e.g. make savebench)" << std::endl;
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream file(jsonPath);
+        if (!file.is_open()) {
+            std::cerr << "[SaveLoadBench] Failed to open JSON output: " << jsonPath << std::endl;
+            return 1;
+        }
+
+        file << std::fixed << std::setprecision(3);
+        file << "{\n"
+             << "  \"reps\": " << reps << ",\n"
+             << "  \"allocations_tracked\": " << (tracked ? "true" : "false") << ",\n"
+             << "  \"results\": [\n";
+        for (int i = 0; i < resultCount; i++) {
+            const Result& r = results[i];
+            file << "    {\"scale\": " << r.scale
+                 << ", \"compressed\": " << (r.compressed ? "true" : "false")
+                 << ", \"file_bytes\": " << r.fileBytes
+                 << ", \"save_median_us\": " << r.saveMedianUs
+                 << ", \"save_best_us\": " << r.saveBestUs
+                 << ", \"load_median_us\": " << r.loadMedianUs
+                 << ", \"load_best_us\": " << r.loadBestUs
+                 << ", \"save_allocations\": " << r.saveAllocations
+                 << ", \"save_bytes_allocated\": " << r.saveBytes
+                 << ", \"load_allocations\": " << r.loadAllocations
+                 << ", \"load_bytes_allocated\": " << r.loadBytes
+                 << ", \"loaded\": " << (r.loaded ? "true" : "false") << "}"
+                 << (i + 1 < resultCount ? "," : "") << "\n";
+        }
+        file << "  ]\n}\n";
+
+        report << "[SaveLoadBench] Results written: " << jsonPath << std::endl;
+    }
+
+    return allLoaded ? 0 : 1;
+}
@@ -0,0 +1,730 @@
+/*******************************************************************************
+ * SaveFuzz.cpp - Fuzz Harness for the Load Path
+ *
+ * Feeds arbitrary bytes to every reader that touches files on disk. The
+ * first input byte picks the target, the rest is the file:
+ *
+ *   0  save     decodeSave (full + INFO only), verifySave, SaveView
+ *               (open, readInfo, load of some sections, findChunk, verify)
+ *   1  journal  replayJournal on top of a decoded base of the same generation
+ *   2  block    lzDecompress (3-byte little-endian output size, then data)
+ *   3  config   parseConfig
+ *   4  index    SaveIndex::open on a directory holding the bytes as saves.idx
+ *
+ * Half of the mutated saves, journals and index files get their chunk CRCs
+ * recomputed ("resealed"), so the decoders behind the checksum check see
+ * damaged payloads too instead of only the CRC rejecting them.
+ *
+ * Whatever decodes is encoded, decoded and encoded again, and both
+ * encodings must be byte-identical (config: format and re-parse without a
+ * rejected line), so a field the writer and reader disagree on is caught
+ * as well as a crash.
+ *
+ * Two ways to run it:
+ * - "make fuzz": standalone driver below, built with ASan + UBSan. It seeds
+ *   a corpus with real files (raw and compressed saves, journals, index,
+ *   config), mutates them (bit flips, boundary bytes, huge varints,
+ *   inserts, erases, copies, splices, reseals) and keeps inputs that
+ *   decode as new seeds. On a crash the input is written to
+ *   fuzz-crash.bin; pass file names to replay them.
+ * - libFuzzer (clang): compile this file with -DDEXODUS_LIBFUZZER and link
+ *   with -fsanitize=fuzzer; LLVMFuzzerTestOneInput is the entry point.
+ *   "--write-corpus=DIR" on the standalone driver dumps its seeds for it.
+ *
+ * Command line (standalone):
+ *   --runs=N           Mutated inputs to run (default 200000)
+ *   --seed=N           Mutation random seed (default 1)
+ *   --max-len=N        Largest input in bytes (default 262144)
+ *   --write-corpus=DIR Write the seed inputs to DIR and exit
+ *   FILE...            Run these inputs once each instead of fuzzing
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/SaveFormat.h"
+#include "../include/SaveLoad.h"
+#include "../include/SaveView.h"
+#include "../include/SaveJournal.h"
+#include "../include/SaveIndex.h"
+#include "../include/SaveCompress.h"
+#include "../include/SaveChecksum.h"
+#include "../include/ConfigFile.h"
+#include "../include/AutoSave.h"
+#include "../bench/Bench.h"
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+enum FuzzTarget {
+    TARGET_SAVE,
+    TARGET_JOURNAL,
+    TARGET_BLOCK,
+    TARGET_CONFIG,
+    TARGET_INDEX,
+    TARGET_COUNT
+};
+
+const char* TARGET_NAMES[TARGET_COUNT] = {"save", "journal", "block", "config", "index"};
+
+const char* WORK_DIRECTORY = "fuzz_work";
+const char* CRASH_FILE = "fuzz-crash.bin";
+const std::size_t MAX_BLOCK_OUTPUT = 1 << 20;
+
+// Base the journal target replays on (its JGEN matches the seed journals)
+std::string journalBase;
+
+void makeDirectory(const std::string& path) {
+#ifdef _WIN32
+    _mkdir(path.c_str());
+#else
+    mkdir(path.c_str(), 0755);
+#endif
+}
+
+// Plain write (writeFileAtomic would fsync every input)
+void writeFile(const std::string& path, const unsigned char* data, std::size_t size) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+}
+
+// A decoded state must survive encode + decode unchanged: encode it, decode
+// that, encode the result again and compare the two encodings byte for byte
+// (any field the reader drops or alters shows up as a difference)
+void checkRoundTrip(SaveState& state, const char* target) {
+    state.sections = SECTION_ALL;
+    std::string bytes;
+    encodeSave(state, bytes);
+
+    SaveState again;
+    if (!decodeSave(reinterpret_cast<const unsigned char*>(bytes.data()), bytes.size(), again)) {
+        std::cerr << "[Fuzz] " << target << ": encoded state does not decode" << std::endl;
+        std::abort();
+    }
+    again.sections = SECTION_ALL;
+    again.compressed = state.compressed;
+    std::string reencoded;
+    encodeSave(again, reencoded);
+    if (reencoded != bytes) {
+        std::cerr << "[Fuzz] " << target << ": decoded state does not round-trip ("
+                  << bytes.size() << " vs " << reencoded.size() << " bytes)" << std::endl;
+        std::abort();
+    }
+}
+
+/*******************************************************************************
+ * TARGETS (each returns true if the input was accepted)
+ ******************************************************************************/
+
+bool fuzzSave(const unsigned char* data, std::size_t size, unsigned int sections) {
+    SaveState info;
+    decodeSave(data, size, info, true);
+    verifySave(data, size);
+
+    SaveState state;
+    bool accepted = decodeSave(data, size, state);
+    if (accepted) checkRoundTrip(state, "save");
+
+    std::string path = std::string(WORK_DIRECTORY) + "/fuzz.dat";
+    writeFile(path, data, size);
+    SaveView view;
+    if (view.open(path)) {
+        SaveState viewInfo;
+        view.readInfo(viewInfo);
+        SaveState partial;
+        view.load(partial, sections & SECTION_ALL);
+        std::size_t length = 0;
+        view.findChunk(CHUNK_EVENTS, length);
+        view.verify();
+        SaveState whole;
+        if (view.load(whole, SECTION_ALL)) checkRoundTrip(whole, "save view");
+    }
+    return accepted;
+}
+
+bool fuzzJournal(const unsigned char* data, std::size_t size) {
+    SaveState state;
+    if (!decodeSave(reinterpret_cast<const unsigned char*>(journalBase.data()),
+                    journalBase.size(), state)) {
+        std::cerr << "[Fuzz] journal base does not decode" << std::endl;
+        std::abort();
+    }
+    int applied = replayJournal(data, size, state);
+    if (applied > 0) checkRoundTrip(state, "journal");
+    return applied >= 0;
+}
+
+bool fuzzBlock(const unsigned char* data, std::size_t size) {
+    if (size < 3) return false;
+    std::size_t outputSize = static_cast<std::size_t>(data[0] | (data[1] << 8) | (data[2] << 16));
+    if (outputSize > MAX_BLOCK_OUTPUT) outputSize %= MAX_BLOCK_OUTPUT + 1;
+    unsigned char* output = new unsigned char[outputSize + 1];
+    bool accepted = lzDecompress(data + 3, size - 3, output, outputSize);
+    delete[] output;
+    return accepted;
+}
+
+bool fuzzConfig(const unsigned char* data, std::size_t size) {
+    ConfigData config;
+    setConfigDefaults(config);
+    int rejected = parseConfig(reinterpret_cast<const char*>(data), size, config);
+
+    std::string text;
+    formatConfig(config, text);
+    ConfigData again;
+    setConfigDefaults(again);
+    if (parseConfig(text.data(), text.size(), again) != 0) {
+        std::cerr << "[Fuzz] config: formatted settings do not parse" << std::endl;
+        std::abort();
+    }
+    return rejected == 0;
+}
+
+bool fuzzIndex(const unsigned char* data, std::size_t size) {
+    std::string directory = std::string(WORK_DIRECTORY) + "/index";
+    writeFile(directory + "/saves.idx", data, size);
+    SaveIndex index;
+    index.open(directory);
+    for (int i = 0; i < index.getCount(); i++) {
+        index.find(index.getEntry(i).slot);
+    }
+    return index.getCount() > 0;
+}
+
+// Dispatch on the first byte
+bool runInput(const unsigned char* data, std::size_t size) {
+    if (size == 0) return false;
+    const unsigned char* body = data + 1;
+    std::size_t bodySize = size - 1;
+    switch (data[0] % TARGET_COUNT) {
+        case TARGET_SAVE:
+            return fuzzSave(body, bodySize, data[0] / TARGET_COUNT);
+        case TARGET_JOURNAL:
+            return fuzzJournal(body, bodySize);
+        case TARGET_BLOCK:
+            return fuzzBlock(body, bodySize);
+        case TARGET_CONFIG:
+            return fuzzConfig(body, bodySize);
+        default:
+            return fuzzIndex(body, bodySize);
+    }
+}
+
+/*******************************************************************************
+ * SEEDS
+ ******************************************************************************/
+
+// A save with the vocabulary the game writes (sectors and inventory grow with events)
+void buildState(SaveState& state, int events, bool compressed) {
+    static const char* eventTypes[] = {"COMBAT", "EXPLORE", "SYSTEM", "STORY"};
+
+    state.version = SAVE_VERSION;
+    state.sections = SECTION_ALL;
+    state.compressed = compressed;
+    state.playerName = "Fuzz Runner";
+    state.level = 7;
+    state.saveTime = 1760000000;
+    state.health = 90;
+    state.maxHealth = 120;
+    state.currentSector = "Firewall Array";
+
+    int sectors = events / 16 > 7 ? events / 16 : 7;
+    state.sectorCount = sectors;
+    state.setVisitedWordCount((sectors + 63) / 64);
+    state.visitedSectors[0] = 0x55;
+    state.setSectorEnemyCount(sectors);
+    for (int i = 0; i < state.sectorEnemyCount; i++) {
+        state.enemySectors[i] = i;
+        state.enemyTypes[i] = i % 4;
+        state.enemyHealth[i] = 20 + i % 30;
+        state.enemyNames[i] = "Sentinel Drone";
+    }
+
+    state.setInventoryCount(events / 8 + 1);
+    for (int i = 0; i < state.inventoryCount; i++) {
+        state.inventoryCodes[i] = i % 2 == 0 ? "HEAL_SMALL" : "WEAPON_BASIC";
+        state.inventoryQuantities[i] = 1 + i % 3;
+    }
+
+    state.abilityCount = 7;
+    state.skillPoints = 3;
+    state.setUnlockedWordCount(1);
+    state.unlockedAbilities[0] = 0x7;
+    state.unlockedAbilityCount = 3;
+
+    state.setPartyCount(2);
+    for (int i = 0; i < state.partyCount; i++) {
+        state.partyNames[i] = i == 0 ? "Niobe" : "Switch";
+        state.partySpecialties[i] = i;
+        state.partyLoyalty[i] = 50 + i * 10;
+        state.partyHealth[i] = 30;
+    }
+
+    int first = state.appendEvents(events);
+    for (int i = first; i < state.eventCount; i++) {
+        state.eventTypes[i] = eventTypes[i % 4];
+        state.eventTimestamps[i] = "Sat Oct 18 12:00:00 2026";
+        state.eventDescriptions[i] = "Fuzz event " + std::to_string(i);
+    }
+    state.turnCount = events * 2;
+}
+
+void addSeed(std::vector<std::string>& corpus, FuzzTarget target, const std::string& bytes) {
+    corpus.push_back(std::string(1, static_cast<char>(target)) + bytes);
+}
+
+// Step 1: Saves (raw, compressed, small and past the mapping threshold)
+// Step 2: Journal base + header + two delta records
+// Step 3: LZ block, config text, index file
+void buildSeeds(std::vector<std::string>& corpus) {
+    // Step 1
+    const int sizes[] = {0, 40, 3000};
+    for (int events : sizes) {
+        for (int compressed = 0; compressed < 2; compressed++) {
+            SaveState state;
+            buildState(state, events, compressed != 0);
+            std::string bytes;
+            encodeSave(state, bytes);
+            addSeed(corpus, TARGET_SAVE, bytes);
+        }
+    }
+
+    // Step 2
+    {
+        SaveJournal journal("fuzz");
+        SaveState state;
+        buildState(state, 40, false);
+        std::string header;
+        journal.buildBase(state, 0, journalBase, header);
+
+        std::string journalBytes = header;
+        for (int delta = 1; delta <= 2; delta++) {
+            SaveState next;
+            buildState(next, delta * 2, false);
+            next.level = state.level + delta;
+            next.health = state.health - delta * 10;
+            next.visitedSectors[0] ^= 1ULL << delta;
+            std::string record;
+            if (journal.buildDelta(next, delta, record)) journalBytes += record;
+        }
+        addSeed(corpus, TARGET_JOURNAL, journalBytes);
+        addSeed(corpus, TARGET_JOURNAL, header);
+    }
+
+    // Step 3
+    {
+        std::string raw;
+        SaveState state;
+        buildState(state, 200, false);
+        encodeSave(state, raw);
+        std::string packed(lzCompressBound(raw.size()), '\0');
+        std::size_t packedSize = lzCompress(reinterpret_cast<const unsigned char*>(raw.data()),
+                                            raw.size(),
+                                            reinterpret_cast<unsigned char*>(&packed[0]));
+        std::string block;
+        block += static_cast<char>(raw.size() & 0xFF);
+        block += static_cast<char>((raw.size() >> 8) & 0xFF);
+        block += static_cast<char>((raw.size() >> 16) & 0xFF);
+        block.append(packed.data(), packedSize);
+        addSeed(corpus, TARGET_BLOCK, block);
+    }
+    {
+        ConfigData config;
+        setConfigDefaults(config);
+        std::string text;
+        formatConfig(config, text);
+        addSeed(corpus, TARGET_CONFIG, text);
+        addSeed(corpus, TARGET_CONFIG, "; settings\nmaster_volume = 0.5 # inline\r\n"
+                                       "[Gameplay]\ndifficulty=3\nauto_save=off\n");
+    }
+    {
+        std::string directory = std::string(WORK_DIRECTORY) + "/seed";
+        makeDirectory(directory);
+        std::remove((directory + "/saves.idx").c_str());
+        SaveIndex index;
+        index.open(directory);
+        for (int slot = 0; slot < 3; slot++) {
+            SaveState state;
+            buildState(state, slot * 10, slot == 1);
+            std::string bytes;
+            encodeSave(state, bytes);
+            index.recordSave("slot" + std::to_string(slot), state, bytes);
+        }
+        index.flush();
+        std::string bytes;
+        if (readFileBytes(directory + "/saves.idx", bytes)) {
+            addSeed(corpus, TARGET_INDEX, bytes);
+        }
+    }
+}
+
+/*******************************************************************************
+ * MUTATION
+ ******************************************************************************/
+
+class Mutator {
+private:
+    uint64_t rng;
+
+public:
+    explicit Mutator(uint64_t seed) : rng(seed * 0x9E3779B97F4A7C15ULL + 1) {}
+
+    // xorshift64*
+    uint64_t next() {
+        rng ^= rng >> 12;
+        rng ^= rng << 25;
+        rng ^= rng >> 27;
+        return rng * 0x2545F4914F6CDD1DULL;
+    }
+
+    std::size_t below(std::size_t range) {
+        return range == 0 ? 0 : static_cast<std::size_t>(next() % range);
+    }
+
+    // 1-4 edits of the file; byte 0 keeps its target (its high part is the
+    // save target's section mask, rerolled now and then)
+    void mutate(std::string& input, const std::vector<std::string>& pool,
+                std::size_t maxLength) {
+        static const unsigned char boundary[] = {0x00, 0x01, 0x7F, 0x80, 0xFF};
+        if (below(16) == 0) {
+            int target = static_cast<unsigned char>(input[0]) % TARGET_COUNT;
+            input[0] = static_cast<char>(target + TARGET_COUNT * below(255 / TARGET_COUNT));
+        }
+        int edits = 1 + static_cast<int>(below(4));
+        for (int e = 0; e < edits; e++) {
+            std::size_t size = input.size();
+            std::size_t at = 1 + below(size > 1 ? size - 1 : 1);
+            switch (below(8)) {
+                case 0:     // Flip one bit
+                    if (size > 1 && at < size) input[at] ^= static_cast<char>(1 << below(8));
+                    break;
+                case 1:     // Boundary byte
+                    if (size > 1 && at < size) input[at] = static_cast<char>(boundary[below(5)]);
+                    break;
+                case 2:     // Huge varint (length / count fields)
+                    if (at < size) {
+                        std::size_t count = 1 + below(9);
+                        for (std::size_t k = 0; k < count && at + k < size; k++) {
+                            input[at + k] = static_cast<char>(0xFF);
+                        }
+                    }
+                    break;
+                case 3: {   // Insert random bytes
+                    std::size_t count = 1 + below(16);
+                    std::string bytes;
+                    for (std::size_t k = 0; k < count; k++) bytes += static_cast<char>(next());
+                    input.insert(at < size ? at : size, bytes);
+                    break;
+                }
+                case 4:     // Erase a range
+                    if (at < size) input.erase(at, 1 + below(size - at));
+                    break;
+                case 5:     // Truncate
+                    if (size > 1) input.resize(1 + below(size - 1));
+                    break;
+                case 6:     // Copy a range elsewhere (duplicated chunks)
+                    if (size > 2 && at < size) {
+                        std::size_t length = 1 + below(size - at < 64 ? size - at : 64);
+                        std::string range = input.substr(at, length);
+                        input.insert(1 + below(size - 1), range);
+                    }
+                    break;
+                default: {  // Splice the tail of another input of the same target
+                    const std::string& other = pool[below(pool.size())];
+                    if (other.size() < 2) break;
+                    std::size_t from = 1 + below(other.size() - 1);
+                    input.resize(at < size ? at : size);
+                    input.append(other, from, std::string::npos);
+                    break;
+                }
+            }
+        }
+        if (input.size() > maxLength) input.resize(maxLength);
+    }
+};
+
+// Helper: Varint at bytes[at], at moves past it (false if it runs past end)
+bool readVarint(const std::string& bytes, std::size_t& at, std::size_t end,
+                unsigned long long& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && at < end; shift += 7) {
+        unsigned char byte = static_cast<unsigned char>(bytes[at++]);
+        value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+// Recompute the CRC trailer of each chunk in [at, end) (stops at bad framing)
+void resealChunks(std::string& bytes, std::size_t at, std::size_t end) {
+    while (end - at >= 4) {
+        std::size_t start = at;
+        at += 4;
+        unsigned long long length = 0;
+        if (!readVarint(bytes, at, end, length) || length > end - at ||
+            end - at - length < CHUNK_CHECKSUM_SIZE) {
+            return;
+        }
+        at += static_cast<std::size_t>(length);
+        unsigned int crc = crc32c(0, bytes.data() + start, at - start);
+        for (std::size_t i = 0; i < CHUNK_CHECKSUM_SIZE; i++) {
+            bytes[at + i] = static_cast<char>((crc >> (8 * i)) & 0xFF);
+        }
+        at += CHUNK_CHECKSUM_SIZE;
+    }
+}
+
+// Make the top-level chunks of a mutated save / journal / index pass their CRCs
+void reseal(std::string& input) {
+    const std::size_t MAGIC_SIZE = 4;
+    std::size_t at = 1 + MAGIC_SIZE;
+    std::size_t end = input.size();
+    unsigned long long value = 0;
+    if (end < at) return;
+
+    switch (static_cast<unsigned char>(input[0]) % TARGET_COUNT) {
+        case TARGET_SAVE:
+            if (readVarint(input, at, end, value)) resealChunks(input, at, end);
+            break;
+        case TARGET_JOURNAL:
+            if (!readVarint(input, at, end, value)) break;
+            while (at < end && readVarint(input, at, end, value) && value <= end - at) {
+                resealChunks(input, at, at + static_cast<std::size_t>(value));
+                at += static_cast<std::size_t>(value);
+            }
+            break;
+        case TARGET_INDEX:
+            resealChunks(input, at, end);
+            break;
+        default:
+            break;
+    }
+}
+
+/*******************************************************************************
+ * CRASH CAPTURE
+ ******************************************************************************/
+
+const unsigned char* currentInput = nullptr;
+std::size_t currentSize = 0;
+
+// Save the input being run, then die with the original signal
+void onCrash(int signal) {
+    if (currentInput != nullptr) {
+#ifdef _WIN32
+        FILE* file = std::fopen(CRASH_FILE, "wb");
+        if (file != nullptr) {
+            std::fwrite(currentInput, 1, currentSize, file);
+            std::fclose(file);
+        }
+#else
+        int file = ::open(CRASH_FILE, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (file >= 0) {
+            ssize_t written = ::write(file, currentInput, currentSize);
+            (void)written;
+            ::close(file);
+        }
+#endif
+        const char message[] = "\n[Fuzz] Crashing input written to fuzz-crash.bin\n";
+        std::fwrite(message, 1, sizeof(message) - 1, stderr);
+    }
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+void setUp() {
+    makeDirectory(WORK_DIRECTORY);
+    makeDirectory(std::string(WORK_DIRECTORY) + "/index");
+}
+
+} // namespace
+
+/*******************************************************************************
+ * ENTRY POINTS
+ ******************************************************************************/
+
+#ifdef DEXODUS_LIBFUZZER
+
+extern "C" int LLVMFuzzerInitialize(int*, char***) {
+    static bench::NullBuffer nullBuffer;
+    std::cout.rdbuf(&nullBuffer);
+    setUp();
+    std::vector<std::string> corpus;
+    buildSeeds(corpus);
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    runInput(data, size);
+    return 0;
+}
+
+#else
+
+int main(int argc, char** argv) {
+    uint64_t runs = 200000;
+    uint64_t seed = 1;
+    std::size_t maxLength = 262144;
+    std::string corpusPath;
+    std::vector<std::string> replay;
+
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option.rfind("--runs=", 0) == 0) {
+            runs = std::strtoull(option.c_str() + 7, nullptr, 10);
+        } else if (option.rfind("--seed=", 0) == 0) {
+            seed = std::strtoull(option.c_str() + 7, nullptr, 10);
+        } else if (option.rfind("--max-len=", 0) == 0) {
+            maxLength = static_cast<std::size_t>(std::strtoull(option.c_str() + 10, nullptr, 10));
+        } else if (option.rfind("--write-corpus=", 0) == 0) {
+            corpusPath = option.substr(15);
+        } else if (option.rfind("--", 0) == 0) {
+            std::cerr << "Usage: " << argv[0] << " [--runs=N] [--seed=N] [--max-len=N]"
+                      << " [--write-corpus=DIR] [FILE...]" << std::endl;
+            return 1;
+        } else {
+            replay.push_back(option);
+        }
+    }
+    if (maxLength < 2) maxLength = 2;
+
+    bench::NullBuffer nullBuffer;
+    std::ostream report(std::cout.rdbuf());
+    std::streambuf* original = std::cout.rdbuf(&nullBuffer);
+
+    setUp();
+    std::vector<std::string> corpus;
+    buildSeeds(corpus);
+
+    // Seeds for a libFuzzer run
+    if (!corpusPath.empty()) {
+        makeDirectory(corpusPath);
+        for (std::size_t i = 0; i < corpus.size(); i++) {
+            writeFile(corpusPath + "/seed" + std::to_string(i),
+                      reinterpret_cast<const unsigned char*>(corpus[i].data()), corpus[i].size());
+        }
+        std::cout.rdbuf(original);
+        report << "[Fuzz] " << corpus.size() << " seeds written to " << corpusPath << std::endl;
+        return 0;
+    }
+
+    std::signal(SIGSEGV, onCrash);
+    std::signal(SIGABRT, onCrash);
+    std::signal(SIGFPE, onCrash);
+    std::signal(SIGILL, onCrash);
+
+    // Replay given inputs
+    if (!replay.empty()) {
+        for (const std::string& path : replay) {
+            std::string bytes;
+            if (!readFileBytes(path, bytes)) {
+                report << "[Fuzz] Cannot read " << path << std::endl;
+                continue;
+            }
+            currentInput = reinterpret_cast<const unsigned char*>(bytes.data());
+            currentSize = bytes.size();
+            bool accepted = runInput(currentInput, currentSize);
+            report << "[Fuzz] " << path << ": " << (accepted ? "accepted" : "rejected")
+                   << ", no crash" << std::endl;
+        }
+        std::cout.rdbuf(original);
+        return 0;
+    }
+
+    // Every seed must decode before any mutation is worth running
+    for (const std::string& input : corpus) {
+        currentInput = reinterpret_cast<const unsigned char*>(input.data());
+        currentSize = input.size();
+        if (!runInput(currentInput, currentSize)) {
+            std::cout.rdbuf(original);
+            report << "[Fuzz] Seed for target '"
+                   << TARGET_NAMES[static_cast<unsigned char>(input[0]) % TARGET_COUNT]
+                   << "' is rejected by its reader" << std::endl;
+            return 1;
+        }
+    }
+
+    report << "\n=== LOAD PATH FUZZ (seed " << seed << ", " << runs << " runs, "
+           << corpus.size() << " seeds) ===" << std::endl;
+
+    // One pool per target, so cheap targets cannot crowd out the save reader
+    const std::size_t MAX_POOL = 128;
+    std::vector<std::string> pools[TARGET_COUNT];
+    for (const std::string& input : corpus) {
+        pools[static_cast<unsigned char>(input[0]) % TARGET_COUNT].push_back(input);
+    }
+
+    Mutator mutator(seed);
+    uint64_t runsPerTarget[TARGET_COUNT] = {};
+    uint64_t acceptedPerTarget[TARGET_COUNT] = {};
+    int64_t start = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    std::string input;
+    for (uint64_t run = 1; run <= runs; run++) {
+        int target = static_cast<int>(run % TARGET_COUNT);
+        std::vector<std::string>& pool = pools[target];
+        input = pool[mutator.below(pool.size())];
+        mutator.mutate(input, pool, maxLength);
+        if (mutator.below(2) == 0) reseal(input);
+
+        currentInput = reinterpret_cast<const unsigned char*>(input.data());
+        currentSize = input.size();
+        bool accepted = runInput(currentInput, currentSize);
+        runsPerTarget[target]++;
+
+        // Mutants that still decode reach deeper states: keep some of them
+        if (accepted) {
+            acceptedPerTarget[target]++;
+            if (pool.size() < MAX_POOL) {
+                pool.push_back(input);
+            } else if (mutator.below(8) == 0) {
+                pool[mutator.below(pool.size())] = input;
+            }
+        }
+
+        if ((run & 16383) == 0 || run == runs) {
+            int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+            double seconds = (now - start) / 1000.0;
+            std::size_t kept = 0;
+            for (int t = 0; t < TARGET_COUNT; t++) kept += pools[t].size();
+            report << "[Fuzz] " << run << " runs, "
+                   << static_cast<uint64_t>(seconds > 0.0 ? run / seconds : 0.0)
+                   << " exec/s, corpus " << kept << std::endl;
+        }
+    }
+    currentInput = nullptr;
+    std::cout.rdbuf(original);
+
+    report << "Target     Runs   Accepted" << std::endl;
+    for (int t = 0; t < TARGET_COUNT; t++) {
+        char line[64];
+        snprintf(line, sizeof(line), "%-8s %6llu %10llu", TARGET_NAMES[t],
+                 static_cast<unsigned long long>(runsPerTarget[t]),
+                 static_cast<unsigned long long>(acceptedPerTarget[t]));
+        report << line << std::endl;
+    }
+    report << "[Fuzz] No crashes." << std::endl;
+    return 0;
+}
+
+#endif
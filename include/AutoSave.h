@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * AutoSave.h - Background Save Writer and Durable File Helpers
+ *
+ * CONCEPT: Producer / consumer over a FIFO job queue
+ *
+ * The game thread captures and encodes a save (or a journal record) and
+ * hands the finished buffer to the writer thread, which does all the disk
+ * work, in submission order:
+ *
+ *   game thread:   capture -> encode -> submit...()   (swap into a job)
+ *   writer thread: take job -> writeFileAtomic() / appendFileDurable() /
+ *                  compactJournal()
+ *
+ * Jobs coalesce at the tail of the queue: a whole-file write replaces a
+ * queued write of the same file, and appends to the same file are
+ * concatenated, so a slow disk never builds a long queue.
+ *
+ * writeFileAtomic() writes "<path>.tmp", flushes it to disk and renames it
+ * over the target, so a crash mid-write leaves the previous save intact.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef AUTOSAVE_H
+#define AUTOSAVE_H
+
+#include <string>
+#include <cstddef>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Write bytes to a temp file, fsync it, then rename it over path
+bool writeFileAtomic(const std::string& path, const char* data, std::size_t size);
+
+// Append bytes to path (created if missing) and fsync before returning
+bool appendFileDurable(const std::string& path, const char* data, std::size_t size);
+
+// Whole file into memory (false if it cannot be opened)
+bool readFileBytes(const std::string& path, std::string& bytes);
+
+/*******************************************************************************
+ * AutoSaveWriter - Owns the writer thread
+ ******************************************************************************/
+class AutoSaveWriter {
+private:
+    enum class JobType {
+        WRITE,                  // Replace path with bytes (atomic)
+        APPEND,                 // Append bytes to path (journal record)
+        COMPACT                 // Fold journalPath into path (new generation)
+    };
+
+    struct Job {
+        JobType type;
+        std::string path;
+        std::string journalPath;
+        std::string bytes;
+        unsigned long long generation;
+        Job* next;
+    };
+
+    std::thread worker;
+    mutable std::mutex lock;
+    std::condition_variable wake;   // Job submitted or stopping
+    std::condition_variable idle;   // Job finished
+
+    // Job queue (guarded by lock)
+    Job* head;
+    Job* tail;
+    bool writing;
+    bool stopping;
+
+    // Statistics (guarded by lock)
+    int writtenCount;
+    int failedCount;
+    int replacedCount;              // Snapshots superseded before being written
+
+    // Helper: Queue a job (caller holds lock)
+    void push(Job* job);
+
+    // Writer thread body
+    void run();
+
+public:
+    // Constructor starts the writer thread
+    AutoSaveWriter();
+
+    // Destructor writes any pending jobs, then joins the thread
+    ~AutoSaveWriter();
+
+    // Prevent copying (owns a thread)
+    AutoSaveWriter(const AutoSaveWriter&) = delete;
+    AutoSaveWriter& operator=(const AutoSaveWriter&) = delete;
+
+    // Hand a finished save to the writer; bytes is swapped out (left empty)
+    void submit(const std::string& path, std::string& bytes);
+
+    // Append a journal record; bytes is swapped out (left empty)
+    void submitAppend(const std::string& path, std::string& bytes);
+
+    // Compact a base save and its journal into a new base of generation
+    void submitCompact(const std::string& path, const std::string& journalPath,
+                       unsigned long long generation);
+
+    // Block until the queue is empty and nothing is being written
+    void flush();
+
+    // Statistics
+    int getWrittenCount() const;
+    int getFailedCount() const;
+    int getReplacedCount() const;
+};
+
+#endif // AUTOSAVE_H
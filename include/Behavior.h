@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Behavior.h - Sentinel Behavior Trees
+ *
+ * CONCEPT: TREE stored as a flat, pre-order node array
+ *
+ * Each Sentinel::Type has one behavior definition, compiled once into a
+ * contiguous array and shared by every sentinel of that type:
+ *
+ *   Selector                     [0] SELECTOR  children 3  size 8
+ *   |-- Sequence                 [1] SEQUENCE  children 2  size 3
+ *   |   |-- SelfHealthBelow(40)  [2] CONDITION
+ *   |   +-- Repair               [3] ACTION
+ *   |-- Sequence                 [4] SEQUENCE  children 2  size 3
+ *   |   |-- AggressionRoll       [5] CONDITION
+ *   |   +-- Attack               [6] ACTION
+ *   +-- Analyze                  [7] ACTION
+ *
+ * A node's first child is the next element, and each sibling starts
+ * `size` elements after the previous one. No child pointers are needed.
+ * Evaluating a tree walks the array and allocates nothing. The only
+ * per-entity state is an 8-byte SentinelBlackboard.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef BEHAVIOR_H
+#define BEHAVIOR_H
+
+/*******************************************************************************
+ * Sentinel Action - What a behavior tree decides to do this turn
+ ******************************************************************************/
+enum class SentinelAction : unsigned char {
+    ATTACK,         // Standard strike
+    HEAVY_ATTACK,   // Strike with aggression-based bonus damage
+    REPAIR,         // Restore some integrity (has a cooldown)
+    ANALYZE         // Study the target; enables follow-up branches
+};
+
+/*******************************************************************************
+ * Sentinel Blackboard - Per-entity memory between ticks
+ ******************************************************************************/
+struct SentinelBlackboard {
+    int targetSlot;                 // EntityStore slot of the target (-1 = none)
+    unsigned char turnsInCombat;    // Ticks since engage (saturates at 255)
+    unsigned char repairCooldown;   // Ticks until REPAIR is allowed again
+    unsigned char analyzed;         // 1 = last action was ANALYZE
+    SentinelAction planned;         // Result of the last tick
+
+    SentinelBlackboard();
+    void engage(int targetSlot);    // Clear memory for a new encounter
+};
+
+/*******************************************************************************
+ * Behavior Context - Numbers the conditions look at (read from EntityStore)
+ ******************************************************************************/
+struct BehaviorContext {
+    int health;
+    int maxHealth;
+    int targetHealth;               // Full health assumed when there is no target
+    int targetMaxHealth;
+    int aggression;                 // 1-10
+};
+
+/*******************************************************************************
+ * Behavior Node - One element of the compiled array
+ ******************************************************************************/
+enum class BehaviorNodeType : unsigned char {
+    SELECTOR,       // First child that succeeds
+    SEQUENCE,       // All children must succeed
+    CONDITION,      // Leaf: test the context / blackboard
+    ACTION          // Leaf: choose an action (always succeeds)
+};
+
+enum class BehaviorCondition : unsigned char {
+    SELF_HEALTH_BELOW,      // health * 100 < maxHealth * param
+    TARGET_HEALTH_BELOW,    // same for the target
+    AGGRESSION_ROLL,        // rand() % 10 < aggression
+    ANALYZED,               // blackboard.analyzed
+    REPAIR_READY            // blackboard.repairCooldown == 0
+};
+
+struct BehaviorNode {
+    BehaviorNodeType type;
+    unsigned char op;       // BehaviorCondition or SentinelAction
+    short param;            // Condition parameter (percent)
+    short childCount;       // Composites only
+    short size;             // Nodes in this subtree, including itself
+};
+
+/*******************************************************************************
+ * BehaviorTree - One compiled behavior definition
+ *
+ * Built in pre-order with beginSelector()/beginSequence() ... end().
+ * Composites can nest up to MAX_DEPTH deep.
+ ******************************************************************************/
+class BehaviorTree {
+private:
+    static const int MAX_DEPTH = 8;
+
+    BehaviorNode* nodes;
+    int nodeCount;
+    int capacity;
+
+    int openNodes[MAX_DEPTH];       // Composites still being built
+    int openCount;
+
+    // Helpers
+    int append(BehaviorNodeType type, unsigned char op, short param);
+    bool tick(int index, const BehaviorContext& context,
+              const SentinelBlackboard& blackboard, SentinelAction& chosen) const;
+
+public:
+    BehaviorTree();
+    ~BehaviorTree();
+
+    // Prevent copying
+    BehaviorTree(const BehaviorTree&) = delete;
+    BehaviorTree& operator=(const BehaviorTree&) = delete;
+
+    // Building
+    void beginSelector();
+    void beginSequence();
+    void end();
+    void condition(BehaviorCondition condition, int param = 0);
+    void action(SentinelAction action);
+
+    // Evaluation: pick an action and update the blackboard
+    // Step 1: Walk the array from the root
+    // Step 2: Fall back to ANALYZE if no branch succeeds
+    // Step 3: Record the choice, advance cooldowns
+    SentinelAction evaluate(const BehaviorContext& context,
+                            SentinelBlackboard& blackboard) const;
+
+    int getNodeCount() const;
+};
+
+/*******************************************************************************
+ * BehaviorLibrary - Singleton holding one compiled tree per Sentinel::Type
+ *
+ * Indexed by static_cast<int>(Sentinel::Type); trees are compiled on first
+ * access and never change afterwards.
+ ******************************************************************************/
+class BehaviorLibrary {
+private:
+    static const int TYPE_COUNT = 4;    // SCOUT, GUARDIAN, ENFORCER, ELITE
+
+    BehaviorTree trees[TYPE_COUNT];
+
+    // Private constructor (Singleton) - compiles every definition
+    BehaviorLibrary();
+
+public:
+    static const int REPAIR_COOLDOWN = 3;
+
+    static BehaviorLibrary& getInstance();
+
+    // Prevent copying
+    BehaviorLibrary(const BehaviorLibrary&) = delete;
+    BehaviorLibrary& operator=(const BehaviorLibrary&) = delete;
+
+    const BehaviorTree& get(int type) const;
+};
+
+#endif // BEHAVIOR_H
@@ -0,0 +1,45 @@
+/*******************************************************************************
+ * ConfigFile.h - Table-Driven INI Parser for config.ini
+ *
+ * CONCEPT: One schema table, read and written in a single pass
+ *
+ * Every ConfigData field has one row in the schema table:
+ *
+ *   section | key | type (float / int / bool) | member | range
+ *
+ * parseConfig() walks the text once: "[Section]" lines switch the section,
+ * "key = value" lines are looked up in the table and converted with
+ * std::from_chars (no exceptions, no locale), ';' and '#' start comments.
+ * Keys before any section header match by name alone, so flat files from
+ * older builds still load. A bad line is reported with its line number
+ * and the field keeps its previous value.
+ *
+ * formatConfig() writes the same table back, so a field added to the
+ * table is loaded, saved and defaulted without touching anything else.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef CONFIGFILE_H
+#define CONFIGFILE_H
+
+#include <string>
+#include <cstddef>
+
+struct ConfigData;
+
+// Defaults for every field (what a missing file or key means)
+void setConfigDefaults(ConfigData& config);
+
+// PARSE: Apply the text's settings on top of config
+// Step 1: Split off the next line, strip comments and whitespace
+// Step 2: Section header, or key = value looked up in the table
+// Step 3: Convert and range-check the value, store it in its member
+// Returns the number of lines that were rejected (each one is logged)
+int parseConfig(const char* text, std::size_t size, ConfigData& config);
+
+// INI text holding every field, grouped by section
+void formatConfig(const ConfigData& config, std::string& out);
+
+#endif // CONFIGFILE_H
@@ -17,6 +17,10 @@
 
 #include <string>
 #include <iostream>
+#include <variant>
+
+#include "EntityStore.h"
+#include "Behavior.h"
 
 // Forward declarations
 class Inventory;
@@ -28,22 +32,38 @@ class AbilityTree;
  * The Entity class serves as the root of our inheritance hierarchy.
  * All game characters (Player, Sentinel, Awakened) inherit from this class.
  * This demonstrates the IS-A relationship in OOP.
+ *
+ * Stats (health, attack, defense, speed, alive) live in the EntityStore
+ * arrays; an Entity is a handle to its slot there plus its name and
+ * behaviour. Copying would make two handles own one slot, so it is
+ * disabled.
+ *
+ * The name is either owned (ownName) or shared from a table that outlives
+ * every entity (spawned Sentinels point into the designation table), so
+ * spawning does not copy a heap-allocated string per entity.
  ******************************************************************************/
 class Entity {
 protected:
-    std::string name;           // Entity's identifier
-    int maxHealth;              // Maximum health points
-    int health;                 // Current health points
-    int attackPower;            // Base attack damage
-    int defense;                // Damage reduction
-    int speed;                  // Turn order priority
-    bool alive;                 // Living status
+    const std::string* name;    // Entity's identifier (ownName or a shared entry)
+    std::string ownName;        // Storage for names that are not shared
+    int slot;                   // Index of this entity's stats in EntityStore
+
+    // Constructor for a shared name (must outlive the entity)
+    Entity(const std::string* sharedName, EntityKind kind, int maxHealth, int attack,
+           int defense, int speed);
+
+    // Helper for derived constructors: replace the base stats (full health)
+    void setBaseStats(int maxHealth, int attack, int defense, int speed);
 
 public:
     // Constructor and Virtual Destructor
-    Entity(const std::string& name, int maxHealth, int attack, int defense, int speed);
+    Entity(const std::string& name, EntityKind kind, int maxHealth, int attack, int defense, int speed);
     virtual ~Entity();
 
+    // Prevent copying (one slot per entity)
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete;
+
     // CONCEPT 2: POLYMORPHISM - Pure Virtual Function
     // Each derived class MUST implement this differently
     // This enables runtime polymorphism when iterating over Entity pointers
@@ -65,10 +85,18 @@ public:
     int getAttackPower() const;
     int getDefense() const;
     int getSpeed() const;
+    int getSlot() const;
+    EntityKind getKind() const;
+    EntityFaction getFaction() const;
 
     // Setters
+    void setName(const std::string& newName);      // Always owned afterwards
     void setHealth(int hp);
+    void setMaxHealth(int hp);      // Clamps current health to the new max
     void setAttackPower(int power);
+    void setDefense(int value);
+    void setSpeed(int value);
+    void setFaction(EntityFaction faction);
 };
 
 /*******************************************************************************
@@ -77,7 +105,7 @@ public:
  * Demonstrates INHERITANCE: Player IS-A Entity
  * Demonstrates POLYMORPHISM: Overrides performAction() with player-specific behavior
  ******************************************************************************/
-class Player : public Entity {
+class Player final : public Entity {
 private:
     int experience;             // Experience points
     int level;                  // Current level
@@ -123,7 +151,7 @@ public:
  * Sentinels are enemy AI entities that hunt the player.
  * Demonstrates INHERITANCE and POLYMORPHISM with AI-driven behavior.
  ******************************************************************************/
-class Sentinel : public Entity {
+class Sentinel final : public Entity {
 public:
     // Sentinel types with different behaviors
     enum class Type {
@@ -137,16 +165,18 @@ private:
     Type type;                  // Sentinel classification
     int aggressionLevel;        // AI aggression (1-10)
     bool isPatrolling;          // Current state
+    SentinelBlackboard blackboard;  // Behavior tree memory
 
 public:
     // Constructor
     Sentinel(const std::string& name, Type type);
+    Sentinel(const std::string* sharedName, Type type);     // Name from the designation table
 
     // Destructor
     ~Sentinel() override;
 
     // POLYMORPHISM: Sentinel AI action implementation
-    // Executes AI-driven combat behavior
+    // Ticks the shared behavior tree for this type and announces the plan
     void performAction() override;
 
     // Override display for sentinel-specific info
@@ -155,6 +185,10 @@ public:
     // AI behavior methods
     void patrol();
     int calculateDamage() const;
+    void engage(const Entity* target);      // Reset blackboard, set target
+    void retarget(const Entity* target);    // Switch target, keep memory
+    int getTargetSlot() const;
+    SentinelAction getPlannedAction() const;
 
     // Getters
     Type getType() const;
@@ -163,6 +197,19 @@ public:
 
     // Static factory method to create random sentinels
     static Sentinel* createRandom(int difficulty);
+
+    // Spawn a wave of count sentinels into out[]; pool memory for the
+    // whole wave is reserved up front. Returns the number created.
+    static int createRandomBatch(int difficulty, int count, Sentinel** out);
+
+    // Storage comes from SentinelPool (see SentinelPool.h)
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block);
+
+private:
+    void applyTypeStats();
+    static Type rollType(int difficulty);
+    static const std::string* pickName();   // Entry of the prebuilt designation table
 };
 
 /*******************************************************************************
@@ -171,7 +218,7 @@ public:
  * Awakened are NPC allies that can join and assist the player.
  * Demonstrates INHERITANCE and POLYMORPHISM with support behavior.
  ******************************************************************************/
-class Awakened : public Entity {
+class Awakened final : public Entity {
 public:
     // Awakened specialties
     enum class Specialty {
@@ -203,6 +250,7 @@ public:
     void join();
     void assist(Entity* target);
     void increaseLoyalty(int amount);
+    void setLoyalty(int value);     // Restore a saved value (clamped to 0-100)
 
     // Getters
     Specialty getSpecialty() const;
@@ -211,4 +259,17 @@ public:
     std::string getSpecialtyString() const;
 };
 
+/*******************************************************************************
+ * Combatant - Compile-time dispatch over the closed set of entity types
+ *
+ * Player, Sentinel and Awakened are final, so a call made through one of
+ * these pointers binds directly (no vtable lookup). toCombatant() picks
+ * the alternative from the kind tag in EntityStore - no RTTI needed:
+ *
+ *   std::visit([](auto* who) { who->performAction(); }, toCombatant(e));
+ ******************************************************************************/
+typedef std::variant<Player*, Sentinel*, Awakened*> Combatant;
+
+Combatant toCombatant(Entity* entity);
+
 #endif // ENTITY_H
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * EntityStore.h - Contiguous Component Storage for Entities
+ *
+ * CONCEPT: Structure of Arrays (data-oriented storage)
+ *
+ * Combat only ever touches a handful of numbers per combatant, yet every
+ * Entity used to be a separate heap object reached through Entity**.
+ * The store keeps those numbers in parallel arrays indexed by a slot:
+ *
+ *   slot:      0     1     2     3
+ *   health:  [100] [ 30] [ 60] [ 50]
+ *   attack:  [ 15] [  8] [ 12] [ 18]
+ *   alive:   [  1] [  1] [  0] [  1]
+ *   kind:    [ P ] [ S ] [ S ] [ A ]
+ *   faction: [ P ] [ H ] [ H ] [ A ]
+ *
+ * Entity objects keep their name and behaviour and hold just the slot, so
+ * the class API is unchanged while victory checks and round re-queues are
+ * linear sweeps over a few int arrays.
+ *
+ * applyDamage() resolves one hit against a whole batch of slots at once
+ * (mitigation, minimum damage, clamping, death flag), four lanes at a
+ * time with SSE2 when available and a scalar loop otherwise.
+ *
+ * Slots freed by destroyed entities go on a free list and are reused.
+ * References returned by the accessors are invalidated by create().
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef ENTITYSTORE_H
+#define ENTITYSTORE_H
+
+/*******************************************************************************
+ * Entity Kind - Type tag stored per slot
+ ******************************************************************************/
+enum class EntityKind : unsigned char {
+    PLAYER,
+    SENTINEL,
+    AWAKENED
+};
+
+/*******************************************************************************
+ * Entity Faction - Which side an entity fights on
+ *
+ * Defaults from the kind (Player / Sentinel = hostile / Awakened = ally)
+ * but is stored separately so it can change without changing type.
+ ******************************************************************************/
+enum class EntityFaction : unsigned char {
+    PLAYER,
+    HOSTILE,
+    ALLY
+};
+
+/*******************************************************************************
+ * EntityStore - Singleton holding all entity stats
+ ******************************************************************************/
+class EntityStore {
+private:
+    int* healthData;            // Current health
+    int* maxHealthData;         // Maximum health
+    int* attackData;            // Attack power
+    int* defenseData;           // Damage reduction
+    int* speedData;             // Turn order priority
+    unsigned char* aliveData;   // 1 = alive
+    EntityKind* kindData;       // Type tag
+    EntityFaction* factionData; // Combat side
+
+    int* nextFree;              // Free list links (-1 = end)
+    int freeHead;               // First free slot (-1 = none)
+    int capacity;               // Allocated slots
+    int used;                   // Slots ever handed out (high-water mark)
+    int liveCount;              // Slots currently owned by an entity
+
+    // Private constructor (Singleton)
+    EntityStore();
+
+    // Helper: Double every array
+    void grow();
+
+public:
+    // Singleton access
+    static EntityStore& getInstance();
+
+    ~EntityStore();
+
+    // Prevent copying
+    EntityStore(const EntityStore&) = delete;
+    EntityStore& operator=(const EntityStore&) = delete;
+
+    // Slot lifetime
+    // Step 1: Reuse a free slot, or take the next one (growing if full)
+    // Step 2: Write the starting stats, mark alive, default faction from kind
+    int create(EntityKind kind, int maxHealth, int attack, int defense, int speed);
+    void destroy(int slot);
+
+    // Component access
+    int& health(int slot) { return healthData[slot]; }
+    int& maxHealth(int slot) { return maxHealthData[slot]; }
+    int& attack(int slot) { return attackData[slot]; }
+    int& defense(int slot) { return defenseData[slot]; }
+    int& speed(int slot) { return speedData[slot]; }
+    unsigned char& alive(int slot) { return aliveData[slot]; }
+
+    int health(int slot) const { return healthData[slot]; }
+    int maxHealth(int slot) const { return maxHealthData[slot]; }
+    int attack(int slot) const { return attackData[slot]; }
+    int defense(int slot) const { return defenseData[slot]; }
+    int speed(int slot) const { return speedData[slot]; }
+    bool isAlive(int slot) const { return aliveData[slot] != 0 && healthData[slot] > 0; }
+    EntityKind kind(int slot) const { return kindData[slot]; }
+    EntityFaction faction(int slot) const { return factionData[slot]; }
+    void setFaction(int slot, EntityFaction faction) { factionData[slot] = faction; }
+
+    // Linear sweeps over a list of slots
+    bool anyAlive(const int* slots, int count) const;
+    int countAlive(const int* slots, int count) const;
+
+    // Batch damage: amounts[i] hits slots[i] after defense / 2 mitigation
+    // (minimum 1), health clamps at 0 and the slot is marked dead.
+    // Slots already down are skipped. Health actually lost goes to
+    // dealt[i]; returns how many fell in this batch.
+    // Slots in one batch must be distinct.
+    int applyDamage(const int* slots, const int* amounts, int count, int* dealt);
+
+    // Statistics
+    int getLiveCount() const;
+    int getCapacity() const;
+};
+
+#endif // ENTITYSTORE_H
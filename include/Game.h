@@ -21,6 +21,7 @@
 #include <ctime>
 
 #include "Entity.h"
+#include "Support.h"
 #include "HashTable.h"
 #include "LinkedList.h"
 #include "Stack.h"
@@ -29,6 +30,10 @@
 #include "Iterator.h"
 #include "Observer.h"
 
+// Forward declarations
+struct SessionStats;
+struct ConfigData;
+
 /*******************************************************************************
  * Game State Enumeration
  ******************************************************************************/
@@ -46,17 +51,28 @@ enum class GameState {
     OPTIONS,
     GAME_OVER,
     VICTORY,
-    QUIT
+    UNLOCK_ABILITY,
+    COMBAT_ABILITY,             // Picking which ability to use in combat
+    QUIT,
+    STATE_COUNT                 // Number of states (size of transition table)
 };
 
 /*******************************************************************************
  * Combat System
  *
  * Manages turn-based combat using Queue for turn order.
+ *
+ * Combatants are also listed by EntityStore slot (player, then enemies,
+ * then allies), so victory checks and the per-round re-queue sweep the
+ * store's arrays instead of dereferencing every Entity.
+ *
+ * Sentinels lock onto a random member of the player's side (the player or
+ * an Awakened ally) and pick a new one when their target falls.
  ******************************************************************************/
 class CombatSystem {
 private:
     CombatQueue* turnQueue;     // Queue managing turn order
+    SupportEngine* support;     // Batched ally heals / buffs
     Player* player;
     Entity** enemies;
     int enemyCount;
@@ -64,6 +80,23 @@ private:
     int allyCount;
     bool inCombat;
     int roundNumber;
+    Entity* currentTurn;        // Entity whose turn processTurn last started
+
+    Entity** combatants;        // Player, enemies, allies
+    int* combatSlots;           // Store slot of each combatant (same order)
+    int combatantCount;
+
+    // Scratch for playerUseAbility (hits resolved ABILITY_BATCH at a time)
+    static const int ABILITY_BATCH = 16;
+    Entity* batchTargets[ABILITY_BATCH];
+    int batchSlots[ABILITY_BATCH];
+    int batchAmounts[ABILITY_BATCH];
+    int batchDealt[ABILITY_BATCH];
+
+    void releaseCombatants();
+    void resolveAbilityBatch(int count);
+    Entity* pickEnemyTarget() const;
+    Entity* enemyTarget(Entity* enemy) const;
 
 public:
     CombatSystem();
@@ -80,18 +113,19 @@ public:
     // Player actions
     void playerAttack(Entity* target);
     void playerDefend();
-    void playerUseAbility(const std::string& abilityCode, Entity* target);
+    void playerUseAbility(const Ability& ability, Entity* target);
     void playerUseItem(const std::string& itemCode);
     void playerFlee();
 
     // AI actions
-    void enemyTurn(Entity* enemy);
+    void enemyTurn(Entity* enemy, Entity* target);
     void allyTurn(Entity* ally);
 
     // Status checks
     bool isVictory() const;
     bool isDefeat() const;
     bool isInCombat() const;
+    bool isPlayerTurn() const;  // Waiting for the player's action
 
     // Display
     void displayCombatStatus() const;
@@ -167,6 +201,16 @@ private:
     CombatSystem* combatSystem;
     HackingSystem* hackingSystem;
 
+    // Current encounter (Sentinels stay owned by their sector)
+    Entity** combatEnemies;
+    int combatEnemyCount;
+    Entity** combatAllies;
+
+    // Recruited Awakened (owned by the game)
+    static const int MAX_PARTY = 4;     // At most SAVE_MAX_PARTY (SaveLoad.h)
+    Awakened* party[MAX_PARTY];
+    int partyCount;
+
     // Game state
     GameState currentState;
     GameState previousState;
@@ -178,24 +222,86 @@ private:
     int sectorsExplored;
     int hacksCompleted;
 
+    // Auto-save (every interval turns while exploring; 0 = off)
+    static const int AUTOSAVE_INTERVAL = 20;
+    int autoSaveInterval;
+    int lastAutoSaveTurn;
+
+    // Settings from config.ini (re-read when the file changes on disk)
+    static const long long CONFIG_CHECK_MS = 1000;
+    ConfigData* config;
+    long long nextConfigCheck;      // Steady clock, milliseconds
+
     // Private helper methods
     void initializeSystems();
     void cleanupSystems();
-    void processInput(const std::string& input);
+    void finishHacking();
+    void checkForEncounter();
+    void startCombat();
+    Entity* combatTarget() const;
+    void advanceCombat();
+    void finishCombat();
+    void releaseCombat();
+    void checkForRecruit();
+    void releaseParty();
+    void restoreParty(const SessionStats& stats);
+    void giveItem(Item* item);
+    void captureStats(SessionStats& stats) const;
+    void checkAutoSave();
+    void applyConfig(const ConfigData& previous);
+    void checkConfigReload();
+
+    /***************************************************************************
+     * State Transition Table
+     *
+     * Each state maps to a prompt (what the player sees while the game waits
+     * for input) and a handler (consumes one line of input and returns the
+     * next state). Neither blocks, so the game can be driven one input at a
+     * time by the console loop, a replay file or a test harness.
+     **************************************************************************/
+    typedef void (Game::*PromptFn)() const;
+    typedef GameState (Game::*HandlerFn)(const std::string& input);
+
+    struct StateHandler {
+        GameState state;        // State this entry belongs to
+        PromptFn prompt;        // Display before waiting for input
+        HandlerFn handle;       // Process input, return next state
+    };
+
+    static const StateHandler stateTable[static_cast<int>(GameState::STATE_COUNT)];
+    static const StateHandler* findHandler(GameState state);
+
+    // State prompts
+    void promptMainMenu() const;
+    void promptNewGame() const;
+    void promptLoadGame() const;
+    void promptPlaying() const;
+    void promptCombat() const;
+    void promptHacking() const;
+    void promptInventory() const;
+    void promptAbilities() const;
+    void promptUnlockAbility() const;
+    void promptCombatAbility() const;
+    void promptEventLog() const;
+    void promptSaveMenu() const;
+    void promptGameOver() const;
+    void promptVictory() const;
 
     // State handlers
-    void handleMainMenu();
-    void handleNewGame();
-    void handlePlaying();
-    void handleCombat();
-    void handleHacking();
-    void handleInventory();
-    void handleAbilities();
-    void handleEventLog();
-    void handleSaveMenu();
-    void handleOptions();
-    void handleGameOver();
-    void handleVictory();
+    GameState handleMainMenu(const std::string& input);
+    GameState handleNewGame(const std::string& input);
+    GameState handleLoadGame(const std::string& input);
+    GameState handlePlaying(const std::string& input);
+    GameState handleCombat(const std::string& input);
+    GameState handleHacking(const std::string& input);
+    GameState handleInventory(const std::string& input);
+    GameState handleAbilities(const std::string& input);
+    GameState handleUnlockAbility(const std::string& input);
+    GameState handleCombatAbility(const std::string& input);
+    GameState handleEventLog(const std::string& input);
+    GameState handleSaveMenu(const std::string& input);
+    GameState handleGameOver(const std::string& input);
+    GameState handleVictory(const std::string& input);
 
     // Utility
     void clearScreen() const;
@@ -210,8 +316,16 @@ public:
     ~Game();
 
     // Main game control
-    void run();                 // Main game loop
+    void run();                 // Console loop: prompt, read, step
     void quit();
+    bool isActive() const;
+
+    // Non-blocking state machine interface
+    // Step 1: Look up the handler for the current state
+    // Step 2: Let it consume the input and pick the next state
+    // Step 3: Apply the transition, return false once the game has quit
+    bool step(const std::string& input);
+    void prompt() const;        // Show the current state's prompt
 
     // State management
     void setState(GameState state);
@@ -221,11 +335,12 @@ public:
     void newGame(const std::string& playerName);
     bool saveGame(const std::string& slot);
     bool loadGame(const std::string& slot);
+    void setAutoSaveInterval(int turns);    // 0 disables auto-save
 
     // Exploration
     void explore(const std::string& direction);
     void scanArea();
-    void interactWithTerminal();
+    void interactWithTerminal();    // Starts a hack, enters HACKING state
     void rest();
 
     // Display methods
@@ -239,6 +354,7 @@ public:
     Inventory* getInventory() const;
     AbilityTree* getAbilities() const;
     int getTurnCount() const;
+    const ConfigData& getConfig() const;
 
     // Events
     void logEvent(const std::string& description, const std::string& type);
@@ -146,6 +146,11 @@ public:
     bool hasItem(const std::string& code) const;
     void displayAllItems() const;
 
+    // Bulk lookup (save loading): out[i] = template for codes[i], nullptr if
+    // unknown. Runs of the same code reuse the previous lookup.
+    // Returns the number of codes resolved.
+    int resolveItems(const std::string* codes, int count, Item** out) const;
+
     // Factory methods for creating specific item types
     static Item* createWeapon(const std::string& code, const std::string& name,
                               const std::string& desc, int damage);
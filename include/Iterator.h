@@ -67,6 +67,7 @@ private:
     InventoryNode* head;        // Head of item list
     int itemCount;              // Total items
     int maxCapacity;            // Maximum items allowed
+    int modCount;               // Bumped on every change (save journal)
 
 public:
     Inventory(int capacity = 50);
@@ -77,6 +78,12 @@ public:
     bool removeItem(const std::string& code);
     Item* getItem(const std::string& code) const;
     bool hasItem(const std::string& code) const;
+    void clear();
+
+    // Bulk restore (save loading): link count items in order, items[0]
+    // first, without the per-item stacking search. Takes ownership;
+    // capacity grows to fit.
+    void restoreItems(Item** items, int count);
 
     // Quantity management
     bool increaseQuantity(const std::string& code, int amount);
@@ -87,6 +94,7 @@ public:
     int getMaxCapacity() const;
     bool isFull() const;
     bool isEmpty() const;
+    int getModCount() const;
 
     // Display
     void displayAll() const;
@@ -80,6 +80,11 @@ public:
     // Step 4: Increment event count
     void addEvent(const std::string& description, const std::string& type);
 
+    // Restore Event (save loading): like addEvent, keeps the saved timestamp
+    // and does not echo the event
+    void restoreEvent(const std::string& description, const std::string& type,
+                      const std::string& timestamp);
+
     // Display Recent: Show last n events
     // Step 1: Start at head (most recent)
     // Step 2: Traverse and display up to n events
@@ -101,6 +106,9 @@ public:
 
     // Get events as string array (for save system)
     std::string* getEventsAsArray(int& outCount) const;
+
+    // Get raw access (newest first) for the save system
+    const EventNode* getHead() const;
 };
 
 /*******************************************************************************
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * MemoryTracker.h - Per-Subsystem Allocation Accounting
+ *
+ * Opt-in allocator instrumentation. When built with DEXODUS_MEMPROFILE
+ * ("make memprofile") the global operator new/delete are replaced by
+ * versions that prefix every block with its size and a subsystem tag.
+ * The tag is whatever MEM_SCOPE was active on the allocating thread, so
+ * nodes, item copies and the temporary arrays returned by getAllItems(),
+ * getEventsAsArray() or getUnlockedAbilities() are charged to the
+ * subsystem that asked for them.
+ *
+ * Reported per subsystem:
+ * - live bytes and high-water mark
+ * - allocation count and allocations per turn (rate)
+ * - allocations and peak live bytes during the last/worst turn
+ *
+ * Without DEXODUS_MEMPROFILE the macros expand to nothing and the
+ * standard allocator is used untouched.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef MEMORYTRACKER_H
+#define MEMORYTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+
+/*******************************************************************************
+ * Subsystem Tags
+ ******************************************************************************/
+enum class MemSubsystem {
+    OTHER,                      // Untagged (iostream, std::string temporaries...)
+    ENTITY,                     // Player, Sentinel, Awakened
+    ITEMS,                      // ItemDatabase, HashTable nodes, Item copies
+    INVENTORY,                  // InventoryNode, iterators
+    EVENT_LOG,                  // EventNode, event arrays
+    GRID_MAP,                   // SectorNode, sector enemy arrays
+    HACKING,                    // ActionStack / StackNode<Action>
+    COMBAT,                     // CombatQueue / QueueNode<Entity*>
+    ABILITIES,                  // AbilityTree nodes and ability arrays
+    STORYTELLER,                // Overseer and modules
+    SAVE_LOAD,                  // Save/load buffers
+    SUBSYSTEM_COUNT
+};
+
+/*******************************************************************************
+ * MemoryTracker - Static allocation counters
+ *
+ * Counters are plain static arrays of atomics so they are usable from the
+ * very first allocation (before any constructor runs).
+ ******************************************************************************/
+class MemoryTracker {
+public:
+    // Per-subsystem snapshot for reporting
+    struct Stats {
+        uint64_t liveBytes;         // Currently allocated
+        uint64_t peakBytes;         // High-water mark of liveBytes
+        uint64_t allocations;       // Total allocations ever
+        uint64_t frees;             // Total frees ever
+        uint64_t bytesAllocated;    // Total bytes ever allocated
+        uint64_t lastTurnAllocations;
+        uint64_t lastTurnBytes;
+        uint64_t maxTurnAllocations;
+        uint64_t lastTurnPeakBytes; // Highest live bytes during the last turn
+    };
+
+    // Allocation hooks (called by the replaced operator new/delete)
+    static void recordAlloc(MemSubsystem tag, size_t bytes);
+    static void recordFree(MemSubsystem tag, size_t bytes);
+
+    // Tag for allocations made on this thread
+    static MemSubsystem getCurrentTag();
+    static MemSubsystem setCurrentTag(MemSubsystem tag);    // Returns previous
+
+    // Close the current turn: roll per-turn counters over
+    static void endTurn();
+
+    // Queries
+    static bool isEnabled();
+    static Stats getStats(MemSubsystem tag);
+    static uint64_t getTotalLiveBytes();
+    static uint64_t getTotalAllocations();
+    static uint64_t getTurnCount();
+    static const char* getSubsystemName(MemSubsystem tag);
+
+    // Display
+    static void displayReport();
+};
+
+/*******************************************************************************
+ * MemScope - Tags allocations made while it is alive
+ ******************************************************************************/
+class MemScope {
+private:
+    MemSubsystem previous;
+
+public:
+    explicit MemScope(MemSubsystem tag)
+        : previous(MemoryTracker::setCurrentTag(tag)) {}
+
+    ~MemScope() {
+        MemoryTracker::setCurrentTag(previous);
+    }
+
+    MemScope(const MemScope&) = delete;
+    MemScope& operator=(const MemScope&) = delete;
+};
+
+/*******************************************************************************
+ * Instrumentation macros (compiled out unless DEXODUS_MEMPROFILE is defined)
+ ******************************************************************************/
+#define MEM_CONCAT_INNER(a, b) a##b
+#define MEM_CONCAT(a, b) MEM_CONCAT_INNER(a, b)
+
+#ifdef DEXODUS_MEMPROFILE
+#define MEM_SCOPE(tag) MemScope MEM_CONCAT(memScope_, __LINE__)(tag)
+#define MEM_END_TURN() MemoryTracker::endTurn()
+#else
+#define MEM_SCOPE(tag) ((void)0)
+#define MEM_END_TURN() ((void)0)
+#endif
+
+#endif // MEMORYTRACKER_H
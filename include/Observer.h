@@ -211,6 +211,13 @@ private:
     std::string pendingEvent;
     bool hasPendingEvent;
 
+    // Encounter waiting for the game to spawn it
+    int pendingEncounterDifficulty;
+    bool hasPendingEncounter;
+
+    // Awakened waiting for the game to recruit them
+    bool hasPendingAlly;
+
 public:
     Overseer();
     ~Overseer();
@@ -237,6 +244,17 @@ public:
     bool checkPendingEvent() const;
     std::string consumePendingEvent();
 
+    // Encounter management (the game spawns the enemy in the player's sector)
+    bool checkPendingEncounter() const;
+    int consumePendingEncounter();     // Returns difficulty
+
+    // Ally management (the game creates and recruits the Awakened)
+    bool checkPendingAlly() const;
+    void consumePendingAlly();
+
+    // Settings (difficulty from config.ini, forwarded to the combat module)
+    void setBaseDifficulty(int difficulty);
+
     // Getters
     int getTurnCounter() const;
     std::string getLastEventType() const;
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Profiler.h - Per-Turn Phase Profiler
+ *
+ * Lightweight scoped timers around the hot gameplay paths. Each timed scope
+ * feeds a per-phase histogram (for p50/p99 reporting) and a ring buffer of
+ * trace events that can be exported as Chrome trace JSON
+ * (open chrome://tracing or https://ui.perfetto.dev and load the file).
+ *
+ * The PROFILE_SCOPE macro only expands when DEXODUS_PROFILE is defined
+ * (see "make profile"), so normal builds carry no timing code at all.
+ *
+ * Clock source: steady_clock by default. Define DEXODUS_PROFILE_RDTSC on
+ * x86 to read the time stamp counter instead; ticks are converted to
+ * nanoseconds against steady_clock when the report is produced.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+/*******************************************************************************
+ * Profiled Phases
+ *
+ * Fixed set of phases so recording is an array index, not a string lookup.
+ ******************************************************************************/
+enum class ProfilePhase {
+    GAME_STEP,                  // One input through Game::step
+    GAME_EXPLORE,               // Game::explore
+    OVERSEER_EVALUATE,          // Overseer::evaluateAndTrigger
+    PLAYERSTATE_NOTIFY,         // PlayerState::notify
+    STORYTELLER_COMBAT,         // CombatStorytellerModule::update
+    STORYTELLER_EVENT,          // EventStorytellerModule::update
+    STORYTELLER_ENVIRONMENT,    // EnvironmentStorytellerModule::update
+    COMBAT_PROCESS_TURN,        // CombatSystem::processTurn
+    HACK_INJECT,                // HackingSystem::injectCode
+    HACK_BYPASS,                // HackingSystem::bypassFirewall
+    HACK_DECRYPT,               // HackingSystem::decryptLayer
+    HACK_UNDO,                  // HackingSystem::undoLastAction
+    SAVE_GAME,                  // SaveLoadManager::saveGame
+    PHASE_COUNT
+};
+
+/*******************************************************************************
+ * Phase Histogram
+ *
+ * Log-linear buckets over clock ticks: values below 16 get one bucket each,
+ * above that every power of two is split into 4 sub-buckets (< 25% error).
+ * Fixed size, no allocation while recording.
+ ******************************************************************************/
+struct PhaseHistogram {
+    static const int LINEAR_BUCKETS = 16;
+    static const int SUB_BUCKETS = 4;
+    static const int BUCKET_COUNT = LINEAR_BUCKETS + 60 * SUB_BUCKETS;
+
+    uint64_t buckets[BUCKET_COUNT];
+    uint64_t count;
+    uint64_t totalTicks;
+    uint64_t minTicks;
+    uint64_t maxTicks;
+
+    PhaseHistogram();
+
+    void record(uint64_t ticks);
+    void clear();
+    uint64_t percentile(double fraction) const;
+
+    static int bucketFor(uint64_t ticks);
+    static uint64_t bucketUpperBound(int bucket);
+};
+
+/*******************************************************************************
+ * Profiler - Collects timings for all phases (Singleton)
+ ******************************************************************************/
+class Profiler {
+private:
+    // Raw trace event kept for Chrome trace export
+    struct TraceEvent {
+        ProfilePhase phase;
+        uint64_t startTicks;
+        uint64_t durationTicks;
+    };
+
+    static const int TRACE_CAPACITY = 65536;   // Ring buffer size
+
+    PhaseHistogram* histograms; // One histogram per phase (in ticks)
+    TraceEvent* trace;          // Ring buffer of recent events
+    int traceHead;              // Next slot to write
+    uint64_t traceTotal;        // Events ever written
+
+    uint64_t originTicks;       // Tick value when profiling started
+    int64_t originNanos;        // steady_clock at the same moment
+
+    Profiler();
+
+    double nanosPerTick() const;
+
+public:
+    static Profiler& getInstance();
+    ~Profiler();
+
+    // Prevent copying
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // Current tick count from the configured clock source
+    static uint64_t now();
+
+    // Record one completed scope
+    void record(ProfilePhase phase, uint64_t startTicks, uint64_t endTicks);
+
+    // Reporting
+    void displayReport() const;
+    bool exportChromeTrace(const std::string& path) const;
+    void reset();
+
+    // Query (values in nanoseconds)
+    uint64_t getCount(ProfilePhase phase) const;
+    uint64_t getPercentile(ProfilePhase phase, double fraction) const;
+
+    static const char* getPhaseName(ProfilePhase phase);
+};
+
+/*******************************************************************************
+ * ScopedTimer - Records the lifetime of a scope into the profiler
+ ******************************************************************************/
+class ScopedTimer {
+private:
+    ProfilePhase phase;
+    uint64_t startTicks;
+
+public:
+    explicit ScopedTimer(ProfilePhase phase)
+        : phase(phase), startTicks(Profiler::now()) {}
+
+    ~ScopedTimer() {
+        Profiler::getInstance().record(phase, startTicks, Profiler::now());
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+/*******************************************************************************
+ * Instrumentation macro (compiled out unless DEXODUS_PROFILE is defined)
+ ******************************************************************************/
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifdef DEXODUS_PROFILE
+#define PROFILE_SCOPE(phase) ScopedTimer PROFILE_CONCAT(profileScope_, __LINE__)(phase)
+#else
+#define PROFILE_SCOPE(phase) ((void)0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,36 @@
+/*******************************************************************************
+ * SaveChecksum.h - CRC-32C (Castagnoli) for Save File Integrity
+ *
+ * CONCEPT: Hardware CRC with a table-driven fallback
+ *
+ * Every chunk of a version 4 save ends in the CRC-32C of its tag, length
+ * and payload (see SaveFormat.h), so a torn or bit-flipped section is
+ * caught while it is decoded instead of being read as garbage.
+ *
+ * - x86-64 with SSE4.2: the crc32 instruction, 8 bytes per step
+ * - ARMv8 built with the CRC extension: crc32cx, 8 bytes per step
+ * - Anything else: slicing-by-8 (eight 256-entry tables, built once)
+ *
+ * The CPU is checked once at run time, so one binary runs everywhere and
+ * both paths produce identical values.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef SAVECHECKSUM_H
+#define SAVECHECKSUM_H
+
+#include <cstddef>
+
+// CRC-32C of data, continuing from crc (pass 0 to start)
+// crc32c(crc32c(0, a, n), b, m) == CRC of a followed by b
+unsigned int crc32c(unsigned int crc, const void* data, std::size_t size);
+
+// Portable path only (the benchmarks compare the two)
+unsigned int crc32cPortable(unsigned int crc, const void* data, std::size_t size);
+
+// True if crc32c() runs on the CPU's CRC instruction
+bool crc32cHardware();
+
+#endif // SAVECHECKSUM_H
@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * SaveCompress.h - Built-in LZ77 Block Codec for Save Files
+ *
+ * CONCEPT: LZ4-style block compression (byte-oriented, no entropy stage)
+ *
+ * A compressed block is a list of sequences:
+ *
+ *   token | [literal length bytes] | literals | offset (2 bytes LE) | [match length bytes]
+ *
+ *   token       high 4 bits = literal count, low 4 bits = match length - 4
+ *               (15 means "more follows": add bytes until one is not 255)
+ *   offset      distance back into the output (1..65535)
+ *
+ * The last sequence has literals only. Matches are found with a 4096-entry
+ * hash table of 4-byte prefixes, so compression is a single pass and
+ * decompression is plain copying. Save data repeats sector names, item
+ * codes and event types constantly, which is exactly what this catches.
+ *
+ * Blocks are at most SAVE_BLOCK_SIZE bytes, so an encoder or decoder only
+ * ever holds one block of uncompressed data (see the ZBLK chunk in
+ * SaveFormat.h).
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef SAVECOMPRESS_H
+#define SAVECOMPRESS_H
+
+#include <cstddef>
+
+// Uncompressed bytes per block (offsets are 16-bit, so 64 KiB is the window)
+const std::size_t SAVE_BLOCK_SIZE = 64 * 1024;
+
+// Worst-case compressed size of size input bytes
+std::size_t lzCompressBound(std::size_t size);
+
+// Compress source into dest (at least lzCompressBound(size) bytes)
+// Returns the compressed size
+std::size_t lzCompress(const unsigned char* source, std::size_t size, unsigned char* dest);
+
+// Decompress into exactly destSize bytes; false on malformed input
+// (every length and offset is bounds-checked, so corrupt files are safe)
+bool lzDecompress(const unsigned char* source, std::size_t size,
+                  unsigned char* dest, std::size_t destSize);
+
+#endif // SAVECOMPRESS_H
@@ -0,0 +1,312 @@
+/*******************************************************************************
+ * SaveFormat.h - Chunked, Varint-Encoded Save Format
+ *
+ * File layout (version 4):
+ *
+ *   "DEXO"  version  | INFO | JGEN | PLYR | WRLD | SECT | INVT | ABIL | STAT | PRTY | EVNT | END
+ *   magic   varint   | chunk: tag (4 bytes) + varint length + payload + CRC-32C (4 bytes)
+ *
+ * - Integers are LEB128 varints; signed values are zigzag-encoded first,
+ *   so small numbers take one byte whatever their sign.
+ * - Strings are a varint length followed by the raw bytes.
+ * - Every chunk carries its payload length, so readers skip tags they do
+ *   not know and newer sections never break older loaders.
+ * - INFO comes first, so save-slot listings only decode one small chunk.
+ * - Fields appended to an existing chunk are read only when the payload
+ *   still has bytes left, so earlier version 3 files keep loading.
+ * - The CRC covers tag, length and payload and is checked as each chunk is
+ *   framed, so a torn or damaged section fails the load instead of being
+ *   decoded. Version 3 chunks have no CRC and are read as before.
+ * - Decoding skips body chunks whose section is not in state.sections, so
+ *   a partial load (SaveView.h) only pays for the sections it asks for.
+ *
+ * - EVNT appends to the events already decoded and SCTD (journal records
+ *   only) replaces single sectors, so a journal record is just a chunk
+ *   list that is decoded on top of the base (see SaveJournal.h).
+ *
+ * Compressed saves keep INFO and JGEN as they are and pack every other
+ * chunk into a stream of ZBLK chunks:
+ *
+ *   "DEXO" version | INFO | JGEN | ZBLK | ZBLK | ... | END
+ *   ZBLK payload:    varint (rawSize << 1 | stored) + block bytes
+ *
+ * Each block holds at most SAVE_BLOCK_SIZE bytes of the inner chunk
+ * stream (LZ-compressed, or stored when that is not smaller). Inner chunks
+ * may straddle blocks; the decoder decompresses one block at a time and
+ * decodes every chunk completed so far, so neither side ever holds the
+ * whole uncompressed body.
+ *
+ * Version 1 and 2 saves (raw SaveDataV1 / SaveData struct dumps) are still
+ * decoded by the legacy path and converted into the same SaveState.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef SAVEFORMAT_H
+#define SAVEFORMAT_H
+
+#include <string>
+#include <cstddef>
+
+const char SAVE_MAGIC[4] = {'D', 'E', 'X', 'O'};
+
+// Build a chunk tag from four characters (stored little-endian on disk)
+constexpr unsigned int saveTag(char a, char b, char c, char d) {
+    return static_cast<unsigned int>(static_cast<unsigned char>(a)) |
+           (static_cast<unsigned int>(static_cast<unsigned char>(b)) << 8) |
+           (static_cast<unsigned int>(static_cast<unsigned char>(c)) << 16) |
+           (static_cast<unsigned int>(static_cast<unsigned char>(d)) << 24);
+}
+
+const unsigned int CHUNK_INFO = saveTag('I', 'N', 'F', 'O');   // Slot summary
+const unsigned int CHUNK_PLAYER = saveTag('P', 'L', 'Y', 'R');  // Player stats
+const unsigned int CHUNK_WORLD = saveTag('W', 'R', 'L', 'D');   // Location
+const unsigned int CHUNK_SECTORS = saveTag('S', 'E', 'C', 'T'); // Visited flags, enemies
+const unsigned int CHUNK_INVENTORY = saveTag('I', 'N', 'V', 'T');
+const unsigned int CHUNK_ABILITIES = saveTag('A', 'B', 'I', 'L');
+const unsigned int CHUNK_STATS = saveTag('S', 'T', 'A', 'T');   // Session counters
+const unsigned int CHUNK_PARTY = saveTag('P', 'R', 'T', 'Y');   // Recruited Awakened
+const unsigned int CHUNK_EVENTS = saveTag('E', 'V', 'N', 'T');  // Event log (appends)
+const unsigned int CHUNK_SECTOR_DELTA = saveTag('S', 'C', 'T', 'D'); // Changed sectors
+const unsigned int CHUNK_JOURNAL = saveTag('J', 'G', 'E', 'N'); // Journal generation
+const unsigned int CHUNK_BLOCK = saveTag('Z', 'B', 'L', 'K');   // Compressed chunk stream
+const unsigned int CHUNK_END = saveTag('E', 'N', 'D', ' ');
+
+// Sections a SaveState holds (a journal capture may skip unchanged ones)
+enum SaveSection : unsigned int {
+    SECTION_PLAYER = 1u << 0,
+    SECTION_WORLD = 1u << 1,
+    SECTION_SECTORS = 1u << 2,
+    SECTION_INVENTORY = 1u << 3,
+    SECTION_ABILITIES = 1u << 4,
+    SECTION_STATS = 1u << 5,
+    SECTION_EVENTS = 1u << 6,
+    SECTION_PARTY = 1u << 7,
+    SECTION_ALL = (1u << 8) - 1
+};
+
+/*******************************************************************************
+ * SaveState - Everything a save holds, independent of the file layout
+ ******************************************************************************/
+struct SaveState {
+    int version;                // Version of the file it came from
+    unsigned int sections;      // SaveSection bits captured (encode) / wanted (decode)
+    unsigned long long journalGeneration;   // JGEN (0 = no journal)
+    bool compressed;            // Body in ZBLK blocks (set by decode, used by encode)
+
+    // INFO
+    std::string playerName;
+    long long saveTime;
+    int level;
+
+    // PLYR
+    int health;
+    int maxHealth;
+    int experience;
+    int attackPower;
+    int defense;
+    int speed;
+    int hackingSkill;
+
+    // WRLD
+    std::string currentSector;
+
+    // SECT (bit i / sector index i = GridMap sector i; sectorCount 0 = absent)
+    int sectorCount;
+    int visitedWordCount;
+    unsigned long long* visitedSectors;
+    int sectorEnemyCount;
+    int* enemySectors;          // Sector index per enemy
+    int* enemyTypes;            // Sentinel::Type
+    int* enemyHealth;
+    std::string* enemyNames;
+
+    // INVT
+    int inventoryCount;
+    std::string* inventoryCodes;
+    int* inventoryQuantities;
+
+    // ABIL (bit i = ability i of the tree the save was made with)
+    int abilityCount;
+    int skillPoints;
+    int unlockedAbilityCount;
+    int unlockedWordCount;
+    unsigned long long* unlockedAbilities;
+    int unlockedCodeCount;      // Version 1 saves: unlocks by ability code instead
+    std::string* unlockedCodes;
+
+    // STAT
+    int turnCount;
+    int sectorsExplored;
+    int enemiesDefeated;
+    int eventsTriggered;
+    int hacksCompleted;         // Appended field (absent in early v3 files)
+
+    // PRTY (absent in older files = no party)
+    int partyCount;
+    std::string* partyNames;
+    int* partySpecialties;      // Awakened::Specialty
+    int* partyLoyalty;
+    int* partyHealth;
+
+    // EVNT (oldest first; a journal capture holds only the new ones)
+    int eventCount;
+    int eventCapacity;
+    std::string* eventTypes;
+    std::string* eventDescriptions;
+    std::string* eventTimestamps;
+
+    SaveState();
+    ~SaveState();
+
+    // Prevent copying (owns its arrays)
+    SaveState(const SaveState&) = delete;
+    SaveState& operator=(const SaveState&) = delete;
+
+    void setInventoryCount(int count);      // Reallocates the item arrays
+    void setUnlockedWordCount(int count);   // Reallocates the bitset
+    void setUnlockedCodeCount(int count);   // Reallocates the code list (version 1)
+    void setVisitedWordCount(int count);    // Reallocates the visited bitset
+    void setSectorEnemyCount(int count);    // Reallocates the enemy arrays
+    void setPartyCount(int count);          // Reallocates the party arrays
+    int appendEvents(int count);            // Grows the event arrays, returns first new index
+};
+
+/*******************************************************************************
+ * SaveWriter - Appends varints / strings, wraps them into chunks
+ ******************************************************************************/
+class SaveWriter {
+private:
+    std::string output;         // Finished bytes
+    std::string chunk;          // Payload of the open chunk
+    unsigned int chunkTag;
+    bool inChunk;
+
+public:
+    SaveWriter();
+
+    // LEB128 varint appended to any buffer (also used for journal records)
+    static void appendVarint(std::string& target, unsigned long long value);
+
+    // Step 1: Magic and version
+    void beginFile(int version);
+
+    // Step 2: Chunks (payload buffered until endChunk writes tag + length)
+    void beginChunk(unsigned int tag);
+    void endChunk();
+
+    // Payload values
+    void writeVarint(unsigned long long value);
+    void writeInt(long long value);             // Zigzag + varint
+    void writeString(const std::string& value);
+    void writeBytes(const void* data, std::size_t size);    // Raw, no length
+
+    // Finished bytes so far (closes the open chunk); truncate drops chunks
+    // written after a getSize() mark
+    std::size_t getSize();
+    const std::string& getOutput();
+    void truncate(std::size_t size);
+
+    // Step 3: END chunk, return the bytes
+    const std::string& finish();
+};
+
+/*******************************************************************************
+ * SaveReader - Bounds-checked cursor over a byte range
+ *
+ * Any read past the end (or a malformed varint) sets the failed flag and
+ * returns zero values, so decoders check failed() once per section.
+ ******************************************************************************/
+class SaveReader {
+private:
+    const unsigned char* data;
+    std::size_t size;
+    std::size_t position;
+    bool failedFlag;
+    bool checksummed;           // Chunks end in a CRC-32C (version 4+)
+    bool checksumFlag;          // A chunk's CRC did not match
+
+public:
+    SaveReader();
+    SaveReader(const unsigned char* data, std::size_t size);
+
+    unsigned long long readVarint();
+    long long readInt();
+    int readInt32();                            // readInt, fails outside int range
+    std::string readString();
+    bool readBytes(void* out, std::size_t count);
+    const unsigned char* peek() const;          // Unread bytes (remaining() of them)
+
+    // Next chunk: its tag and a reader limited to its payload
+    // (checksummed: the CRC is checked unless verify is false)
+    bool nextChunk(unsigned int& tag, SaveReader& payload, bool verify = true);
+
+    // Next count bytes as their own reader (journal records)
+    bool readSlice(std::size_t count, SaveReader& slice);
+
+    // Payload and slice readers inherit the setting
+    void setChecksummed(bool enabled);
+    bool isChecksummed() const;
+    bool checksumFailed() const;
+
+    bool failed() const;
+    bool atEnd() const;
+    std::size_t getPosition() const;
+    std::size_t remaining() const;
+};
+
+/*******************************************************************************
+ * Encoding / decoding
+ ******************************************************************************/
+// Build the SAVE_VERSION (chunked) byte image of a save
+// (body compressed into ZBLK blocks when state.compressed is set)
+void encodeSave(const SaveState& state, std::string& out);
+
+// Write one section as a complete chunk (INFO, JGEN, PLYR, WRLD, SECT, INVT,
+// ABIL, STAT, PRTY, EVNT)
+void encodeSection(SaveWriter& writer, unsigned int tag, const SaveState& state);
+
+// Write an SCTD chunk holding the sectors flagged in changed[sectorCount]
+void encodeSectorDelta(SaveWriter& writer, const SaveState& state, const bool* changed);
+
+// Section bit of a chunk tag (0 for INFO, JGEN and framing chunks)
+unsigned int chunkSection(unsigned int tag);
+
+// Decode one chunk's payload into state; sections not in state.sections
+// and unknown tags are skipped
+bool decodeSection(SaveReader& payload, unsigned int tag, SaveState& state);
+
+// Decode chunks on top of state until END (journal records reuse this)
+// ZBLK blocks are decompressed and their chunks decoded as they arrive
+bool decodeChunks(SaveReader& reader, SaveState& state, bool infoOnly = false);
+
+// Decode any supported version (3-4 chunked with CRCs from 4, 1-2 legacy struct)
+// infoOnly stops after the INFO chunk (slot listings)
+bool decodeSave(const unsigned char* data, std::size_t size, SaveState& state,
+                bool infoOnly = false);
+
+// Trailer after every chunk of a version 4+ file
+const std::size_t CHUNK_CHECKSUM_SIZE = 4;
+
+// CRC of chunk[0, size) against the 4 bytes stored right after it
+bool chunkChecksumMatches(const unsigned char* chunk, std::size_t size);
+
+// What a check of every chunk CRC found
+enum class SaveIntegrity {
+    VALID,          // All chunks present, every CRC matches
+    UNCHECKED,      // Complete, but written before checksums (version 2/3)
+    TRUNCATED,      // Ends before the END chunk (torn or partial write)
+    CORRUPT,        // A chunk's CRC does not match
+    INVALID         // Not a save file / unsupported version
+};
+
+// Check framing and CRCs without decoding anything (one pass over the bytes)
+SaveIntegrity verifySave(const unsigned char* data, std::size_t size);
+
+// FNV-1a 64 fingerprint (journal change detection, index checksums)
+// Chain calls by passing the previous result as hash
+const unsigned long long FINGERPRINT_SEED = 14695981039346656037ULL;
+unsigned long long fingerprintBytes(unsigned long long hash, const void* data, std::size_t size);
+
+#endif // SAVEFORMAT_H
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * SaveIndex.h - Save Directory Index with Cached Slot Metadata
+ *
+ * CONCEPT: Metadata cache validated by file size + modification time
+ *
+ * "<saves>/saves.idx" keeps one entry per save slot:
+ *
+ *   slot | player name | level | save time | file size | mtime | checksum | integrity
+ *
+ * Listing the slots scans the directory (names, sizes and times only) and
+ * compares each file against its entry. Only files that are new or whose
+ * size/time changed are opened, so a browser over hundreds of slots costs
+ * one directory read. A file that is (re)read also has every chunk CRC
+ * checked, so listings report damaged slots without opening them again.
+ * Saves made through SaveLoadManager update their
+ * entry directly; saves written by the background writer are adopted at
+ * the next scan when their size matches what was queued.
+ *
+ * File layout: "DIDX" | SIDX chunk (varint count + entries) | END, written
+ * with SaveWriter and replaced atomically.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef SAVEINDEX_H
+#define SAVEINDEX_H
+
+#include "SaveFormat.h"
+#include <string>
+
+/*******************************************************************************
+ * SaveIndexEntry - What a slot listing shows, plus how to validate it
+ ******************************************************************************/
+struct SaveIndexEntry {
+    std::string slot;               // File name without ".dat"
+    std::string playerName;         // Empty if the file could not be decoded
+    int level;
+    long long saveTime;
+    long long fileSize;             // Of "<slot>.dat" when indexed
+    long long modifiedTime;         // mtime when indexed (-1 = adopt at next scan)
+    unsigned long long checksum;    // CRC-32C of the whole file
+    SaveIntegrity integrity;        // Chunk CRC check when indexed
+
+    SaveIndexEntry();
+};
+
+/*******************************************************************************
+ * SaveIndex - Entries sorted by slot name (binary search)
+ ******************************************************************************/
+class SaveIndex {
+private:
+    std::string directory;
+    SaveIndexEntry* entries;
+    int entryCount;
+    int capacity;
+    bool dirty;                     // Entries differ from saves.idx
+
+    // Helper: Position of slot, or where it would be inserted
+    int lowerBound(const std::string& slot) const;
+    SaveIndexEntry& findOrInsert(const std::string& slot);
+    void removeAt(int position);
+
+    // Helper: Open one save and fill the entry from its INFO chunk
+    void readEntry(SaveIndexEntry& entry, long long size, long long modified) const;
+
+    bool loadFile();
+
+public:
+    SaveIndex();
+    ~SaveIndex();
+
+    // Prevent copying (owns the entry array)
+    SaveIndex(const SaveIndex&) = delete;
+    SaveIndex& operator=(const SaveIndex&) = delete;
+
+    // Point at a save directory and read its saves.idx (if any)
+    void open(const std::string& saveDirectory);
+
+    // A full save of slot was written (or queued) with these bytes
+    void recordSave(const std::string& slot, const SaveState& info, const std::string& bytes);
+
+    // A journal record updated slot (player name, level, time only)
+    void recordInfo(const std::string& slot, const SaveState& info);
+
+    void remove(const std::string& slot);
+
+    // SCAN: Reconcile with the directory, re-reading changed files only
+    // Step 1: List "*.dat" with size and mtime
+    // Step 2: Keep matching entries, adopt pending ones, re-read the rest
+    // Step 3: Drop entries whose file is gone, write saves.idx if anything changed
+    void refresh();
+
+    // Write saves.idx if entries changed since it was read/written
+    bool flush();
+
+    // Access
+    int getCount() const;
+    const SaveIndexEntry& getEntry(int index) const;
+    const SaveIndexEntry* find(const std::string& slot) const;
+};
+
+#endif // SAVEINDEX_H
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * SaveJournal.h - Incremental (Delta) Saves with Periodic Compaction
+ *
+ * CONCEPT: Write-ahead journal over a base snapshot
+ *
+ * A journaled slot is two files:
+ *
+ *   <slot>.dat   base snapshot (normal chunked save, with a JGEN chunk)
+ *   <slot>.jnl   "DJNL" generation | record | record | ...
+ *                record = varint length + chunks + END
+ *
+ * A record holds only the sections whose encoding changed since the last
+ * save (fingerprinted with FNV-1a), the sectors that changed (SCTD) and the
+ * events logged since (EVNT appends). Loading decodes the base, then each
+ * record on top of it. A torn last record (crash mid-append) fails its
+ * length check and is ignored.
+ *
+ * After COMPACT_AFTER records the writer thread folds the journal into a
+ * new base with a new generation and starts an empty journal. A journal
+ * whose generation does not match the base is stale and skipped, so a
+ * crash between those two writes loses nothing.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef SAVEJOURNAL_H
+#define SAVEJOURNAL_H
+
+#include <string>
+#include <cstddef>
+
+struct SaveState;
+
+// "DJNL" + generation: the start of every journal file
+void encodeJournalHeader(unsigned long long generation, std::string& out);
+
+// Decode the journal's records on top of state (the decoded base)
+// Returns the number of records applied, -1 if the journal is stale/invalid
+int replayJournal(const unsigned char* data, std::size_t size, SaveState& state);
+
+// Base + journal -> new base of generation, fresh journal (writer thread)
+bool compactJournal(const std::string& basePath, const std::string& journalPath,
+                    unsigned long long generation);
+
+/*******************************************************************************
+ * SaveJournal - Fingerprints of what the last save of one slot held
+ ******************************************************************************/
+class SaveJournal {
+public:
+    static const int COMPACT_AFTER = 16;    // Records before a compaction
+
+private:
+    static const int HASHED_SECTIONS = 6;   // PLYR, WRLD, INVT, ABIL, STAT, PRTY
+
+    std::string slot;
+    bool hasBase;                   // Base written this session
+    unsigned long long generation;
+    int deltaCount;                 // Records since the base / last compaction
+
+    unsigned long long sectionHashes[HASHED_SECTIONS];
+    unsigned long long* sectorHashes;
+    int sectorCount;
+    int inventoryModCount;          // Inventory::getModCount() at the last save
+    int eventsWritten;              // Events already in base + records
+
+    // Helper: Fresh generation id (never reused, also across restarts)
+    static unsigned long long nextGeneration();
+
+    // Helper: Fingerprints of everything in state
+    void remember(const SaveState& state);
+
+public:
+    SaveJournal(const std::string& slot);
+    ~SaveJournal();
+
+    // Prevent copying (owns the sector hash array)
+    SaveJournal(const SaveJournal&) = delete;
+    SaveJournal& operator=(const SaveJournal&) = delete;
+
+    // What the next capture needs
+    const std::string& getSlot() const;
+    bool hasBaseSnapshot() const;
+    bool inventoryChanged(int modCount) const;
+    int getEventsWritten() const;
+
+    // BASE: Full snapshot (state gets a new generation) + journal header
+    void buildBase(SaveState& state, int modCount, std::string& bytes, std::string& header);
+
+    // DELTA: Record of what changed; false if nothing did
+    // Step 1: INFO, then each hashed section that differs from its fingerprint
+    // Step 2: Changed sectors (SCTD), or all of them if the map size changed
+    // Step 3: New events
+    bool buildDelta(const SaveState& state, int modCount, std::string& record);
+
+    // Compaction (the writer thread does the work)
+    bool needsCompaction() const;
+    unsigned long long beginCompaction();   // New generation for the compacted base
+
+    // Forget the base (next save writes a full snapshot)
+    void reset();
+};
+
+#endif // SAVEJOURNAL_H
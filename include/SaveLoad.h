@@ -9,7 +9,7 @@
  * - Config file management
  * - Auto-save functionality
  *
- * Save File Format: Binary (.dat) for efficiency
+ * Save File Format: Binary (.dat), chunked and varint-encoded (SaveFormat.h)
  * Config File Format: Text (.ini) for user editing
  *
  * Author: Alif Harriz Jeffery | 102782711
@@ -30,13 +30,38 @@ class Inventory;
 class AbilityTree;
 class GridMap;
 class EventLog;
+class ItemDatabase;
+class AutoSaveWriter;
+class SaveJournal;
+class SaveIndex;
+
+struct SaveState;
+
+// Save format version written by saveGame (chunked format, see SaveFormat.h)
+const int SAVE_VERSION = 4;
+
+// First version whose chunks end in a CRC-32C
+const int FIRST_CHECKSUM_VERSION = 4;
+
+// Last version that was a raw SaveData dump (still loadable)
+const int LEGACY_SAVE_VERSION = 2;
+
+// Original release: raw SaveDataV1 dump, unlocks stored as ability codes
+const int ORIGINAL_SAVE_VERSION = 1;
+
+// Unlocked-ability bitset words in a legacy save (64 abilities per word)
+const int SAVE_ABILITY_WORDS = 4;
+
+// Recruited Awakened restored from a save (the party size of Game)
+const int SAVE_MAX_PARTY = 4;
 
 /*******************************************************************************
- * Save Data Structure
+ * Save Data Structure (original release, version 1)
  *
- * Contains all data needed to restore game state.
+ * Layout written by the first release. Same fields as version 2 except
+ * the abilities, which are stored as up to 20 ability code strings.
  ******************************************************************************/
-struct SaveData {
+struct SaveDataV1 {
     // Header
     char signature[8];          // "DEXODUS" + version
     int version;                // Save format version
@@ -73,6 +98,74 @@ struct SaveData {
     int eventsTriggered;
 };
 
+/*******************************************************************************
+ * Save Data Structure (legacy, version 2)
+ *
+ * Fixed-size layout written by older builds as one raw struct. Only read
+ * now, by the legacy path in decodeSave().
+ ******************************************************************************/
+struct SaveData {
+    // Header
+    char signature[8];          // "DEXODUS" + version
+    int version;                // Save format version
+    time_t saveTime;            // When saved
+
+    // Player data
+    char playerName[32];
+    int health;
+    int maxHealth;
+    int level;
+    int experience;
+    int attackPower;
+    int defense;
+    int speed;
+    int hackingSkill;
+    int skillPoints;
+
+    // Location
+    char currentSector[64];
+
+    // Inventory (simplified - stores item codes)
+    int inventoryCount;
+    char inventoryCodes[50][32];
+    int inventoryQuantities[50];
+
+    // Abilities (unlocked bitset keyed by ability index, see AbilityProgress)
+    int abilityCount;           // Abilities in the tree when saved
+    int unlockedAbilityCount;
+    unsigned long long unlockedAbilities[SAVE_ABILITY_WORDS];
+
+    // Game state
+    int turnCount;
+    int sectorsVisited;
+    int enemiesDefeated;
+    int eventsTriggered;
+};
+
+/*******************************************************************************
+ * Session Statistics
+ *
+ * Counters Game keeps for the current run (STAT chunk) and its recruited
+ * Awakened (PRTY chunk; Game rebuilds the party from them on load). The
+ * event log itself is saved separately (EVNT chunk).
+ ******************************************************************************/
+struct SessionStats {
+    int turnCount;
+    int sectorsExplored;
+    int enemiesDefeated;
+    int hacksCompleted;
+    int eventsTriggered;
+
+    // Party, one entry per ally
+    int partyCount;
+    std::string partyNames[SAVE_MAX_PARTY];
+    int partySpecialties[SAVE_MAX_PARTY];   // Awakened::Specialty
+    int partyLoyalty[SAVE_MAX_PARTY];
+    int partyHealth[SAVE_MAX_PARTY];
+
+    SessionStats();
+};
+
 /*******************************************************************************
  * Config Data Structure
  *
@@ -92,6 +185,7 @@ struct ConfigData {
     // Gameplay settings
     int difficulty;             // 1=Easy, 2=Normal, 3=Hard
     bool autoSave;
+    bool compressSaves;         // Compress save bodies (SaveCompress.h)
 };
 
 /*******************************************************************************
@@ -102,23 +196,45 @@ struct ConfigData {
  * Operations:
  * - saveGame(): Write current state to file
  * - loadGame(): Read state from file
+ * - autoSave(): Snapshot now, write on a background thread
  * - saveConfig(): Write settings to config
- * - loadConfig(): Read settings from config
- * - listSaves(): Get available save files
+ * - loadConfig(): Read settings from config (ConfigFile.h)
+ * - reloadConfigIfChanged(): Re-read config after an outside edit
+ * - listSaves(): Scan the save directory, newest first (SaveIndex.h)
  ******************************************************************************/
 class SaveLoadManager {
 private:
     std::string savePath;       // Directory for save files
     std::string configPath;     // Path to config file
+    long long configSize;       // Size and mtime of config.ini when last read or
+    long long configModified;   // written (-1: none), checked for hot reload
     bool initialized;
+    bool compressSaves;         // Newly written saves use ZBLK blocks
+    AutoSaveWriter* autoSaveWriter;     // Background writer (created on first auto-save)
+    int reportedAutoSaveFailures;
+    SaveJournal* quickJournal;          // Delta journals of the two frequent slots
+    SaveJournal* autoJournal;
+    SaveIndex* saveIndex;               // Cached slot metadata (saves.idx)
 
     // Helper functions
-    bool writePlayerData(std::ofstream& file, Player* player);
-    bool readPlayerData(std::ifstream& file, Player* player);
-    bool writeInventoryData(std::ofstream& file, Inventory* inventory);
-    bool readInventoryData(std::ifstream& file, Inventory* inventory);
-    bool writeAbilityData(std::ofstream& file, AbilityTree* abilities);
-    bool readAbilityData(std::ifstream& file, AbilityTree* abilities);
+    // captureState skips the sections not in sections; events newer than
+    // eventsFrom are captured (all of them when eventsFrom is 0)
+    void captureState(SaveState& state, Player* player, Inventory* inventory,
+                      AbilityTree* abilities, GridMap* map, EventLog* events,
+                      const SessionStats& stats, unsigned int sections, int eventsFrom) const;
+    void applyState(const SaveState& state, Player* player, Inventory* inventory,
+                    AbilityTree* abilities, GridMap* map, EventLog* events,
+                    SessionStats& stats, const ItemDatabase* items) const;
+    void applyInventory(const SaveState& state, Inventory* inventory,
+                        const ItemDatabase* items) const;
+    void applySectors(const SaveState& state, GridMap* map) const;
+    void applyEvents(const SaveState& state, EventLog* events) const;
+
+    // Journaled save: base snapshot the first time, delta records after
+    bool journalSave(SaveJournal* journal, Player* player, Inventory* inventory,
+                     AbilityTree* abilities, GridMap* map, EventLog* events,
+                     const SessionStats& stats);
+    void reportAutoSaveFailures();         // Warn and reset the journals on new failures
 
     // Private constructor (Singleton)
     SaveLoadManager();
@@ -138,48 +254,63 @@ public:
     bool initialize(const std::string& saveDirectory);
 
     // Save Operations
-    // Step 1: Open file for binary writing
-    // Step 2: Write signature and version
-    // Step 3: Serialize player data
-    // Step 4: Serialize inventory
-    // Step 5: Serialize abilities
-    // Step 6: Serialize game state
-    // Step 7: Close file
+    // Step 1: Capture player, map, inventory, abilities, events, statistics, party
+    // Step 2: Encode as chunks (SaveFormat.h)
+    // Step 3: Write the bytes
     bool saveGame(const std::string& filename, Player* player,
                   Inventory* inventory, AbilityTree* abilities,
-                  GridMap* map, int turnCount);
+                  GridMap* map, EventLog* events, const SessionStats& stats);
 
     // Load Operations
-    // Step 1: Open file for binary reading
-    // Step 2: Verify signature and version
-    // Step 3: Deserialize player data
-    // Step 4: Deserialize inventory
-    // Step 5: Deserialize abilities
-    // Step 6: Deserialize game state
-    // Step 7: Close file
+    // Step 1: Map the file (SaveView.h)
+    // Step 2: Decode (chunked or legacy version 1/2), replay "<slot>.jnl"
+    // Step 3: Restore player, map, inventory (items resolved through the
+    //         ItemDatabase), abilities, events, statistics, party
     bool loadGame(const std::string& filename, Player* player,
                   Inventory* inventory, AbilityTree* abilities,
-                  GridMap* map, int& turnCount);
+                  GridMap* map, EventLog* events, SessionStats& stats,
+                  const ItemDatabase* items);
+
+    // Preview: INFO plus the SaveSection bits in sections, journal replayed,
+    // nothing restored (cost does not grow with the save's size)
+    bool previewSave(const std::string& filename, SaveState& state,
+                     unsigned int sections = 0) const;
 
     // Config Operations
+    // loadConfig starts from the defaults, so missing keys keep them
     bool saveConfig(const ConfigData& config);
     bool loadConfig(ConfigData& config);
+    // Stat config.ini; if it changed since the last load or save, load it
+    // again (true = config was reloaded)
+    bool reloadConfigIfChanged(ConfigData& config);
 
     // Utility
     bool saveExists(const std::string& filename) const;
     bool deleteSave(const std::string& filename);
-    std::string* listSaves(int& outCount) const;
-    std::string getSaveInfo(const std::string& filename) const;
+    std::string* listSaves(int& outCount) const;        // Newest first, caller deletes[]
+    std::string getSaveInfo(const std::string& filename) const;     // From the index,
+                                                                    // damaged slots marked
 
-    // Quick save/load
+    // Quick save/load (journaled, non-blocking, see SaveJournal.h)
     bool quickSave(Player* player, Inventory* inventory,
-                   AbilityTree* abilities, GridMap* map, int turnCount);
+                   AbilityTree* abilities, GridMap* map, EventLog* events,
+                   const SessionStats& stats);
     bool quickLoad(Player* player, Inventory* inventory,
-                   AbilityTree* abilities, GridMap* map, int& turnCount);
+                   AbilityTree* abilities, GridMap* map, EventLog* events,
+                   SessionStats& stats, const ItemDatabase* items);
 
-    // Auto-save
+    // Auto-save (journaled, non-blocking)
+    // Step 1: Capture and encode what changed on the calling thread
+    // Step 2: Queue the bytes for the background writer (AutoSave.h)
     bool autoSave(Player* player, Inventory* inventory,
-                  AbilityTree* abilities, GridMap* map, int turnCount);
+                  AbilityTree* abilities, GridMap* map, EventLog* events,
+                  const SessionStats& stats);
+    void flushAutoSave();       // Wait until queued auto-saves are on disk
+    void beginSession();        // New game: next journaled saves write a full base
+
+    // Compression of newly written saves (loading handles both)
+    void setCompression(bool enabled);
+    bool isCompressionEnabled() const;
 
     // Getters
     std::string getSavePath() const;
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * SaveView.h - Memory-Mapped Save Files with Lazy Per-Section Decoding
+ *
+ * CONCEPT: Zero-copy reads over a read-only file mapping
+ *
+ * MappedFile maps a whole file read-only (mmap / MapViewOfFile). Nothing is
+ * read up front: the OS pages bytes in as the decoder touches them, so the
+ * cost of opening a save does not depend on its size. Files under 64 KiB
+ * are simply read, which is cheaper than setting up a mapping.
+ *
+ * SaveView decodes a chunked save straight from the mapping:
+ *
+ *   readInfo()   the INFO chunk right after the version - O(1)
+ *   load()       INFO, JGEN and the requested SaveSection bits only
+ *   findChunk()  a chunk's payload in place (pointer + length, no copy)
+ *
+ * The chunk directory (tag, offset, length of every top-level chunk) is
+ * built on first use by stepping over chunk headers, never payloads; a
+ * chunk's CRC is checked when it is decoded. The
+ * body of a compressed save is one ZBLK stream, so load() decompresses the
+ * blocks in order but still decodes only the requested sections.
+ *
+ * Saves are only ever replaced by rename and journals only grow, so a
+ * mapping never sees its file shrink underneath it.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef SAVEVIEW_H
+#define SAVEVIEW_H
+
+#include "SaveFormat.h"
+#include <string>
+#include <cstddef>
+
+/*******************************************************************************
+ * MappedFile - Read-only view of a whole file
+ ******************************************************************************/
+class MappedFile {
+private:
+    const unsigned char* data;
+    std::size_t size;
+    bool mapped;                // false: bytes live in buffer
+    std::string buffer;         // Copy of small files (or when mapping fails)
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    // Prevent copying (owns the mapping)
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Map path (small files are read); false if it cannot be opened
+    bool open(const std::string& path);
+    void close();
+
+    const unsigned char* getData() const;
+    std::size_t getSize() const;
+    bool isMapped() const;
+};
+
+/*******************************************************************************
+ * SaveChunkRef - Where one top-level chunk's payload sits in the file
+ ******************************************************************************/
+struct SaveChunkRef {
+    unsigned int tag;
+    std::size_t start;          // Chunk header (the CRC covers start .. offset + length)
+    std::size_t offset;         // Payload
+    std::size_t length;
+};
+
+/*******************************************************************************
+ * SaveView - Lazy decoder over a mapped save
+ ******************************************************************************/
+class SaveView {
+private:
+    MappedFile file;
+    int version;                // 0 = not open
+    std::size_t bodyOffset;     // First chunk (after magic + version)
+
+    // Directory (built by the first load / findChunk)
+    SaveChunkRef* chunks;
+    int chunkCount;
+    int chunkCapacity;
+    bool indexed;
+    bool ended;                 // END chunk reached (file is complete)
+    std::size_t blockOffset;    // First ZBLK chunk (0 = not compressed)
+
+    // Helper: Walk the chunk headers up to END or the first ZBLK
+    bool buildDirectory();
+
+public:
+    SaveView();
+    ~SaveView();
+
+    // Prevent copying (owns the mapping and directory)
+    SaveView(const SaveView&) = delete;
+    SaveView& operator=(const SaveView&) = delete;
+
+    // Map the file and check magic + version (legacy versions 1 and 2 included)
+    bool open(const std::string& path);
+    void close();
+
+    // INFO only (player name, level, save time, turn) - one chunk, any file size
+    bool readInfo(SaveState& state) const;
+
+    // LOAD: INFO, JGEN and the sections in sections (state.sections is set to them)
+    // Step 1: Index the chunk headers (once)
+    // Step 2: Raw body - decode the wanted chunks where they lie
+    // Step 3: Compressed body - stream the blocks, skipping unwanted sections
+    bool load(SaveState& state, unsigned int sections);
+
+    // Payload of the first top-level chunk with tag (nullptr if absent or damaged)
+    const unsigned char* findChunk(unsigned int tag, std::size_t& length);
+
+    // Check every chunk's CRC (touches the whole file, decodes nothing)
+    SaveIntegrity verify() const;
+
+    // Access
+    int getVersion() const;
+    bool isCompressed();
+    const unsigned char* getData() const;
+    std::size_t getSize() const;
+};
+
+#endif // SAVEVIEW_H
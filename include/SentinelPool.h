@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * SentinelPool.h - Slab Allocator for Sentinel Objects
+ *
+ * CONCEPT: Object pool with an intrusive free list
+ *
+ * Sentinel overrides class operator new / delete to take memory from this
+ * pool, so `new Sentinel(...)` and `delete sentinel` (e.g. in SectorNode)
+ * are unchanged. Blocks come from slabs that hold many Sentinels each:
+ *
+ *   slab:  [next slab | block | block | block | ... ]
+ *   free:  block -> block -> block -> nullptr   (link stored in the block)
+ *
+ * A released block goes back on the free list and is reused. Slabs are
+ * only returned to the system when the pool is destroyed with no live
+ * Sentinels. reserve(n) makes sure n blocks are free, allocating at most
+ * one slab, so a whole wave can be spawned with one allocator call.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef SENTINELPOOL_H
+#define SENTINELPOOL_H
+
+#include <cstddef>
+
+class SentinelPool {
+private:
+    static const int BLOCKS_PER_SLAB = 32;
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    std::size_t blockSize;      // sizeof(Sentinel), rounded to alignment
+    std::size_t headerSize;     // Slab header (next-slab link), aligned
+    void* slabs;                // Singly linked list of slabs
+    FreeBlock* freeList;        // Blocks ready to hand out
+    int freeCount;
+    int liveCount;
+    int slabCount;
+
+    // Private constructor (Singleton)
+    SentinelPool();
+
+    // Helper: Allocate one slab of blockCount blocks onto the free list
+    void addSlab(int blockCount);
+
+public:
+    static SentinelPool& getInstance();
+    ~SentinelPool();
+
+    // Prevent copying
+    SentinelPool(const SentinelPool&) = delete;
+    SentinelPool& operator=(const SentinelPool&) = delete;
+
+    // Block lifetime (used by Sentinel::operator new / delete)
+    void* allocate();
+    void release(void* block);
+
+    // Ensure at least count free blocks (one slab allocation at most)
+    void reserve(int count);
+
+    // Statistics
+    std::size_t getBlockSize() const;
+    int getLiveCount() const;
+    int getFreeCount() const;
+    int getSlabCount() const;
+};
+
+#endif // SENTINELPOOL_H
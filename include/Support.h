@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Support.h - Awakened Ally Support Engine
+ *
+ * CONCEPT: Batched party updates
+ *
+ * Once per round the engine makes a single pass over the party (player +
+ * allies) and the enemies and records a summary: the most injured party
+ * member and the weakest enemy. Each ally turn then decides from that
+ * summary in O(1) instead of rescanning the party:
+ *
+ *   round start   summarize()           O(party + enemies)
+ *   ally turns    act(ally) x allies    O(1) each, queue heals / buffs
+ *   round end     flush()               O(party), apply the whole batch
+ *
+ * Effectiveness scales with loyalty (loyalty / 10 + 1), and allies with
+ * low loyalty sometimes hesitate. Heals and buffs wait in the pending batch
+ * until flush(). A WARRIOR strike lands immediately.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#ifndef SUPPORT_H
+#define SUPPORT_H
+
+#include "Entity.h"
+
+class SupportEngine {
+private:
+    static const int MAX_BONUS = 10;    // Cap for each accumulated buff
+
+    // Encounter (arrays owned by the engine, entities are not)
+    Entity** party;             // [0] = player, then allies
+    int* partySlots;
+    int partyCount;
+    Entity** enemies;
+    int* enemySlots;
+    int enemyCount;
+
+    // Round summary
+    int mostInjured;            // Party index below 75% health, lowest ratio (-1 = none)
+    int weakestEnemy;           // Living enemy index with least health (-1 = none)
+
+    // Pending batch (applied by flush)
+    int* pendingHeal;           // Per party member
+    int partyHeal;              // For every living member
+    int pendingAttackBonus;
+    int pendingEnemyPenalty;
+
+    // Active effects for the rest of the encounter
+    int attackBonus;            // Added to player attacks
+    int enemyAttackPenalty;     // Subtracted from Sentinel attacks
+
+    // Helpers
+    void release();
+    void summarizeEnemies();
+
+public:
+    SupportEngine();
+    ~SupportEngine();
+
+    // Prevent copying
+    SupportEngine(const SupportEngine&) = delete;
+    SupportEngine& operator=(const SupportEngine&) = delete;
+
+    // Encounter lifetime
+    void begin(Entity* player, Entity** allies, int allyCount,
+               Entity** enemies, int enemyCount);
+    void end();                 // Drops any unapplied batch
+
+    // Round processing
+    // Step 1: summarize() - one pass over party and enemies
+    // Step 2: act() per ally turn - decide from the summary, queue effects
+    // Step 3: flush() - apply queued heals and buffs, then re-summarize
+    void summarize();
+    void act(Awakened& ally);
+    void flush();
+
+    // Active effects
+    int getAttackBonus() const;
+    int getEnemyAttackPenalty() const;
+};
+
+#endif // SUPPORT_H
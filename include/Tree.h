@@ -11,7 +11,9 @@
  * - Hierarchical nature matches skill prerequisites
  * - Parent-child relationship models dependency
  * - Flat list can't represent "requires X to unlock Y"
- * - Graph would be overkill for clear hierarchies
+ *
+ * The tree gives the layout; extra prerequisites (addPrerequisite) turn the
+ * dependency structure into a DAG, so an ability may need several others.
  *
  * Author: Alif Harriz Jeffery | 102782711
  * Course: COS30008 Data Structures and Patterns
@@ -40,28 +42,79 @@ struct Ability {
 
     int cost;                   // Skill points to unlock
     int power;                  // Effect strength
-    bool unlocked;              // Has player unlocked this?
+    bool multiTarget;           // Swarm ability: hits every standing enemy
 
     Ability();
     Ability(const std::string& code, const std::string& name,
-            const std::string& desc, Type type, int cost, int power);
+            const std::string& desc, Type type, int cost, int power,
+            bool multiTarget = false);
 };
 
 /*******************************************************************************
  * CONCEPT: TREE - Ability Node
  *
- * Each node contains an ability and pointers to child abilities.
- * Using binary tree structure (left = first child, right = sibling)
- * This allows variable number of children while using binary pointers.
+ * Each node contains an ability and the indices of its relatives inside the
+ * tree's node array (-1 = none). Using binary tree structure
+ * (left = first child, right = sibling path) with array indices instead of
+ * pointers keeps the whole tree in one contiguous allocation.
  ******************************************************************************/
 struct AbilityNode {
     Ability ability;            // The ability at this node
-    AbilityNode* left;          // Left child (first prerequisite path)
-    AbilityNode* right;         // Right child (second prerequisite path)
-    AbilityNode* parent;        // Parent node (for prerequisite checking)
+    int left;                   // Left child index (first prerequisite path)
+    int right;                  // Right child index (second prerequisite path)
+    int parent;                 // Parent index (for prerequisite checking)
+    int depth;                  // Distance from the root (for display)
+    unsigned int codeHash;      // djb2 hash of ability.code
+
+    int firstPrereq;            // Head of prerequisite edge list (-1 = none)
+    int firstDependent;         // Head of dependent edge list (-1 = none)
+
+    AbilityNode();
+    AbilityNode(const Ability& ability, int parent, int depth, unsigned int codeHash);
+};
+
+/*******************************************************************************
+ * AbilityProgress - One player's unlock state
+ *
+ * The tree only holds ability definitions; everything that differs between
+ * players lives here, keyed by node index:
+ * - unlockedBits[]: dense bitset, bit i set = node i unlocked
+ * - unmetPrereqs[] / eligible[]: availability bookkeeping (see AbilityTree)
+ *
+ * Copying is a memcpy of the arrays, so a build can be cloned for a
+ * simulation or saved as raw words; diffCount() compares two builds with
+ * XOR + popcount.
+ ******************************************************************************/
+struct AbilityProgress {
+    static const int BITS_PER_WORD = 64;
+
+    unsigned long long* unlockedBits;   // Bit i set = node i unlocked
+    int* unmetPrereqs;          // Per node: prerequisites still locked
+    int* eligible;              // Locked nodes with no unmet prerequisites, by cost
+    int capacity;               // Node slots allocated
+    int wordCount;              // Words in unlockedBits
+    int unlockedCount;          // Set bits
+    int skillPoints;            // Available skill points
+    int eligibleCount;          // Entries in eligible[]
+    int availableCount;         // Prefix of eligible[] with cost <= skillPoints
+
+    AbilityProgress();
+    ~AbilityProgress();
+    AbilityProgress(const AbilityProgress& other);
+    AbilityProgress& operator=(const AbilityProgress& other);
+
+    // Bit access (indices outside [0, capacity) read as locked, are not set)
+    bool isUnlocked(int index) const;
+    void setUnlocked(int index);
+
+    // Sizing
+    void resize(int newCapacity);       // Grow, keeping the current state
+    void reset(int newCapacity);        // Drop unlocks and bookkeeping (keeps skill points)
 
-    AbilityNode(const Ability& ability);
-    ~AbilityNode();
+    // Abilities unlocked in exactly one of the two builds
+    int diffCount(const AbilityProgress& other) const;
+
+    static int wordsFor(int capacity);
 };
 
 /*******************************************************************************
@@ -69,6 +122,7 @@ struct AbilityNode {
  *
  * Operations:
  * - insert(ability, parentCode): Add ability as child of parent
+ * - addPrerequisite(code, prereqCode): Require a further ability (DAG edge)
  * - unlock(code): Unlock ability if prerequisites met
  * - canUnlock(code): Check if prerequisites are satisfied
  * - findAbility(code): Locate ability by code
@@ -82,58 +136,121 @@ struct AbilityNode {
  *              /      \           /        \
  *        [Overdrive] [Stealth] [Firewall] [Regen]
  *
- * Traversal: Pre-order for displaying tree structure
+ * Storage (flattened):
+ * - nodes[]: contiguous array in insertion order, so an ability's index
+ *   never changes once inserted
+ * - codeIndex[]: open-addressing hash table (djb2, linear probing)
+ *   mapping code -> node index, so lookups are O(1) instead of a DFS
+ * - preorder[]: node indices in pre-order, rebuilt only after inserts;
+ *   display and collection are linear scans over it
+ *
+ * Prerequisites (DAG):
+ * - Every tree parent is a prerequisite; addPrerequisite adds more.
+ *   Edges live in one pooled array as per-node linked lists, both
+ *   directions (prerequisites of a node, dependents of a node).
+ * - Each node counts its unmet prerequisites. Unlocking a node decrements
+ *   its dependents; a dependent reaching zero becomes "eligible".
+ * - eligible[] is kept sorted by cost, so the abilities affordable right
+ *   now are its first availableCount entries. unlock() and addSkillPoints()
+ *   move that boundary, and getAvailableAbilities() is O(answer size).
+ *
+ * Per-player state:
+ * - The definitions above are shared; unlocks, skill points and the
+ *   availability bookkeeping live in an AbilityProgress.
+ * - The tree owns one AbilityProgress (the current player), used by the
+ *   code-based interface. The index-based overloads take any progress
+ *   created by createProgress(), so simulations can run against one tree.
+ *
+ * Ability pointers returned by findAbility() and the get*Abilities()
+ * arrays stay valid until the next insert (the node array may grow).
  ******************************************************************************/
 class AbilityTree {
 private:
-    AbilityNode* root;          // Root of the tree
+    AbilityNode* nodes;         // Node storage (insertion order, root at 0)
+    int capacity;               // Allocated node slots
     int totalAbilities;         // Count of all abilities
-    int unlockedCount;          // Count of unlocked abilities
-    int skillPoints;            // Available skill points
+
+    int* codeIndex;             // Hash slots holding node indices (-1 = empty)
+    int codeCapacity;           // Slot count (power of two)
+
+    mutable int* preorder;      // Node indices in pre-order
+    mutable bool preorderDirty; // Rebuild needed after an insert
+
+    int* edgeNode;              // Edge pool: node at the other end
+    int* edgeNext;              // Edge pool: next edge in the same list
+    int edgeCount;              // Edge slots used
+    int edgeCapacity;           // Edge slots allocated
+
+    AbilityProgress progress;   // Current player's unlock state
 
     // Helper functions
-    AbilityNode* findNode(AbilityNode* node, const std::string& code) const;
-    void displayNode(AbilityNode* node, int depth) const;
-    void deleteTree(AbilityNode* node);
-    void collectUnlocked(AbilityNode* node, Ability** arr, int& index) const;
-    void collectAvailable(AbilityNode* node, Ability** arr, int& index) const;
+    static unsigned int hashCode(const std::string& code);
+    int findIndex(const std::string& code) const;
+    int addNode(const Ability& ability, int parent, int depth);
+    void indexCode(int nodeIndex);
+    void growNodes();
+    void growCodeIndex();
+    void rebuildPreorder() const;
+    void clear();
+
+    // Prerequisite helpers
+    void growEdges();
+    void addEdge(int prereqIndex, int index);
+    bool hasPrerequisite(int index, int prereqIndex) const;
+    bool dependsOn(int index, int prereqIndex) const;
+    int firstUnmetPrerequisite(const AbilityProgress& state, int index) const;
+    int eligibleSlot(const AbilityProgress& state, int index) const;
+    void makeEligible(AbilityProgress& state, int index) const;
+    void removeEligible(AbilityProgress& state, int index) const;
+    void updateAvailable(AbilityProgress& state) const;
 
 public:
     // Constructor - initializes empty tree
     AbilityTree();
 
-    // Destructor - frees all nodes
+    // Destructor - frees node, index and edge arrays
     ~AbilityTree();
 
-    // Set root ability
+    // Prevent copying (owns raw arrays)
+    AbilityTree(const AbilityTree&) = delete;
+    AbilityTree& operator=(const AbilityTree&) = delete;
+
+    // Set root ability (clears the tree)
     void setRoot(const Ability& ability);
 
     // Insert: Add ability as child of parent
-    // Step 1: Find parent node by code
-    // Step 2: Create new AbilityNode
+    // Step 1: Look up parent index by code
+    // Step 2: Append a new node to the array
     // Step 3: Attach as left or right child
-    // Step 4: Set parent pointer
+    // Step 4: Record parent index and code hash
     // Step 5: Increment total count
     bool insert(const Ability& ability, const std::string& parentCode, bool asLeftChild);
 
+    // AddPrerequisite: Require prereqCode before code can be unlocked
+    // Step 1: Look up both abilities
+    // Step 2: Reject duplicates and edges that would form a cycle
+    // Step 3: Link the edge, count it as unmet if prereq is locked
+    bool addPrerequisite(const std::string& code, const std::string& prereqCode);
+
     // Find: Locate ability by code
-    // Step 1: Start at root
-    // Step 2: Recursively search left and right subtrees
-    // Step 3: Return node if found, nullptr otherwise
+    // Step 1: Hash the code
+    // Step 2: Probe the code index until the code or an empty slot is found
+    // Step 3: Return the node's ability, nullptr otherwise
     Ability* findAbility(const std::string& code) const;
 
     // CanUnlock: Check if ability can be unlocked
     // Step 1: Find the ability node
-    // Step 2: Check if parent is unlocked (or is root)
+    // Step 2: Check that no prerequisite is still locked
     // Step 3: Check if player has enough skill points
     // Step 4: Check if not already unlocked
     bool canUnlock(const std::string& code) const;
 
     // Unlock: Attempt to unlock an ability
-    // Step 1: Verify canUnlock returns true
+    // Step 1: Verify the node can be unlocked
     // Step 2: Deduct skill points
     // Step 3: Mark ability as unlocked
     // Step 4: Increment unlocked count
+    // Step 5: Release dependents whose last prerequisite this was
     bool unlock(const std::string& code);
 
     // Display functions
@@ -145,14 +262,31 @@ public:
     void addSkillPoints(int points);
     int getSkillPoints() const;
 
+    // Per-player state (index-based, silent - for simulation and saving)
+    int getIndex(const std::string& code) const;            // -1 if unknown
+    AbilityProgress* createProgress() const;                // Root unlocked, 0 points
+    void recompute(AbilityProgress& state) const;           // Rebuild bookkeeping from bits
+    // false for an index outside the tree or progress sized for a smaller tree
+    bool canUnlock(const AbilityProgress& state, int index) const;
+    bool unlock(AbilityProgress& state, int index) const;
+    void addSkillPoints(AbilityProgress& state, int points) const;
+
+    // Current player's state
+    const AbilityProgress& getProgress() const;
+    void setProgress(const AbilityProgress& state);
+    void restoreUnlocked(const unsigned long long* bits, int words, int points);
+    int restoreUnlocked(const std::string* codes, int count, int points);
+
     // Getters
     int getTotalAbilities() const;
     int getUnlockedCount() const;
     AbilityNode* getRoot() const;
+    const AbilityNode* getNode(int index) const;
 
     // Get arrays of abilities
-    Ability** getUnlockedAbilities(int& outCount) const;
-    Ability** getAvailableAbilities(int& outCount) const;
+    Ability** getUnlockedAbilities(int& outCount) const;    // Pre-order
+    Ability** getAvailableAbilities(int& outCount) const;   // Cheapest first
+    int getAvailableCount() const;
 
     // Initialize default ability tree
     void initializeDefaultTree();
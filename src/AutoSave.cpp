@@ -0,0 +1,330 @@
+/*******************************************************************************
+ * AutoSave.cpp - Background Save Writer Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/AutoSave.h"
+#include "../include/SaveJournal.h"
+#include "../include/MemoryTracker.h"
+#include <cstdio>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*******************************************************************************
+ * ATOMIC FILE REPLACEMENT
+ ******************************************************************************/
+
+#ifdef _WIN32
+
+// Helper: WriteFile until the whole buffer is out, then FlushFileBuffers
+// (the Windows fsync: data leaves the OS cache before this returns)
+static bool writeAllDurable(HANDLE file, const char* data, std::size_t size) {
+    std::size_t offset = 0;
+    while (offset < size) {
+        std::size_t remaining = size - offset;
+        DWORD chunk = remaining > 0x40000000 ? 0x40000000 : static_cast<DWORD>(remaining);
+        DWORD written = 0;
+        if (!WriteFile(file, data + offset, chunk, &written, nullptr) || written == 0) {
+            return false;
+        }
+        offset += written;
+    }
+    return FlushFileBuffers(file) != 0;
+}
+
+// Windows: write + FlushFileBuffers the temp file, then replace with write-through
+// Step 1: Write the whole buffer to "<path>.tmp" and flush it to disk
+// Step 2: MoveFileEx with MOVEFILE_WRITE_THROUGH (returns once the rename is on disk)
+bool writeFileAtomic(const std::string& path, const char* data, std::size_t size) {
+    std::string tempPath = path + ".tmp";
+
+    // Step 1
+    HANDLE file = CreateFileA(tempPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    bool written = writeAllDurable(file, data, size);
+    CloseHandle(file);
+    if (!written) {
+        DeleteFileA(tempPath.c_str());
+        return false;
+    }
+
+    // Step 2
+    if (!MoveFileExA(tempPath.c_str(), path.c_str(),
+                     MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        DeleteFileA(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Windows: FILE_APPEND_DATA write, then FlushFileBuffers (a crash can only
+// cut the tail record)
+bool appendFileDurable(const std::string& path, const char* data, std::size_t size) {
+    HANDLE file = CreateFileA(path.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ, nullptr,
+                              OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    bool ok = writeAllDurable(file, data, size);
+    CloseHandle(file);
+    return ok;
+}
+
+#else
+
+// POSIX: write + fsync the temp file, rename over the target, fsync the directory
+// Step 1: Write the whole buffer to "<path>.tmp"
+// Step 2: fsync so the data is on disk before the rename is
+// Step 3: rename (atomic: readers see the old file or the new one, never half)
+// Step 4: fsync the directory so the rename itself survives a crash
+bool writeFileAtomic(const std::string& path, const char* data, std::size_t size) {
+    std::string tempPath = path + ".tmp";
+
+    // Step 1
+    int fd = open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+
+    std::size_t offset = 0;
+    while (offset < size) {
+        ssize_t count = write(fd, data + offset, size - offset);
+        if (count <= 0) {
+            close(fd);
+            unlink(tempPath.c_str());
+            return false;
+        }
+        offset += static_cast<std::size_t>(count);
+    }
+
+    // Step 2
+    if (fsync(fd) != 0) {
+        close(fd);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    close(fd);
+
+    // Step 3
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        unlink(tempPath.c_str());
+        return false;
+    }
+
+    // Step 4 (best effort - not every filesystem allows fsync on a directory)
+    std::size_t slash = path.find_last_of('/');
+    std::string directory = slash == std::string::npos ? "." : path.substr(0, slash + 1);
+    int dirFd = open(directory.c_str(), O_RDONLY);
+    if (dirFd >= 0) {
+        fsync(dirFd);
+        close(dirFd);
+    }
+    return true;
+}
+
+// POSIX: O_APPEND write, then fsync (a crash can only cut the tail record)
+bool appendFileDurable(const std::string& path, const char* data, std::size_t size) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0) return false;
+
+    std::size_t offset = 0;
+    while (offset < size) {
+        ssize_t count = write(fd, data + offset, size - offset);
+        if (count <= 0) {
+            close(fd);
+            return false;
+        }
+        offset += static_cast<std::size_t>(count);
+    }
+
+    bool ok = fsync(fd) == 0;
+    close(fd);
+    return ok;
+}
+
+#endif
+
+// Whole file into memory
+bool readFileBytes(const std::string& path, std::string& bytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file.seekg(0, std::ios::end);
+    std::streamoff length = file.tellg();
+    file.seekg(0, std::ios::beg);
+    if (length < 0) {
+        return false;
+    }
+
+    bytes.resize(static_cast<std::size_t>(length));
+    if (length > 0) {
+        file.read(&bytes[0], length);
+    }
+    return static_cast<bool>(file);
+}
+
+/*******************************************************************************
+ * AUTO-SAVE WRITER
+ ******************************************************************************/
+
+// Constructor
+AutoSaveWriter::AutoSaveWriter()
+    : head(nullptr), tail(nullptr), writing(false), stopping(false),
+      writtenCount(0), failedCount(0), replacedCount(0) {
+    worker = std::thread(&AutoSaveWriter::run, this);
+}
+
+// Destructor
+AutoSaveWriter::~AutoSaveWriter() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_one();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+// Helper: Append to the FIFO
+void AutoSaveWriter::push(Job* job) {
+    job->next = nullptr;
+    if (tail == nullptr) {
+        head = job;
+    } else {
+        tail->next = job;
+    }
+    tail = job;
+}
+
+// SUBMIT: Whole-file write (replaces a queued write of the same file)
+void AutoSaveWriter::submit(const std::string& path, std::string& bytes) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (tail != nullptr && tail->type == JobType::WRITE && tail->path == path) {
+            tail->bytes.swap(bytes);
+            replacedCount++;
+        } else {
+            Job* job = new Job();
+            job->type = JobType::WRITE;
+            job->path = path;
+            job->bytes.swap(bytes);
+            job->generation = 0;
+            push(job);
+        }
+    }
+    bytes.clear();
+    wake.notify_one();
+}
+
+// SUBMIT APPEND: Journal record (joins a queued append to the same file)
+void AutoSaveWriter::submitAppend(const std::string& path, std::string& bytes) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (tail != nullptr && tail->type == JobType::APPEND && tail->path == path) {
+            tail->bytes += bytes;
+        } else {
+            Job* job = new Job();
+            job->type = JobType::APPEND;
+            job->path = path;
+            job->bytes.swap(bytes);
+            job->generation = 0;
+            push(job);
+        }
+    }
+    bytes.clear();
+    wake.notify_one();
+}
+
+// SUBMIT COMPACT: Fold the journal into a new base
+void AutoSaveWriter::submitCompact(const std::string& path, const std::string& journalPath,
+                                   unsigned long long generation) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        Job* job = new Job();
+        job->type = JobType::COMPACT;
+        job->path = path;
+        job->journalPath = journalPath;
+        job->generation = generation;
+        push(job);
+    }
+    wake.notify_one();
+}
+
+// FLUSH: Wait for the writer to go idle
+void AutoSaveWriter::flush() {
+    std::unique_lock<std::mutex> guard(lock);
+    idle.wait(guard, [this] { return head == nullptr && !writing; });
+}
+
+// RUN: Writer thread loop
+// Step 1: Sleep until a job arrives (or stop is requested)
+// Step 2: Unlink the oldest job and run it without the lock
+// Step 3: Record the result and wake anyone flushing
+// Queued jobs are still run when stopping, so nothing submitted is lost.
+void AutoSaveWriter::run() {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+        // Step 1
+        wake.wait(guard, [this] { return head != nullptr || stopping; });
+        if (head == nullptr) break;
+
+        // Step 2
+        Job* job = head;
+        head = job->next;
+        if (head == nullptr) tail = nullptr;
+        writing = true;
+        guard.unlock();
+
+        bool ok = false;
+        switch (job->type) {
+            case JobType::WRITE:
+                ok = writeFileAtomic(job->path, job->bytes.data(), job->bytes.size());
+                break;
+            case JobType::APPEND:
+                ok = appendFileDurable(job->path, job->bytes.data(), job->bytes.size());
+                break;
+            case JobType::COMPACT:
+                ok = compactJournal(job->path, job->journalPath, job->generation);
+                break;
+        }
+        delete job;
+
+        // Step 3
+        guard.lock();
+        writing = false;
+        if (ok) {
+            writtenCount++;
+        } else {
+            failedCount++;
+        }
+        idle.notify_all();
+    }
+}
+
+// Statistics
+int AutoSaveWriter::getWrittenCount() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return writtenCount;
+}
+
+int AutoSaveWriter::getFailedCount() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return failedCount;
+}
+
+int AutoSaveWriter::getReplacedCount() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return replacedCount;
+}
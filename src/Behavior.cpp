@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * Behavior.cpp - Sentinel Behavior Tree Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/Behavior.h"
+#include "../include/MemoryTracker.h"
+#include <cstdlib>
+
+/*******************************************************************************
+ * SENTINEL BLACKBOARD
+ ******************************************************************************/
+
+SentinelBlackboard::SentinelBlackboard()
+    : targetSlot(-1), turnsInCombat(0), repairCooldown(0), analyzed(0),
+      planned(SentinelAction::ANALYZE) {
+}
+
+void SentinelBlackboard::engage(int target) {
+    targetSlot = target;
+    turnsInCombat = 0;
+    repairCooldown = 0;
+    analyzed = 0;
+    planned = SentinelAction::ANALYZE;
+}
+
+/*******************************************************************************
+ * BEHAVIOR TREE
+ ******************************************************************************/
+
+// Constructor
+BehaviorTree::BehaviorTree()
+    : nodes(nullptr), nodeCount(0), capacity(0), openCount(0) {
+}
+
+// Destructor
+BehaviorTree::~BehaviorTree() {
+    delete[] nodes;
+}
+
+// Helper: Add a node at the end of the array (doubling when full)
+int BehaviorTree::append(BehaviorNodeType type, unsigned char op, short param) {
+    if (nodeCount == capacity) {
+        int newCapacity = capacity == 0 ? 16 : capacity * 2;
+        BehaviorNode* grown = new BehaviorNode[newCapacity];
+        for (int i = 0; i < nodeCount; i++) {
+            grown[i] = nodes[i];
+        }
+        delete[] nodes;
+        nodes = grown;
+        capacity = newCapacity;
+    }
+
+    // Count as a child of the innermost open composite
+    if (openCount > 0) {
+        nodes[openNodes[openCount - 1]].childCount++;
+    }
+
+    BehaviorNode& node = nodes[nodeCount];
+    node.type = type;
+    node.op = op;
+    node.param = param;
+    node.childCount = 0;
+    node.size = 1;
+    return nodeCount++;
+}
+
+void BehaviorTree::beginSelector() {
+    if (openCount == MAX_DEPTH) return;
+    openNodes[openCount++] = append(BehaviorNodeType::SELECTOR, 0, 0);
+}
+
+void BehaviorTree::beginSequence() {
+    if (openCount == MAX_DEPTH) return;
+    openNodes[openCount++] = append(BehaviorNodeType::SEQUENCE, 0, 0);
+}
+
+// Close the innermost composite: its subtree is everything appended since
+void BehaviorTree::end() {
+    if (openCount == 0) return;
+    int index = openNodes[--openCount];
+    nodes[index].size = static_cast<short>(nodeCount - index);
+}
+
+void BehaviorTree::condition(BehaviorCondition condition, int param) {
+    append(BehaviorNodeType::CONDITION, static_cast<unsigned char>(condition),
+           static_cast<short>(param));
+}
+
+void BehaviorTree::action(SentinelAction action) {
+    append(BehaviorNodeType::ACTION, static_cast<unsigned char>(action), 0);
+}
+
+// Helper: Tick one subtree, returns success
+bool BehaviorTree::tick(int index, const BehaviorContext& context,
+                        const SentinelBlackboard& blackboard, SentinelAction& chosen) const {
+    const BehaviorNode& node = nodes[index];
+
+    switch (node.type) {
+        case BehaviorNodeType::SELECTOR:
+        case BehaviorNodeType::SEQUENCE: {
+            bool isSelector = node.type == BehaviorNodeType::SELECTOR;
+            int child = index + 1;
+            for (int i = 0; i < node.childCount; i++) {
+                bool ok = tick(child, context, blackboard, chosen);
+                if (isSelector && ok) return true;
+                if (!isSelector && !ok) return false;
+                child += nodes[child].size;
+            }
+            return !isSelector;
+        }
+
+        case BehaviorNodeType::CONDITION:
+            switch (static_cast<BehaviorCondition>(node.op)) {
+                case BehaviorCondition::SELF_HEALTH_BELOW:
+                    return context.health * 100 < context.maxHealth * node.param;
+                case BehaviorCondition::TARGET_HEALTH_BELOW:
+                    return context.targetHealth * 100 < context.targetMaxHealth * node.param;
+                case BehaviorCondition::AGGRESSION_ROLL:
+                    return rand() % 10 < context.aggression;
+                case BehaviorCondition::ANALYZED:
+                    return blackboard.analyzed != 0;
+                case BehaviorCondition::REPAIR_READY:
+                    return blackboard.repairCooldown == 0;
+            }
+            return false;
+
+        case BehaviorNodeType::ACTION:
+            chosen = static_cast<SentinelAction>(node.op);
+            return true;
+    }
+    return false;
+}
+
+// EVALUATE: Pick an action and update the blackboard
+// Step 1: Walk the array from the root
+// Step 2: Fall back to ANALYZE if no branch succeeds
+// Step 3: Record the choice, advance cooldowns
+SentinelAction BehaviorTree::evaluate(const BehaviorContext& context,
+                                      SentinelBlackboard& blackboard) const {
+    // Step 1 & 2
+    SentinelAction chosen = SentinelAction::ANALYZE;
+    if (nodeCount == 0 || !tick(0, context, blackboard, chosen)) {
+        chosen = SentinelAction::ANALYZE;
+    }
+
+    // Step 3
+    if (blackboard.turnsInCombat < 255) blackboard.turnsInCombat++;
+    if (chosen == SentinelAction::REPAIR) {
+        blackboard.repairCooldown = BehaviorLibrary::REPAIR_COOLDOWN;
+    } else if (blackboard.repairCooldown > 0) {
+        blackboard.repairCooldown--;
+    }
+    blackboard.analyzed = chosen == SentinelAction::ANALYZE ? 1 : 0;
+    blackboard.planned = chosen;
+    return chosen;
+}
+
+int BehaviorTree::getNodeCount() const { return nodeCount; }
+
+/*******************************************************************************
+ * BEHAVIOR LIBRARY
+ ******************************************************************************/
+
+// Constructor - one definition per Sentinel::Type
+BehaviorLibrary::BehaviorLibrary() {
+    MEM_SCOPE(MemSubsystem::ENTITY);
+
+    // SCOUT: probe first, then strike what it has studied
+    BehaviorTree& scout = trees[0];
+    scout.beginSelector();
+        scout.beginSequence();
+            scout.condition(BehaviorCondition::ANALYZED);
+            scout.action(SentinelAction::ATTACK);
+        scout.end();
+        scout.beginSequence();
+            scout.condition(BehaviorCondition::AGGRESSION_ROLL);
+            scout.action(SentinelAction::ATTACK);
+        scout.end();
+        scout.action(SentinelAction::ANALYZE);
+    scout.end();
+
+    // GUARDIAN: hold the line, repair when worn down
+    BehaviorTree& guardian = trees[1];
+    guardian.beginSelector();
+        guardian.beginSequence();
+            guardian.condition(BehaviorCondition::SELF_HEALTH_BELOW, 40);
+            guardian.condition(BehaviorCondition::REPAIR_READY);
+            guardian.action(SentinelAction::REPAIR);
+        guardian.end();
+        guardian.beginSequence();
+            guardian.condition(BehaviorCondition::AGGRESSION_ROLL);
+            guardian.action(SentinelAction::ATTACK);
+        guardian.end();
+        guardian.action(SentinelAction::ANALYZE);
+    guardian.end();
+
+    // ENFORCER: finish weakened targets, exploit analysis
+    BehaviorTree& enforcer = trees[2];
+    enforcer.beginSelector();
+        enforcer.beginSequence();
+            enforcer.condition(BehaviorCondition::TARGET_HEALTH_BELOW, 30);
+            enforcer.action(SentinelAction::HEAVY_ATTACK);
+        enforcer.end();
+        enforcer.beginSequence();
+            enforcer.condition(BehaviorCondition::ANALYZED);
+            enforcer.action(SentinelAction::HEAVY_ATTACK);
+        enforcer.end();
+        enforcer.beginSequence();
+            enforcer.condition(BehaviorCondition::AGGRESSION_ROLL);
+            enforcer.action(SentinelAction::ATTACK);
+        enforcer.end();
+        enforcer.action(SentinelAction::ANALYZE);
+    enforcer.end();
+
+    // ELITE: repairs, executes, never idles
+    BehaviorTree& elite = trees[3];
+    elite.beginSelector();
+        elite.beginSequence();
+            elite.condition(BehaviorCondition::SELF_HEALTH_BELOW, 25);
+            elite.condition(BehaviorCondition::REPAIR_READY);
+            elite.action(SentinelAction::REPAIR);
+        elite.end();
+        elite.beginSequence();
+            elite.condition(BehaviorCondition::TARGET_HEALTH_BELOW, 40);
+            elite.action(SentinelAction::HEAVY_ATTACK);
+        elite.end();
+        elite.beginSequence();
+            elite.condition(BehaviorCondition::ANALYZED);
+            elite.action(SentinelAction::HEAVY_ATTACK);
+        elite.end();
+        elite.action(SentinelAction::ATTACK);
+    elite.end();
+}
+
+// Singleton access
+BehaviorLibrary& BehaviorLibrary::getInstance() {
+    static BehaviorLibrary instance;
+    return instance;
+}
+
+const BehaviorTree& BehaviorLibrary::get(int type) const {
+    if (type < 0 || type >= TYPE_COUNT) type = 0;
+    return trees[type];
+}
@@ -0,0 +1,256 @@
+/*******************************************************************************
+ * ConfigFile.cpp - Table-Driven INI Parser Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/ConfigFile.h"
+#include "../include/SaveLoad.h"
+#include <charconv>
+#include <cstring>
+#include <cstdio>
+#include <iostream>
+
+/*******************************************************************************
+ * SCHEMA
+ ******************************************************************************/
+
+enum class ConfigType {
+    FLOAT,
+    INT,
+    BOOL
+};
+
+// One row per ConfigData field (exactly one member pointer is set)
+struct ConfigField {
+    const char* section;
+    const char* key;
+    ConfigType type;
+    float ConfigData::* floatMember;
+    int ConfigData::* intMember;
+    bool ConfigData::* boolMember;
+    double minValue;            // Numbers outside [min, max] are rejected
+    double maxValue;
+    double defaultValue;        // Bools: 0 / 1
+};
+
+static const ConfigField CONFIG_FIELDS[] = {
+    {"Audio", "master_volume", ConfigType::FLOAT, &ConfigData::masterVolume, nullptr, nullptr,
+     0.0, 1.0, 1.0},
+    {"Audio", "music_volume", ConfigType::FLOAT, &ConfigData::musicVolume, nullptr, nullptr,
+     0.0, 1.0, 0.7},
+    {"Audio", "sfx_volume", ConfigType::FLOAT, &ConfigData::sfxVolume, nullptr, nullptr,
+     0.0, 1.0, 0.8},
+    {"Audio", "audio_enabled", ConfigType::BOOL, nullptr, nullptr, &ConfigData::audioEnabled,
+     0, 1, 1},
+    {"Display", "show_tutorials", ConfigType::BOOL, nullptr, nullptr, &ConfigData::showTutorials,
+     0, 1, 1},
+    {"Display", "verbose_mode", ConfigType::BOOL, nullptr, nullptr, &ConfigData::verboseMode,
+     0, 1, 0},
+    {"Gameplay", "difficulty", ConfigType::INT, nullptr, &ConfigData::difficulty, nullptr,
+     1, 3, 2},
+    {"Gameplay", "auto_save", ConfigType::BOOL, nullptr, nullptr, &ConfigData::autoSave,
+     0, 1, 1},
+    {"Gameplay", "compress_saves", ConfigType::BOOL, nullptr, nullptr, &ConfigData::compressSaves,
+     0, 1, 1},
+};
+
+static const int CONFIG_FIELD_COUNT = sizeof(CONFIG_FIELDS) / sizeof(CONFIG_FIELDS[0]);
+
+void setConfigDefaults(ConfigData& config) {
+    for (const ConfigField& field : CONFIG_FIELDS) {
+        if (field.type == ConfigType::FLOAT) {
+            config.*field.floatMember = static_cast<float>(field.defaultValue);
+        } else if (field.type == ConfigType::INT) {
+            config.*field.intMember = static_cast<int>(field.defaultValue);
+        } else {
+            config.*field.boolMember = field.defaultValue != 0;
+        }
+    }
+}
+
+/*******************************************************************************
+ * PARSE
+ ******************************************************************************/
+
+// Helper: Text range without a terminator (the file is never copied)
+struct TextRange {
+    const char* begin;
+    const char* end;
+
+    bool equals(const char* text) const {
+        std::size_t length = strlen(text);
+        return static_cast<std::size_t>(end - begin) == length && memcmp(begin, text, length) == 0;
+    }
+};
+
+static bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static TextRange trim(const char* begin, const char* end) {
+    while (begin < end && isBlank(*begin)) begin++;
+    while (end > begin && isBlank(end[-1])) end--;
+    return {begin, end};
+}
+
+// Helper: true/false, yes/no, on/off, 1/0 (any case)
+static bool parseBool(TextRange value, bool& out) {
+    static const char* const names[][2] = {
+        {"true", "false"}, {"yes", "no"}, {"on", "off"}, {"1", "0"}
+    };
+    char lower[8];
+    std::size_t length = static_cast<std::size_t>(value.end - value.begin);
+    if (length == 0 || length >= sizeof(lower)) return false;
+    for (std::size_t i = 0; i < length; i++) {
+        char c = value.begin[i];
+        lower[i] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+    lower[length] = '\0';
+
+    for (const auto& pair : names) {
+        if (strcmp(lower, pair[0]) == 0) {
+            out = true;
+            return true;
+        }
+        if (strcmp(lower, pair[1]) == 0) {
+            out = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Helper: Convert value into the field's member (false = rejected, member untouched)
+static bool storeValue(const ConfigField& field, TextRange value, ConfigData& config) {
+    if (field.type == ConfigType::BOOL) {
+        bool parsed = false;
+        if (!parseBool(value, parsed)) return false;
+        config.*field.boolMember = parsed;
+        return true;
+    }
+
+    if (field.type == ConfigType::FLOAT) {
+        float parsed = 0.0f;
+        std::from_chars_result result = std::from_chars(value.begin, value.end, parsed);
+        if (result.ec != std::errc() || result.ptr != value.end ||
+            !(parsed >= field.minValue && parsed <= field.maxValue)) {
+            return false;
+        }
+        config.*field.floatMember = parsed;
+        return true;
+    }
+
+    int parsed = 0;
+    std::from_chars_result result = std::from_chars(value.begin, value.end, parsed);
+    if (result.ec != std::errc() || result.ptr != value.end ||
+        parsed < field.minValue || parsed > field.maxValue) {
+        return false;
+    }
+    config.*field.intMember = parsed;
+    return true;
+}
+
+// Helper: Table row for key in section (no section yet: key alone)
+static const ConfigField* findField(TextRange section, bool inSection, TextRange key) {
+    for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        const ConfigField& field = CONFIG_FIELDS[i];
+        if (key.equals(field.key) && (!inSection || section.equals(field.section))) {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+// Helper: "[Config] Line 7: <message> '<text>'"
+static void reportLine(int line, const char* message, TextRange text) {
+    std::cout << "[Config] Line " << line << ": " << message << " '"
+              << std::string(text.begin, text.end) << "'" << std::endl;
+}
+
+int parseConfig(const char* text, std::size_t size, ConfigData& config) {
+    const char* cursor = text;
+    const char* end = text + size;
+    TextRange section = {text, text};
+    bool inSection = false;
+    int rejected = 0;
+
+    for (int line = 1; cursor < end; line++) {
+        // Step 1
+        const char* lineEnd = static_cast<const char*>(memchr(cursor, '\n', end - cursor));
+        if (lineEnd == nullptr) lineEnd = end;
+        const char* contentEnd = cursor;
+        while (contentEnd < lineEnd && *contentEnd != ';' && *contentEnd != '#') contentEnd++;
+        TextRange content = trim(cursor, contentEnd);
+        cursor = lineEnd < end ? lineEnd + 1 : end;
+        if (content.begin == content.end) continue;
+
+        // Step 2
+        if (*content.begin == '[') {
+            if (content.end[-1] != ']') {
+                reportLine(line, "unterminated section", content);
+                rejected++;
+                continue;
+            }
+            section = trim(content.begin + 1, content.end - 1);
+            inSection = true;
+            continue;
+        }
+
+        const char* equals = static_cast<const char*>(memchr(content.begin, '=',
+                                                             content.end - content.begin));
+        if (equals == nullptr) {
+            reportLine(line, "expected key = value", content);
+            rejected++;
+            continue;
+        }
+        TextRange key = trim(content.begin, equals);
+        TextRange value = trim(equals + 1, content.end);
+        const ConfigField* field = findField(section, inSection, key);
+        if (field == nullptr) {
+            reportLine(line, "unknown setting", key);
+            rejected++;
+            continue;
+        }
+
+        // Step 3
+        if (!storeValue(*field, value, config)) {
+            reportLine(line, "invalid value", content);
+            rejected++;
+        }
+    }
+    return rejected;
+}
+
+/*******************************************************************************
+ * FORMAT
+ ******************************************************************************/
+
+void formatConfig(const ConfigData& config, std::string& out) {
+    out.clear();
+    const char* section = nullptr;
+    for (const ConfigField& field : CONFIG_FIELDS) {
+        if (section == nullptr || strcmp(section, field.section) != 0) {
+            if (section != nullptr) out += "\n";
+            section = field.section;
+            out += "[";
+            out += section;
+            out += "]\n";
+        }
+
+        out += field.key;
+        out += "=";
+        if (field.type == ConfigType::FLOAT) {
+            char number[32];
+            std::to_chars_result result = std::to_chars(number, number + sizeof(number),
+                                                        config.*field.floatMember);
+            out.append(number, result.ptr);
+        } else if (field.type == ConfigType::INT) {
+            out += std::to_string(config.*field.intMember);
+        } else {
+            out += config.*field.boolMember ? "true" : "false";
+        }
+        out += "\n";
+    }
+}
@@ -8,6 +8,8 @@
  ******************************************************************************/
 
 #include "../include/Entity.h"
+#include "../include/SentinelPool.h"
+#include "../include/MemoryTracker.h"
 #include <cstdlib>
 #include <ctime>
 
@@ -15,79 +17,132 @@
  * ENTITY BASE CLASS IMPLEMENTATION
  ******************************************************************************/
 
-// Constructor
-Entity::Entity(const std::string& name, int maxHealth, int attack, int defense, int speed)
-    : name(name), maxHealth(maxHealth), health(maxHealth),
-      attackPower(attack), defense(defense), speed(speed), alive(true) {
+// Constructor - claims a slot in the component store
+Entity::Entity(const std::string& name, EntityKind kind, int maxHealth, int attack, int defense, int speed)
+    : name(&ownName), ownName(name),
+      slot(EntityStore::getInstance().create(kind, maxHealth, attack, defense, speed)) {
+}
+
+// Constructor - shared name, nothing is copied
+Entity::Entity(const std::string* sharedName, EntityKind kind, int maxHealth, int attack,
+               int defense, int speed)
+    : name(sharedName),
+      slot(EntityStore::getInstance().create(kind, maxHealth, attack, defense, speed)) {
 }
 
-// Virtual Destructor
+// Virtual Destructor - returns the slot
 Entity::~Entity() {
-    // Base class cleanup (if needed)
+    EntityStore::getInstance().destroy(slot);
+}
+
+// Helper: Replace base stats (used by derived constructors)
+void Entity::setBaseStats(int maxHealth, int attack, int defense, int speed) {
+    EntityStore& store = EntityStore::getInstance();
+    store.maxHealth(slot) = maxHealth;
+    store.health(slot) = maxHealth;
+    store.attack(slot) = attack;
+    store.defense(slot) = defense;
+    store.speed(slot) = speed;
 }
 
 // Display entity information
 void Entity::displayInfo() const {
-    std::cout << "=== " << name << " ===" << std::endl;
-    std::cout << "Health: " << health << "/" << maxHealth << std::endl;
-    std::cout << "Attack: " << attackPower << std::endl;
-    std::cout << "Defense: " << defense << std::endl;
-    std::cout << "Speed: " << speed << std::endl;
+    const EntityStore& store = EntityStore::getInstance();
+    std::cout << "=== " << *name << " ===" << std::endl;
+    std::cout << "Health: " << store.health(slot) << "/" << store.maxHealth(slot) << std::endl;
+    std::cout << "Attack: " << store.attack(slot) << std::endl;
+    std::cout << "Defense: " << store.defense(slot) << std::endl;
+    std::cout << "Speed: " << store.speed(slot) << std::endl;
 }
 
 // Take damage (reduced by defense)
 void Entity::takeDamage(int amount) {
+    EntityStore& store = EntityStore::getInstance();
+
     // Calculate actual damage after defense reduction
-    int actualDamage = amount - (defense / 2);
+    int actualDamage = amount - (store.defense(slot) / 2);
     if (actualDamage < 1) actualDamage = 1;  // Minimum 1 damage
 
+    int& health = store.health(slot);
     health -= actualDamage;
 
-    std::cout << name << " takes " << actualDamage << " damage!" << std::endl;
+    std::cout << *name << " takes " << actualDamage << " damage!" << std::endl;
 
     if (health <= 0) {
         health = 0;
-        alive = false;
-        std::cout << name << " has been defeated!" << std::endl;
+        store.alive(slot) = 0;
+        std::cout << *name << " has been defeated!" << std::endl;
     }
 }
 
 // Heal entity
 void Entity::heal(int amount) {
-    if (!alive) return;
+    EntityStore& store = EntityStore::getInstance();
+    if (!store.alive(slot)) return;
 
+    int& health = store.health(slot);
     health += amount;
-    if (health > maxHealth) {
-        health = maxHealth;
+    if (health > store.maxHealth(slot)) {
+        health = store.maxHealth(slot);
     }
-    std::cout << name << " heals for " << amount << " HP!" << std::endl;
+    std::cout << *name << " heals for " << amount << " HP!" << std::endl;
 }
 
 // Check if entity is alive
 bool Entity::isAlive() const {
-    return alive && health > 0;
+    return EntityStore::getInstance().isAlive(slot);
 }
 
 // Getters
-std::string Entity::getName() const { return name; }
-int Entity::getHealth() const { return health; }
-int Entity::getMaxHealth() const { return maxHealth; }
-int Entity::getAttackPower() const { return attackPower; }
-int Entity::getDefense() const { return defense; }
-int Entity::getSpeed() const { return speed; }
+std::string Entity::getName() const { return *name; }
+int Entity::getHealth() const { return EntityStore::getInstance().health(slot); }
+int Entity::getMaxHealth() const { return EntityStore::getInstance().maxHealth(slot); }
+int Entity::getAttackPower() const { return EntityStore::getInstance().attack(slot); }
+int Entity::getDefense() const { return EntityStore::getInstance().defense(slot); }
+int Entity::getSpeed() const { return EntityStore::getInstance().speed(slot); }
+int Entity::getSlot() const { return slot; }
+EntityKind Entity::getKind() const { return EntityStore::getInstance().kind(slot); }
+EntityFaction Entity::getFaction() const { return EntityStore::getInstance().faction(slot); }
 
 // Setters
+void Entity::setName(const std::string& newName) {
+    ownName = newName;
+    name = &ownName;
+}
+
 void Entity::setHealth(int hp) {
+    EntityStore& store = EntityStore::getInstance();
+    int& health = store.health(slot);
     health = hp;
-    if (health > maxHealth) health = maxHealth;
+    if (health > store.maxHealth(slot)) health = store.maxHealth(slot);
     if (health <= 0) {
         health = 0;
-        alive = false;
+        store.alive(slot) = 0;
+    }
+}
+
+void Entity::setMaxHealth(int hp) {
+    EntityStore& store = EntityStore::getInstance();
+    store.maxHealth(slot) = hp > 1 ? hp : 1;
+    if (store.health(slot) > store.maxHealth(slot)) {
+        store.health(slot) = store.maxHealth(slot);
     }
 }
 
 void Entity::setAttackPower(int power) {
-    attackPower = power;
+    EntityStore::getInstance().attack(slot) = power;
+}
+
+void Entity::setDefense(int value) {
+    EntityStore::getInstance().defense(slot) = value;
+}
+
+void Entity::setSpeed(int value) {
+    EntityStore::getInstance().speed(slot) = value;
+}
+
+void Entity::setFaction(EntityFaction faction) {
+    EntityStore::getInstance().setFaction(slot, faction);
 }
 
 /*******************************************************************************
@@ -98,7 +153,7 @@ void Entity::setAttackPower(int power) {
 
 // Constructor - Player starts with base stats
 Player::Player(const std::string& name)
-    : Entity(name, 100, 15, 5, 10),  // Call base constructor
+    : Entity(name, EntityKind::PLAYER, 100, 15, 5, 10),  // Call base constructor
       experience(0), level(1), experienceToLevel(100),
       currentSector("Unknown"), hackingSkill(1) {
 }
@@ -111,8 +166,8 @@ Player::~Player() {
 // POLYMORPHISM: Player-specific action implementation
 // When called through Entity*, this version executes
 void Player::performAction() {
-    std::cout << "\n=== " << name << "'s Turn ===" << std::endl;
-    std::cout << "Health: " << health << "/" << maxHealth << std::endl;
+    std::cout << "\n=== " << *name << "'s Turn ===" << std::endl;
+    std::cout << "Health: " << getHealth() << "/" << getMaxHealth() << std::endl;
     std::cout << "Choose your action:" << std::endl;
     std::cout << "1. Attack" << std::endl;
     std::cout << "2. Defend" << std::endl;
@@ -125,14 +180,14 @@ void Player::performAction() {
 // Override display for player-specific info
 void Player::displayInfo() const {
     std::cout << "\n========================================" << std::endl;
-    std::cout << "  DIGITAL SIGNATURE: " << name << std::endl;
+    std::cout << "  DIGITAL SIGNATURE: " << *name << std::endl;
     std::cout << "========================================" << std::endl;
-    std::cout << "  Health:     " << health << "/" << maxHealth << std::endl;
+    std::cout << "  Health:     " << getHealth() << "/" << getMaxHealth() << std::endl;
     std::cout << "  Level:      " << level << std::endl;
     std::cout << "  Experience: " << experience << "/" << experienceToLevel << std::endl;
-    std::cout << "  Attack:     " << attackPower << std::endl;
-    std::cout << "  Defense:    " << defense << std::endl;
-    std::cout << "  Speed:      " << speed << std::endl;
+    std::cout << "  Attack:     " << getAttackPower() << std::endl;
+    std::cout << "  Defense:    " << getDefense() << std::endl;
+    std::cout << "  Speed:      " << getSpeed() << std::endl;
     std::cout << "  Hacking:    " << hackingSkill << std::endl;
     std::cout << "  Location:   " << currentSector << std::endl;
     std::cout << "========================================" << std::endl;
@@ -141,7 +196,7 @@ void Player::displayInfo() const {
 // Gain experience points
 void Player::gainExperience(int amount) {
     experience += amount;
-    std::cout << name << " gained " << amount << " XP!" << std::endl;
+    std::cout << *name << " gained " << amount << " XP!" << std::endl;
 
     // Check for level up
     while (experience >= experienceToLevel) {
@@ -158,15 +213,16 @@ bool Player::levelUp() {
     experienceToLevel = level * 100;  // Scaling XP requirement
 
     // Stat increases
-    maxHealth += 10;
-    health = maxHealth;  // Full heal on level up
-    attackPower += 3;
-    defense += 2;
-    speed += 1;
+    EntityStore& store = EntityStore::getInstance();
+    store.maxHealth(slot) += 10;
+    store.health(slot) = store.maxHealth(slot);  // Full heal on level up
+    store.attack(slot) += 3;
+    store.defense(slot) += 2;
+    store.speed(slot) += 1;
     hackingSkill += 1;
 
     std::cout << "\n*** LEVEL UP! ***" << std::endl;
-    std::cout << name << " is now level " << level << "!" << std::endl;
+    std::cout << *name << " is now level " << level << "!" << std::endl;
     std::cout << "All stats increased!" << std::endl;
 
     return true;
@@ -185,7 +241,10 @@ std::string Player::getCurrentSector() const { return currentSector; }
 int Player::getHackingSkill() const { return hackingSkill; }
 
 // Setters
-void Player::setLevel(int lvl) { level = lvl; }
+void Player::setLevel(int lvl) {
+    level = lvl;
+    experienceToLevel = level * 100;    // Same scaling as levelUp()
+}
 void Player::setExperience(int exp) { experience = exp; }
 void Player::setHackingSkill(int skill) { hackingSkill = skill; }
 
@@ -197,40 +256,34 @@ void Player::setHackingSkill(int skill) { hackingSkill = skill; }
 
 // Constructor - Stats based on sentinel type
 Sentinel::Sentinel(const std::string& name, Type type)
-    : Entity(name, 50, 10, 3, 5), type(type), aggressionLevel(5), isPatrolling(false) {
+    : Entity(name, EntityKind::SENTINEL, 50, 10, 3, 5), type(type), aggressionLevel(5), isPatrolling(false) {
+    applyTypeStats();
+}
+
+// Constructor - designation table name (used by the factories)
+Sentinel::Sentinel(const std::string* sharedName, Type type)
+    : Entity(sharedName, EntityKind::SENTINEL, 50, 10, 3, 5), type(type), aggressionLevel(5),
+      isPatrolling(false) {
+    applyTypeStats();
+}
 
-    // Adjust stats based on type
+// Helper: Adjust stats based on type
+void Sentinel::applyTypeStats() {
     switch (type) {
         case Type::SCOUT:
-            maxHealth = 30;
-            health = 30;
-            attackPower = 8;
-            defense = 2;
-            speed = 12;
+            setBaseStats(30, 8, 2, 12);
             aggressionLevel = 3;
             break;
         case Type::GUARDIAN:
-            maxHealth = 60;
-            health = 60;
-            attackPower = 12;
-            defense = 8;
-            speed = 6;
+            setBaseStats(60, 12, 8, 6);
             aggressionLevel = 5;
             break;
         case Type::ENFORCER:
-            maxHealth = 50;
-            health = 50;
-            attackPower = 18;
-            defense = 5;
-            speed = 8;
+            setBaseStats(50, 18, 5, 8);
             aggressionLevel = 8;
             break;
         case Type::ELITE:
-            maxHealth = 100;
-            health = 100;
-            attackPower = 20;
-            defense = 10;
-            speed = 10;
+            setBaseStats(100, 20, 10, 10);
             aggressionLevel = 10;
             break;
     }
@@ -242,28 +295,52 @@ Sentinel::~Sentinel() {
 }
 
 // POLYMORPHISM: Sentinel AI action implementation
-// Executes AI-driven combat behavior
+// Step 1: Read own and target stats from the store
+// Step 2: Tick the compiled tree shared by this type
+// Step 3: Announce the plan (CombatSystem::enemyTurn carries it out)
 void Sentinel::performAction() {
-    std::cout << "\n" << name << " [" << getTypeString() << "] analyzes the situation..." << std::endl;
+    std::cout << "\n" << *name << " [" << getTypeString() << "] analyzes the situation..." << std::endl;
+
+    // Step 1: Context (no target = assume it is at full health)
+    const EntityStore& store = EntityStore::getInstance();
+    BehaviorContext context;
+    context.health = store.health(slot);
+    context.maxHealth = store.maxHealth(slot);
+    context.targetHealth = 1;
+    context.targetMaxHealth = 1;
+    context.aggression = aggressionLevel;
+    if (blackboard.targetSlot >= 0) {
+        context.targetHealth = store.health(blackboard.targetSlot);
+        context.targetMaxHealth = store.maxHealth(blackboard.targetSlot);
+    }
 
-    // Simple AI: Higher aggression = more likely to attack
-    int actionRoll = rand() % 10;
+    // Step 2: Decide
+    const BehaviorTree& tree = BehaviorLibrary::getInstance().get(static_cast<int>(type));
+    SentinelAction action = tree.evaluate(context, blackboard);
 
-    if (actionRoll < aggressionLevel) {
-        // Aggressive action
-        std::cout << name << " launches an aggressive attack!" << std::endl;
-    } else {
-        // Defensive/tactical action
-        std::cout << name << " takes a calculated approach." << std::endl;
+    // Step 3: Announce
+    switch (action) {
+        case SentinelAction::ATTACK:
+            std::cout << *name << " launches an aggressive attack!" << std::endl;
+            break;
+        case SentinelAction::HEAVY_ATTACK:
+            std::cout << *name << " charges a heavy strike!" << std::endl;
+            break;
+        case SentinelAction::REPAIR:
+            std::cout << *name << " diverts power to self-repair." << std::endl;
+            break;
+        case SentinelAction::ANALYZE:
+            std::cout << *name << " takes a calculated approach." << std::endl;
+            break;
     }
 }
 
 // Override display
 void Sentinel::displayInfo() const {
     std::cout << "\n--- SENTINEL DETECTED ---" << std::endl;
-    std::cout << "Designation: " << name << std::endl;
+    std::cout << "Designation: " << *name << std::endl;
     std::cout << "Type: " << getTypeString() << std::endl;
-    std::cout << "Integrity: " << health << "/" << maxHealth << std::endl;
+    std::cout << "Integrity: " << getHealth() << "/" << getMaxHealth() << std::endl;
     std::cout << "Threat Level: " << aggressionLevel << "/10" << std::endl;
     std::cout << "-------------------------" << std::endl;
 }
@@ -271,18 +348,30 @@ void Sentinel::displayInfo() const {
 // Patrol behavior
 void Sentinel::patrol() {
     isPatrolling = true;
-    std::cout << name << " is patrolling the sector..." << std::endl;
+    std::cout << *name << " is patrolling the sector..." << std::endl;
 }
 
 // Calculate damage output
 int Sentinel::calculateDamage() const {
     // Base damage + random variation based on aggression
-    int baseDamage = attackPower;
+    int baseDamage = getAttackPower();
     int variation = rand() % (aggressionLevel + 1);
     return baseDamage + variation;
 }
 
+// Start of an encounter: forget the last fight, lock onto target
+void Sentinel::engage(const Entity* target) {
+    blackboard.engage(target != nullptr ? target->getSlot() : -1);
+}
+
+// Mid-fight: the old target fell, go after another one
+void Sentinel::retarget(const Entity* target) {
+    blackboard.targetSlot = target != nullptr ? target->getSlot() : -1;
+}
+
 // Getters
+int Sentinel::getTargetSlot() const { return blackboard.targetSlot; }
+SentinelAction Sentinel::getPlannedAction() const { return blackboard.planned; }
 Sentinel::Type Sentinel::getType() const { return type; }
 int Sentinel::getAggressionLevel() const { return aggressionLevel; }
 
@@ -296,31 +385,84 @@ std::string Sentinel::getTypeString() const {
     }
 }
 
-// Factory method: Create random sentinel based on difficulty
-Sentinel* Sentinel::createRandom(int difficulty) {
-    // Generate name
-    std::string names[] = {"Alpha", "Beta", "Gamma", "Delta", "Epsilon", "Omega"};
-    std::string name = "SENTINEL-" + names[rand() % 6] + "-" + std::to_string(rand() % 1000);
+// Designation table, built once: every "SENTINEL-<designation>-<n>" name
+// (6 x 1000 strings), so spawned Sentinels share an entry instead of
+// building and copying a heap-allocated name each
+static const int DESIGNATION_COUNT = 6;
+static const int DESIGNATION_NUMBERS = 1000;
+
+static const std::string* designationTable() {
+    static const std::string* table = [] {
+        MEM_SCOPE(MemSubsystem::ENTITY);
+        static const char* const prefixes[DESIGNATION_COUNT] = {
+            "SENTINEL-Alpha-", "SENTINEL-Beta-", "SENTINEL-Gamma-",
+            "SENTINEL-Delta-", "SENTINEL-Epsilon-", "SENTINEL-Omega-"
+        };
+        std::string* names = new std::string[DESIGNATION_COUNT * DESIGNATION_NUMBERS];
+        for (int d = 0; d < DESIGNATION_COUNT; d++) {
+            for (int n = 0; n < DESIGNATION_NUMBERS; n++) {
+                names[d * DESIGNATION_NUMBERS + n] = prefixes[d] + std::to_string(n);
+            }
+        }
+        return names;
+    }();
+    return table;
+}
+
+// Helper: Random entry of the designation table
+const std::string* Sentinel::pickName() {
+    int designation = rand() % DESIGNATION_COUNT;
+    int number = rand() % DESIGNATION_NUMBERS;
+    return &designationTable()[designation * DESIGNATION_NUMBERS + number];
+}
 
-    // Determine type based on difficulty
-    Type type;
+// Helper: Determine type based on difficulty
+Sentinel::Type Sentinel::rollType(int difficulty) {
     int roll = rand() % 100;
 
     if (difficulty <= 2) {
-        type = Type::SCOUT;
+        return Type::SCOUT;
     } else if (difficulty <= 4) {
-        type = (roll < 70) ? Type::SCOUT : Type::GUARDIAN;
+        return (roll < 70) ? Type::SCOUT : Type::GUARDIAN;
     } else if (difficulty <= 6) {
-        if (roll < 40) type = Type::SCOUT;
-        else if (roll < 80) type = Type::GUARDIAN;
-        else type = Type::ENFORCER;
-    } else {
-        if (roll < 20) type = Type::GUARDIAN;
-        else if (roll < 60) type = Type::ENFORCER;
-        else type = Type::ELITE;
+        if (roll < 40) return Type::SCOUT;
+        if (roll < 80) return Type::GUARDIAN;
+        return Type::ENFORCER;
+    }
+
+    if (roll < 20) return Type::GUARDIAN;
+    if (roll < 60) return Type::ENFORCER;
+    return Type::ELITE;
+}
+
+// Factory method: Create random sentinel based on difficulty
+Sentinel* Sentinel::createRandom(int difficulty) {
+    MEM_SCOPE(MemSubsystem::ENTITY);
+    const std::string* name = pickName();
+    return new Sentinel(name, rollType(difficulty));
+}
+
+// Batch factory: reserve pool blocks for the wave, then construct in place
+int Sentinel::createRandomBatch(int difficulty, int count, Sentinel** out) {
+    if (count <= 0 || out == nullptr) return 0;
+    MEM_SCOPE(MemSubsystem::ENTITY);
+
+    SentinelPool::getInstance().reserve(count);
+    for (int i = 0; i < count; i++) {
+        const std::string* name = pickName();
+        out[i] = new Sentinel(name, rollType(difficulty));
     }
+    return count;
+}
 
-    return new Sentinel(name, type);
+// Class allocation: blocks from SentinelPool (final class, so size is fixed)
+void* Sentinel::operator new(std::size_t size) {
+    (void)size;  // Always sizeof(Sentinel)
+    return SentinelPool::getInstance().allocate();
+}
+
+void Sentinel::operator delete(void* block) {
+    SentinelPool::getInstance().release(block);
 }
 
 /*******************************************************************************
@@ -331,37 +473,21 @@ Sentinel* Sentinel::createRandom(int difficulty) {
 
 // Constructor
 Awakened::Awakened(const std::string& name, Specialty spec)
-    : Entity(name, 40, 5, 3, 7), specialty(spec), loyalty(50), hasJoined(false) {
+    : Entity(name, EntityKind::AWAKENED, 40, 5, 3, 7), specialty(spec), loyalty(50), hasJoined(false) {
 
     // Adjust stats based on specialty
     switch (specialty) {
         case Specialty::HEALER:
-            maxHealth = 35;
-            health = 35;
-            attackPower = 3;
-            defense = 4;
-            speed = 6;
+            setBaseStats(35, 3, 4, 6);
             break;
         case Specialty::HACKER:
-            maxHealth = 30;
-            health = 30;
-            attackPower = 5;
-            defense = 2;
-            speed = 9;
+            setBaseStats(30, 5, 2, 9);
             break;
         case Specialty::WARRIOR:
-            maxHealth = 50;
-            health = 50;
-            attackPower = 12;
-            defense = 6;
-            speed = 7;
+            setBaseStats(50, 12, 6, 7);
             break;
         case Specialty::SCOUT:
-            maxHealth = 25;
-            health = 25;
-            attackPower = 4;
-            defense = 2;
-            speed = 12;
+            setBaseStats(25, 4, 2, 12);
             break;
     }
 }
@@ -374,24 +500,24 @@ Awakened::~Awakened() {
 // POLYMORPHISM: Awakened support action implementation
 void Awakened::performAction() {
     if (!hasJoined) {
-        std::cout << name << " observes from a distance..." << std::endl;
+        std::cout << *name << " observes from a distance..." << std::endl;
         return;
     }
 
-    std::cout << name << " [" << getSpecialtyString() << "] prepares to assist!" << std::endl;
+    std::cout << *name << " [" << getSpecialtyString() << "] prepares to assist!" << std::endl;
 
     switch (specialty) {
         case Specialty::HEALER:
-            std::cout << name << " channels healing energy." << std::endl;
+            std::cout << *name << " channels healing energy." << std::endl;
             break;
         case Specialty::HACKER:
-            std::cout << name << " analyzes system vulnerabilities." << std::endl;
+            std::cout << *name << " analyzes system vulnerabilities." << std::endl;
             break;
         case Specialty::WARRIOR:
-            std::cout << name << " takes an aggressive stance." << std::endl;
+            std::cout << *name << " takes an aggressive stance." << std::endl;
             break;
         case Specialty::SCOUT:
-            std::cout << name << " provides tactical information." << std::endl;
+            std::cout << *name << " provides tactical information." << std::endl;
             break;
     }
 }
@@ -399,18 +525,18 @@ void Awakened::performAction() {
 // Override display
 void Awakened::displayInfo() const {
     std::cout << "\n--- AWAKENED ENTITY ---" << std::endl;
-    std::cout << "Name: " << name << std::endl;
+    std::cout << "Name: " << *name << std::endl;
     std::cout << "Specialty: " << getSpecialtyString() << std::endl;
     std::cout << "Status: " << (hasJoined ? "Allied" : "Neutral") << std::endl;
     std::cout << "Loyalty: " << loyalty << "/100" << std::endl;
-    std::cout << "Health: " << health << "/" << maxHealth << std::endl;
+    std::cout << "Health: " << getHealth() << "/" << getMaxHealth() << std::endl;
     std::cout << "-----------------------" << std::endl;
 }
 
 // Join player's party
 void Awakened::join() {
     hasJoined = true;
-    std::cout << name << " has joined your party!" << std::endl;
+    std::cout << *name << " has joined your party!" << std::endl;
 }
 
 // Assist a target based on specialty
@@ -425,13 +551,13 @@ void Awakened::assist(Entity* target) {
             break;
         case Specialty::WARRIOR:
             // Damage boost effect would be applied
-            std::cout << name << " enhances " << target->getName() << "'s attack!" << std::endl;
+            std::cout << *name << " enhances " << target->getName() << "'s attack!" << std::endl;
             break;
         case Specialty::HACKER:
-            std::cout << name << " provides hacking support!" << std::endl;
+            std::cout << *name << " provides hacking support!" << std::endl;
             break;
         case Specialty::SCOUT:
-            std::cout << name << " reveals enemy weaknesses!" << std::endl;
+            std::cout << *name << " reveals enemy weaknesses!" << std::endl;
             break;
     }
 }
@@ -440,7 +566,11 @@ void Awakened::assist(Entity* target) {
 void Awakened::increaseLoyalty(int amount) {
     loyalty += amount;
     if (loyalty > 100) loyalty = 100;
-    std::cout << name << "'s loyalty increased to " << loyalty << "!" << std::endl;
+    std::cout << *name << "'s loyalty increased to " << loyalty << "!" << std::endl;
+}
+
+void Awakened::setLoyalty(int value) {
+    loyalty = value < 0 ? 0 : (value > 100 ? 100 : value);
 }
 
 // Getters
@@ -456,4 +586,18 @@ std::string Awakened::getSpecialtyString() const {
         case Specialty::SCOUT: return "SCOUT";
         default: return "UNKNOWN";
     }
-}
\ No newline at end of file
+}
+
+/*******************************************************************************
+ * COMBATANT DISPATCH
+ ******************************************************************************/
+
+// Pick the variant alternative from the stored kind tag
+Combatant toCombatant(Entity* entity) {
+    switch (entity->getKind()) {
+        case EntityKind::PLAYER:   return static_cast<Player*>(entity);
+        case EntityKind::SENTINEL: return static_cast<Sentinel*>(entity);
+        case EntityKind::AWAKENED: break;
+    }
+    return static_cast<Awakened*>(entity);
+}
@@ -0,0 +1,228 @@
+/*******************************************************************************
+ * EntityStore.cpp - Contiguous Component Storage Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/EntityStore.h"
+#include "../include/MemoryTracker.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ENTITYSTORE_SSE2 1
+#endif
+
+// Constructor
+EntityStore::EntityStore()
+    : healthData(nullptr), maxHealthData(nullptr), attackData(nullptr),
+      defenseData(nullptr), speedData(nullptr), aliveData(nullptr), kindData(nullptr),
+      factionData(nullptr),
+      nextFree(nullptr), freeHead(-1), capacity(0), used(0), liveCount(0) {
+}
+
+// Singleton access
+EntityStore& EntityStore::getInstance() {
+    static EntityStore instance;
+    return instance;
+}
+
+// Destructor
+EntityStore::~EntityStore() {
+    delete[] healthData;
+    delete[] maxHealthData;
+    delete[] attackData;
+    delete[] defenseData;
+    delete[] speedData;
+    delete[] aliveData;
+    delete[] kindData;
+    delete[] factionData;
+    delete[] nextFree;
+}
+
+// Helper: copy the first count elements of an array into a new, larger one
+template<typename T>
+static T* growArray(T* old, int count, int newCapacity) {
+    T* grown = new T[newCapacity];
+    for (int i = 0; i < count; i++) {
+        grown[i] = old[i];
+    }
+    delete[] old;
+    return grown;
+}
+
+// GROW: Double every component array
+void EntityStore::grow() {
+    MEM_SCOPE(MemSubsystem::ENTITY);
+    int newCapacity = capacity == 0 ? 32 : capacity * 2;
+
+    healthData = growArray(healthData, used, newCapacity);
+    maxHealthData = growArray(maxHealthData, used, newCapacity);
+    attackData = growArray(attackData, used, newCapacity);
+    defenseData = growArray(defenseData, used, newCapacity);
+    speedData = growArray(speedData, used, newCapacity);
+    aliveData = growArray(aliveData, used, newCapacity);
+    kindData = growArray(kindData, used, newCapacity);
+    factionData = growArray(factionData, used, newCapacity);
+    nextFree = growArray(nextFree, used, newCapacity);
+
+    capacity = newCapacity;
+}
+
+// CREATE: Hand out a slot with starting stats
+// Step 1: Reuse a free slot, or take the next one (growing if full)
+// Step 2: Write the starting stats, mark alive, default faction from kind
+int EntityStore::create(EntityKind kind, int maxHealth, int attack, int defense, int speed) {
+    // Step 1: Pick a slot
+    int slot;
+    if (freeHead >= 0) {
+        slot = freeHead;
+        freeHead = nextFree[slot];
+    } else {
+        if (used == capacity) {
+            grow();
+        }
+        slot = used++;
+    }
+
+    // Step 2: Initial components
+    healthData[slot] = maxHealth;
+    maxHealthData[slot] = maxHealth;
+    attackData[slot] = attack;
+    defenseData[slot] = defense;
+    speedData[slot] = speed;
+    aliveData[slot] = 1;
+    kindData[slot] = kind;
+    switch (kind) {
+        case EntityKind::PLAYER:   factionData[slot] = EntityFaction::PLAYER; break;
+        case EntityKind::SENTINEL: factionData[slot] = EntityFaction::HOSTILE; break;
+        case EntityKind::AWAKENED: factionData[slot] = EntityFaction::ALLY; break;
+    }
+    nextFree[slot] = -1;
+
+    liveCount++;
+    return slot;
+}
+
+// DESTROY: Return a slot to the free list
+void EntityStore::destroy(int slot) {
+    if (slot < 0 || slot >= used) return;
+
+    aliveData[slot] = 0;
+    healthData[slot] = 0;
+    nextFree[slot] = freeHead;
+    freeHead = slot;
+    liveCount--;
+}
+
+// ANY ALIVE: Early-out sweep (victory check)
+bool EntityStore::anyAlive(const int* slots, int count) const {
+    for (int i = 0; i < count; i++) {
+        if (isAlive(slots[i])) return true;
+    }
+    return false;
+}
+
+// COUNT ALIVE: Full sweep
+int EntityStore::countAlive(const int* slots, int count) const {
+    int alive = 0;
+    for (int i = 0; i < count; i++) {
+        alive += isAlive(slots[i]) ? 1 : 0;
+    }
+    return alive;
+}
+
+// APPLY DAMAGE: Resolve one hit against a batch of slots
+// Step 1: Load health / defense / alive for four slots (direct load when contiguous)
+// Step 2: damage = max(amount - defense / 2, 1), health = max(health - damage, 0),
+//         lanes already down keep their health
+// Step 3: Store health and health lost back, clear alive for lanes that fell
+// Defense is never negative, so defense / 2 is a plain arithmetic shift.
+int EntityStore::applyDamage(const int* slots, const int* amounts, int count, int* dealt) {
+    int defeated = 0;
+    int i = 0;
+
+#ifdef ENTITYSTORE_SSE2
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        const int* s = slots + i;
+        bool contiguous = s[1] == s[0] + 1 && s[2] == s[0] + 2 && s[3] == s[0] + 3;
+
+        // Step 1: Gather
+        __m128i before, defense;
+        if (contiguous) {
+            before = _mm_loadu_si128(reinterpret_cast<const __m128i*>(healthData + s[0]));
+            defense = _mm_loadu_si128(reinterpret_cast<const __m128i*>(defenseData + s[0]));
+        } else {
+            before = _mm_setr_epi32(healthData[s[0]], healthData[s[1]],
+                                    healthData[s[2]], healthData[s[3]]);
+            defense = _mm_setr_epi32(defenseData[s[0]], defenseData[s[1]],
+                                     defenseData[s[2]], defenseData[s[3]]);
+        }
+        __m128i flags = _mm_setr_epi32(aliveData[s[0]], aliveData[s[1]],
+                                       aliveData[s[2]], aliveData[s[3]]);
+        __m128i standing = _mm_and_si128(_mm_cmpgt_epi32(flags, zero),
+                                         _mm_cmpgt_epi32(before, zero));
+        __m128i amount = _mm_loadu_si128(reinterpret_cast<const __m128i*>(amounts + i));
+
+        // Step 2: Mitigate, floor at 1, subtract, clamp at 0 (standing lanes only)
+        __m128i damage = _mm_sub_epi32(amount, _mm_srai_epi32(defense, 1));
+        __m128i low = _mm_cmplt_epi32(damage, one);
+        damage = _mm_or_si128(_mm_andnot_si128(low, damage), _mm_and_si128(low, one));
+        __m128i after = _mm_sub_epi32(before, damage);
+        after = _mm_andnot_si128(_mm_cmplt_epi32(after, one), after);
+        __m128i health = _mm_or_si128(_mm_and_si128(standing, after),
+                                      _mm_andnot_si128(standing, before));
+        __m128i lost = _mm_and_si128(standing, _mm_sub_epi32(before, after));
+        __m128i fell = _mm_and_si128(standing, _mm_cmpeq_epi32(after, zero));
+
+        // Step 3: Scatter
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dealt + i), lost);
+        if (contiguous) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(healthData + s[0]), health);
+        } else {
+            alignas(16) int lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), health);
+            for (int lane = 0; lane < 4; lane++) {
+                healthData[s[lane]] = lanes[lane];
+            }
+        }
+
+        int fellMask = _mm_movemask_ps(_mm_castsi128_ps(fell));
+        for (int lane = 0; lane < 4; lane++) {
+            if (fellMask & (1 << lane)) {
+                aliveData[s[lane]] = 0;
+                defeated++;
+            }
+        }
+    }
+#endif
+
+    // Scalar tail (or whole batch without SSE2)
+    for (; i < count; i++) {
+        int slot = slots[i];
+        if (!isAlive(slot)) {
+            dealt[i] = 0;
+            continue;
+        }
+        int damage = amounts[i] - (defenseData[slot] >> 1);
+        if (damage < 1) damage = 1;
+
+        int before = healthData[slot];
+        int health = before - damage;
+        if (health <= 0) {
+            health = 0;
+            aliveData[slot] = 0;
+            defeated++;
+        }
+        healthData[slot] = health;
+        dealt[i] = before - health;
+    }
+
+    return defeated;
+}
+
+// Statistics
+int EntityStore::getLiveCount() const { return liveCount; }
+int EntityStore::getCapacity() const { return capacity; }
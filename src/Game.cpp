@@ -11,8 +11,12 @@
 #include "../include/Game.h"
 #include "../include/Audio.h"
 #include "../include/SaveLoad.h"
+#include "../include/ConfigFile.h"
+#include "../include/Profiler.h"
+#include "../include/MemoryTracker.h"
 #include <limits>
 #include <algorithm>
+#include <chrono>
 
 /*******************************************************************************
  * UTILITY FUNCTIONS
@@ -73,23 +77,44 @@ void displayVictory() {
 )" << std::endl;
 }
 
+// Helper: Map config.ini difficulty (1 easy .. 3 hard) to the Overseer's
+// base encounter difficulty (1, 3, 5 - normal keeps the original 3)
+static int storytellerDifficulty(const ConfigData& config) {
+    return config.difficulty * 2 - 1;
+}
+
 /*******************************************************************************
  * COMBAT SYSTEM IMPLEMENTATION
  ******************************************************************************/
 
 CombatSystem::CombatSystem()
-    : turnQueue(nullptr), player(nullptr), enemies(nullptr), enemyCount(0),
-      allies(nullptr), allyCount(0), inCombat(false), roundNumber(0) {
+    : turnQueue(nullptr), support(nullptr), player(nullptr), enemies(nullptr), enemyCount(0),
+      allies(nullptr), allyCount(0), inCombat(false), roundNumber(0),
+      currentTurn(nullptr), combatants(nullptr), combatSlots(nullptr), combatantCount(0) {
+    MEM_SCOPE(MemSubsystem::COMBAT);
     turnQueue = new CombatQueue();
+    support = new SupportEngine();
 }
 
 CombatSystem::~CombatSystem() {
+    releaseCombatants();
+    delete support;
     delete turnQueue;
 }
 
+// Helper: Free the combatant and slot lists
+void CombatSystem::releaseCombatants() {
+    delete[] combatants;
+    delete[] combatSlots;
+    combatants = nullptr;
+    combatSlots = nullptr;
+    combatantCount = 0;
+}
+
 // Initialize combat
 void CombatSystem::initiateCombat(Player* p, Entity** en, int enCount,
                                    Entity** al, int alCount) {
+    MEM_SCOPE(MemSubsystem::COMBAT);
     player = p;
     enemies = en;
     enemyCount = enCount;
@@ -98,9 +123,11 @@ void CombatSystem::initiateCombat(Player* p, Entity** en, int enCount,
     inCombat = true;
     roundNumber = 1;
 
-    // Build combatant array for queue
-    int totalCombatants = 1 + enemyCount + allyCount;
-    Entity** combatants = new Entity*[totalCombatants];
+    // Build combatant and slot arrays (kept for the whole encounter)
+    releaseCombatants();
+    combatantCount = 1 + enemyCount + allyCount;
+    combatants = new Entity*[combatantCount];
+    combatSlots = new int[combatantCount];
 
     int idx = 0;
     combatants[idx++] = player;
@@ -113,16 +140,27 @@ void CombatSystem::initiateCombat(Player* p, Entity** en, int enCount,
         combatants[idx++] = allies[i];
     }
 
-    // Initialize turn queue (sorted by speed)
-    turnQueue->initializeCombat(combatants, totalCombatants);
+    for (int i = 0; i < combatantCount; i++) {
+        combatSlots[i] = combatants[i]->getSlot();
+    }
 
-    delete[] combatants;
+    // Each Sentinel locks onto the player or one of the allies
+    for (int i = 0; i < enemyCount; i++) {
+        if (enemies[i]->getKind() == EntityKind::SENTINEL) {
+            static_cast<Sentinel*>(enemies[i])->engage(pickEnemyTarget());
+        }
+    }
+
+    // Initialize turn queue (sorted by speed) and the ally support round
+    turnQueue->initializeCombat(combatants, combatantCount);
+    support->begin(player, allies, allyCount, enemies, enemyCount);
 
     AudioManager::getInstance().playCombatStart();
 }
 
 // Process one turn
 bool CombatSystem::processTurn() {
+    PROFILE_SCOPE(ProfilePhase::COMBAT_PROCESS_TURN);
     if (!inCombat) return false;
 
     // Check victory/defeat
@@ -142,48 +180,36 @@ bool CombatSystem::processTurn() {
 
     // Get next combatant
     Entity* current = turnQueue->getNextTurn();
+    currentTurn = current;
 
     if (current == nullptr) {
-        // Round complete, start new round
+        // Round complete: apply the allies' batched support, start new round
+        support->flush();
         turnQueue->nextRound();
 
-        // Re-queue all living combatants
-        if (player->isAlive()) {
-            turnQueue->addToCombat(player);
-        }
-        for (int i = 0; i < enemyCount; i++) {
-            if (enemies[i]->isAlive()) {
-                turnQueue->addToCombat(enemies[i]);
-            }
-        }
-        for (int i = 0; i < allyCount; i++) {
-            if (allies[i]->isAlive()) {
-                turnQueue->addToCombat(allies[i]);
+        // Re-queue all living combatants (one sweep over the store)
+        const EntityStore& store = EntityStore::getInstance();
+        for (int i = 0; i < combatantCount; i++) {
+            if (store.isAlive(combatSlots[i])) {
+                turnQueue->addToCombat(combatants[i]);
             }
         }
 
         return true;
     }
 
-    // Execute turn based on entity type
-    if (current == player) {
-        current->performAction();
-        // Player action is handled by game input
-    } else {
-        // AI turn
-        bool isEnemy = false;
-        for (int i = 0; i < enemyCount; i++) {
-            if (enemies[i] == current) {
-                isEnemy = true;
-                break;
-            }
-        }
-
-        if (isEnemy) {
-            enemyTurn(current);
-        } else {
-            allyTurn(current);
-        }
+    // Execute turn: behaviour from the entity's static type, side from its
+    // stored faction. Every variant alternative is final, so performAction()
+    // binds directly. Player action itself is handled by game input.
+    // Enemies settle their target first so the behavior tree reads its health.
+    EntityFaction faction = current->getFaction();
+    Entity* target = faction == EntityFaction::HOSTILE ? enemyTarget(current) : nullptr;
+    std::visit([](auto* combatant) { combatant->performAction(); }, toCombatant(current));
+
+    if (faction == EntityFaction::HOSTILE) {
+        enemyTurn(current, target);
+    } else if (faction == EntityFaction::ALLY) {
+        allyTurn(current);
     }
 
     return true;
@@ -192,18 +218,21 @@ bool CombatSystem::processTurn() {
 void CombatSystem::endCombat() {
     turnQueue->endCombat();
     inCombat = false;
+    currentTurn = nullptr;
     player = nullptr;
     enemies = nullptr;
     enemyCount = 0;
     allies = nullptr;
     allyCount = 0;
+    support->end();
+    releaseCombatants();
 }
 
 // Player actions
 void CombatSystem::playerAttack(Entity* target) {
     if (player == nullptr || target == nullptr) return;
 
-    int damage = player->getAttackPower() + getRandomNumber(-3, 5);
+    int damage = player->getAttackPower() + support->getAttackBonus() + getRandomNumber(-3, 5);
     std::cout << "\n" << player->getName() << " attacks " << target->getName() << "!" << std::endl;
     target->takeDamage(damage);
     AudioManager::getInstance().playDamageSound();
@@ -214,10 +243,63 @@ void CombatSystem::playerDefend() {
     std::cout << "Defense temporarily increased!" << std::endl;
 }
 
-void CombatSystem::playerUseAbility(const std::string& abilityCode, Entity* target) {
-    (void)target;  // Suppress unused parameter warning - target used in full implementation
-    std::cout << "\n" << player->getName() << " uses ability: " << abilityCode << "!" << std::endl;
-    // Ability effects would be implemented here
+// COMBAT abilities hit the selected target; swarm abilities (multiTarget)
+// strike every standing enemy at once. Either way the hits are resolved as
+// EntityStore::applyDamage batches over the enemy slots, and each one adds
+// the player's attack power and the support bonus like playerAttack.
+// Other ability types only target the selected entity (effects pending).
+void CombatSystem::playerUseAbility(const Ability& ability, Entity* target) {
+    if (player == nullptr) return;
+    std::cout << "\n" << player->getName() << " uses ability: " << ability.name << "!" << std::endl;
+
+    if (ability.type != Ability::Type::COMBAT || combatSlots == nullptr) {
+        (void)target;  // Non-damage effects would be applied to target here
+        return;
+    }
+
+    // Step 1: Collect standing enemies (combatSlots[1 .. enemyCount]; only
+    // the target unless multiTarget) into the scratch arrays, resolving a
+    // batch whenever they fill up
+    EntityStore& store = EntityStore::getInstance();
+    int basePower = ability.power + player->getAttackPower() + support->getAttackBonus();
+    int batchCount = 0;
+    bool anyHit = false;
+    for (int i = 0; i < enemyCount; i++) {
+        int slot = combatSlots[i + 1];
+        if (!store.isAlive(slot)) continue;
+        if (!ability.multiTarget && combatants[i + 1] != target) continue;
+
+        batchTargets[batchCount] = combatants[i + 1];
+        batchSlots[batchCount] = slot;
+        batchAmounts[batchCount] = basePower + getRandomNumber(-3, 5);
+        batchCount++;
+        anyHit = true;
+        if (batchCount == ABILITY_BATCH) {
+            resolveAbilityBatch(batchCount);
+            batchCount = 0;
+        }
+    }
+    resolveAbilityBatch(batchCount);
+
+    if (anyHit) {
+        AudioManager::getInstance().playDamageSound();
+    }
+}
+
+// Helper: Step 2 + 3 of playerUseAbility - resolve the collected hits in
+// one applyDamage call, then report each one
+void CombatSystem::resolveAbilityBatch(int count) {
+    if (count == 0) return;
+    EntityStore& store = EntityStore::getInstance();
+    store.applyDamage(batchSlots, batchAmounts, count, batchDealt);
+
+    for (int i = 0; i < count; i++) {
+        std::cout << batchTargets[i]->getName() << " takes " << batchDealt[i] << " damage!"
+                  << std::endl;
+        if (!store.isAlive(batchSlots[i])) {
+            std::cout << batchTargets[i]->getName() << " has been defeated!" << std::endl;
+        }
+    }
 }
 
 void CombatSystem::playerUseItem(const std::string& itemCode) {
@@ -236,37 +318,113 @@ void CombatSystem::playerFlee() {
 }
 
 // AI turns
-void CombatSystem::enemyTurn(Entity* enemy) {
-    enemy->performAction();
+// Helper: A random living member of the player's side - the player
+// (combatants[0]) or an ally (after the enemies)
+Entity* CombatSystem::pickEnemyTarget() const {
+    const EntityStore& store = EntityStore::getInstance();
+    int firstAlly = 1 + enemyCount;
+    int living = store.isAlive(combatSlots[0]) ? 1 : 0;
+    for (int i = firstAlly; i < combatantCount; i++) {
+        if (store.isAlive(combatSlots[i])) living++;
+    }
+    if (living == 0) return player;
 
-    // Simple AI: Attack player
-    int damage = enemy->getAttackPower() + getRandomNumber(-2, 3);
-    std::cout << enemy->getName() << " attacks " << player->getName() << "!" << std::endl;
-    player->takeDamage(damage);
-    AudioManager::getInstance().playDamageSound();
+    int pick = getRandomNumber(0, living - 1);
+    for (int i = 0; i < combatantCount; i++) {
+        if (i > 0 && i < firstAlly) continue;
+        if (!store.isAlive(combatSlots[i])) continue;
+        if (pick-- == 0) return combatants[i];
+    }
+    return player;
+}
+
+// Helper: The target a Sentinel is locked onto, or a new one once that has
+// fallen; other enemies pick one every turn
+Entity* CombatSystem::enemyTarget(Entity* enemy) const {
+    if (enemy->getKind() != EntityKind::SENTINEL) {
+        return pickEnemyTarget();
+    }
+
+    Sentinel* sentinel = static_cast<Sentinel*>(enemy);
+    int slot = sentinel->getTargetSlot();
+    const EntityStore& store = EntityStore::getInstance();
+    for (int i = 0; i < combatantCount; i++) {
+        if (combatSlots[i] == slot && store.isAlive(slot)) {
+            return combatants[i];
+        }
+    }
+
+    Entity* target = pickEnemyTarget();
+    sentinel->retarget(target);
+    return target;
 }
 
+// performAction() has already run via processTurn's dispatch; for a
+// Sentinel that ticked its behavior tree, so carry out the planned action
+// against its target
+void CombatSystem::enemyTurn(Entity* enemy, Entity* target) {
+    SentinelAction action = SentinelAction::ATTACK;
+    Sentinel* sentinel = nullptr;
+    if (enemy->getKind() == EntityKind::SENTINEL) {
+        sentinel = static_cast<Sentinel*>(enemy);
+        action = sentinel->getPlannedAction();
+    }
+
+    switch (action) {
+        case SentinelAction::ATTACK: {
+            int damage = enemy->getAttackPower() - support->getEnemyAttackPenalty() +
+                         getRandomNumber(-2, 3);
+            std::cout << enemy->getName() << " attacks " << target->getName() << "!" << std::endl;
+            target->takeDamage(damage);
+            AudioManager::getInstance().playDamageSound();
+            break;
+        }
+        case SentinelAction::HEAVY_ATTACK: {
+            int damage = sentinel->calculateDamage() + enemy->getAttackPower() / 2 -
+                         support->getEnemyAttackPenalty();
+            std::cout << enemy->getName() << " slams into " << target->getName() << "!" << std::endl;
+            target->takeDamage(damage);
+            AudioManager::getInstance().playDamageSound();
+            break;
+        }
+        case SentinelAction::REPAIR:
+            enemy->heal(enemy->getMaxHealth() / 5);
+            break;
+        case SentinelAction::ANALYZE:
+            std::cout << enemy->getName() << " studies " << target->getName()
+                      << "'s movement patterns." << std::endl;
+            break;
+    }
+}
+
+// Awakened decide from the support engine's round summary; heals and
+// buffs are queued and land together when the round ends
 void CombatSystem::allyTurn(Entity* ally) {
-    ally->performAction();
-    // Ally would use assist() on player or attack enemies
+    if (ally->getKind() == EntityKind::AWAKENED) {
+        support->act(*static_cast<Awakened*>(ally));
+    }
 }
 
 // Status checks
+// Enemies occupy combatSlots[1 .. enemyCount]
 bool CombatSystem::isVictory() const {
-    for (int i = 0; i < enemyCount; i++) {
-        if (enemies[i]->isAlive()) return false;
-    }
-    return true;
+    if (combatSlots == nullptr) return false;
+    return !EntityStore::getInstance().anyAlive(combatSlots + 1, enemyCount);
 }
 
 bool CombatSystem::isDefeat() const {
-    return !player->isAlive();
+    if (combatSlots == nullptr) return false;
+    return !EntityStore::getInstance().isAlive(combatSlots[0]);
 }
 
 bool CombatSystem::isInCombat() const {
     return inCombat;
 }
 
+bool CombatSystem::isPlayerTurn() const {
+    return inCombat && currentTurn != nullptr && currentTurn == player;
+}
+
 // Display functions
 void CombatSystem::displayCombatStatus() const {
     std::cout << "\n=== COMBAT STATUS ===" << std::endl;
@@ -359,6 +517,7 @@ void HackingSystem::endHacking() {
 
 // STACK USAGE: Push action onto stack
 bool HackingSystem::injectCode(const std::string& code) {
+    PROFILE_SCOPE(ProfilePhase::HACK_INJECT);
     if (!hackingActive) return false;
 
     attemptsUsed++;
@@ -393,6 +552,7 @@ bool HackingSystem::injectCode(const std::string& code) {
 }
 
 bool HackingSystem::bypassFirewall() {
+    PROFILE_SCOPE(ProfilePhase::HACK_BYPASS);
     if (!hackingActive) return false;
 
     attemptsUsed++;
@@ -415,6 +575,7 @@ bool HackingSystem::bypassFirewall() {
 }
 
 bool HackingSystem::decryptLayer() {
+    PROFILE_SCOPE(ProfilePhase::HACK_DECRYPT);
     if (!hackingActive) return false;
 
     attemptsUsed++;
@@ -436,6 +597,7 @@ bool HackingSystem::decryptLayer() {
 
 // STACK USAGE: Pop from stack to undo
 bool HackingSystem::undoLastAction() {
+    PROFILE_SCOPE(ProfilePhase::HACK_UNDO);
     if (!actionHistory->canRevert()) {
         std::cout << "Cannot undo!" << std::endl;
         return false;
@@ -492,45 +654,74 @@ Game::Game()
     : player(nullptr), inventory(nullptr), abilities(nullptr), worldMap(nullptr),
       eventLog(nullptr), itemDatabase(nullptr), overseer(nullptr),
       combatSystem(nullptr), hackingSystem(nullptr),
+      combatEnemies(nullptr), combatEnemyCount(0), combatAllies(nullptr),
+      party(), partyCount(0),
       currentState(GameState::MAIN_MENU), previousState(GameState::MAIN_MENU),
       turnCount(0), isRunning(true),
-      enemiesDefeated(0), sectorsExplored(0), hacksCompleted(0) {
+      enemiesDefeated(0), sectorsExplored(0), hacksCompleted(0),
+      autoSaveInterval(AUTOSAVE_INTERVAL), lastAutoSaveTurn(0),
+      config(new ConfigData()), nextConfigCheck(0) {
 
+    setConfigDefaults(*config);
     srand(static_cast<unsigned int>(time(nullptr)));
 }
 
 Game::~Game() {
     cleanupSystems();
+    delete config;
 }
 
 void Game::initializeSystems() {
-    // Create core objects
-    itemDatabase = new ItemDatabase();
-    itemDatabase->initializeDefaultItems();
-
-    inventory = new Inventory(50);
-    abilities = new AbilityTree();
-    abilities->initializeDefaultTree();
-
-    worldMap = new GridMap();
-    worldMap->initializeDefaultMap();
-
-    eventLog = new EventLog();
-
-    combatSystem = new CombatSystem();
-    hackingSystem = new HackingSystem();
+    // Create core objects (scoped so memprofile builds charge each subsystem)
+    {
+        MEM_SCOPE(MemSubsystem::ITEMS);
+        itemDatabase = new ItemDatabase();
+        itemDatabase->initializeDefaultItems();
+    }
+    {
+        MEM_SCOPE(MemSubsystem::INVENTORY);
+        inventory = new Inventory(50);
+    }
+    {
+        MEM_SCOPE(MemSubsystem::ABILITIES);
+        abilities = new AbilityTree();
+        abilities->initializeDefaultTree();
+    }
+    {
+        MEM_SCOPE(MemSubsystem::GRID_MAP);
+        worldMap = new GridMap();
+        worldMap->initializeDefaultMap();
+    }
+    {
+        MEM_SCOPE(MemSubsystem::EVENT_LOG);
+        eventLog = new EventLog();
+    }
+    {
+        MEM_SCOPE(MemSubsystem::COMBAT);
+        combatSystem = new CombatSystem();
+    }
+    {
+        MEM_SCOPE(MemSubsystem::HACKING);
+        hackingSystem = new HackingSystem();
+    }
 
     // Initialize audio
     AudioManager::getInstance().initialize("audio");
 
-    // Initialize save system
+    // Initialize save system, then apply config.ini (auto-save, compression, volumes)
     SaveLoadManager::getInstance().initialize("saves");
+    ConfigData previous = *config;
+    SaveLoadManager::getInstance().loadConfig(*config);
+    applyConfig(previous);
 
     std::cout << "[Game] All systems initialized." << std::endl;
 }
 
 void Game::cleanupSystems() {
+    releaseCombat();
+    releaseParty();
     cleanupOverseer();
+    overseer = nullptr;
 
     delete combatSystem;
     delete hackingSystem;
@@ -541,6 +732,17 @@ void Game::cleanupSystems() {
     delete itemDatabase;
     delete player;
 
+    // Reset pointers so a later cleanup (quit, game over, destructor)
+    // does not free the same systems twice
+    combatSystem = nullptr;
+    hackingSystem = nullptr;
+    eventLog = nullptr;
+    worldMap = nullptr;
+    abilities = nullptr;
+    inventory = nullptr;
+    itemDatabase = nullptr;
+    player = nullptr;
+
     AudioManager::getInstance().shutdown();
 }
 
@@ -598,14 +800,30 @@ void Game::displayStats() const {
 }
 
 void Game::newGame(const std::string& playerName) {
+    // Release systems left over from a previous session
+    if (itemDatabase != nullptr) {
+        cleanupSystems();
+    }
     initializeSystems();
 
-    player = new Player(playerName);
+    // Fresh session statistics
+    turnCount = 0;
+    enemiesDefeated = 0;
+    sectorsExplored = 0;
+    hacksCompleted = 0;
+    lastAutoSaveTurn = 0;
+    SaveLoadManager::getInstance().beginSession();
+
+    {
+        MEM_SCOPE(MemSubsystem::ENTITY);
+        player = new Player(playerName);
+    }
     player->setCurrentSector(worldMap->getCurrentSector()->name);
 
     // Initialize AI Storyteller
     initializeOverseer(player);
     overseer = g_Overseer;
+    overseer->setBaseDifficulty(storytellerDifficulty(*config));
 
     // Give starting items
     Item* startWeapon = ItemDatabase::createWeapon("WEAPON_BASIC", "Energy Fist",
@@ -645,6 +863,7 @@ GameState Game::getState() const {
 }
 
 void Game::explore(const std::string& direction) {
+    PROFILE_SCOPE(ProfilePhase::GAME_EXPLORE);
     bool moved = false;
 
     if (direction == "n" || direction == "N" || direction == "north") {
@@ -668,12 +887,10 @@ void Game::explore(const std::string& direction) {
         if (overseer != nullptr) {
             overseer->evaluateAndTrigger();
         }
+        checkForRecruit();
 
-        // Check for enemies
-        if (worldMap->getCurrentSector()->hasEnemies()) {
-            std::cout << "\n*** ALERT: Hostiles detected! ***" << std::endl;
-            // Combat would be initiated here
-        }
+        // Check for enemies (enters COMBAT state if any)
+        checkForEncounter();
     }
 }
 
@@ -683,44 +900,199 @@ void Game::scanArea() {
     turnCount++;
 }
 
+// Start a hacking session; the actions themselves arrive through step()
+// while the game is in the HACKING state
 void Game::interactWithTerminal() {
     if (worldMap->getCurrentSector()->hasTerminal) {
         std::cout << "\nAccessing terminal..." << std::endl;
         hackingSystem->startHacking(worldMap->getCurrentSector()->dangerLevel * 10);
+        setState(GameState::HACKING);
+    } else {
+        std::cout << "No terminal available here." << std::endl;
+    }
+}
 
-        while (hackingSystem->isHacking()) {
-            hackingSystem->displayHackingInterface();
-            std::cout << "\nHack Actions:" << std::endl;
-            std::cout << "  1. Inject Code" << std::endl;
-            std::cout << "  2. Bypass Firewall" << std::endl;
-            std::cout << "  3. Decrypt Layer" << std::endl;
-            std::cout << "  4. Undo (uses revert token)" << std::endl;
-            std::cout << "  5. Abort" << std::endl;
-
-            std::string input = getInput();
-
-            if (input == "1") {
-                hackingSystem->injectCode("0x" + std::to_string(rand() % 10000));
-            } else if (input == "2") {
-                hackingSystem->bypassFirewall();
-            } else if (input == "3") {
-                hackingSystem->decryptLayer();
-            } else if (input == "4") {
-                hackingSystem->undoLastAction();
-            } else if (input == "5") {
-                break;
-            }
+// Close the hacking session and hand out rewards
+void Game::finishHacking() {
+    if (hackingSystem->isSuccess()) {
+        hacksCompleted++;
+        player->gainExperience(50);
+        logEvent("Successfully hacked terminal", "HACKING");
+    }
+
+    hackingSystem->endHacking();
+}
+
+// Spawn any encounter the Overseer requested, then fight whatever is here
+void Game::checkForEncounter() {
+    SectorNode* sector = worldMap->getCurrentSector();
+
+    if (overseer != nullptr && overseer->checkPendingEncounter()) {
+        int difficulty = overseer->consumePendingEncounter();
+
+        // Harder encounters arrive as waves (bounded by sector capacity)
+        const int MAX_WAVE = 3;
+        int waveSize = 1 + difficulty / 5;
+        int room = sector->maxEnemies - sector->enemyCount;
+        if (waveSize > MAX_WAVE) waveSize = MAX_WAVE;
+        if (waveSize > room) waveSize = room;
+
+        Sentinel* wave[MAX_WAVE];
+        int spawned = Sentinel::createRandomBatch(difficulty, waveSize, wave);
+        for (int i = 0; i < spawned; i++) {
+            sector->addEnemy(wave[i]);
+        }
+    }
+
+    if (sector->hasEnemies()) {
+        std::cout << "\n*** ALERT: Hostiles detected! ***" << std::endl;
+        startCombat();
+    }
+}
+
+// Recruit the Awakened the Overseer just revealed (if the party has room)
+void Game::checkForRecruit() {
+    if (overseer == nullptr || !overseer->checkPendingAlly()) return;
+    overseer->consumePendingAlly();
+
+    if (partyCount == MAX_PARTY) {
+        std::cout << "The Awakened sees your full party and slips away." << std::endl;
+        return;
+    }
+
+    static const char* const ALLY_NAMES[] = { "Niobe", "Switch", "Apoc", "Mouse", "Dozer", "Sparks" };
+    const int nameCount = sizeof(ALLY_NAMES) / sizeof(ALLY_NAMES[0]);
+    Awakened::Specialty specialty = static_cast<Awakened::Specialty>(rand() % 4);
+
+    Awakened* ally;
+    {
+        MEM_SCOPE(MemSubsystem::ENTITY);
+        ally = new Awakened(ALLY_NAMES[rand() % nameCount], specialty);
+    }
+    ally->join();
+    party[partyCount++] = ally;
+    logEvent(ally->getName() + " [" + ally->getSpecialtyString() + "] joined the party", "ALLY");
+}
+
+// Rebuild the party from a loaded save (replaces the current one)
+void Game::restoreParty(const SessionStats& stats) {
+    releaseParty();
+    MEM_SCOPE(MemSubsystem::ENTITY);
+    for (int i = 0; i < stats.partyCount && partyCount < MAX_PARTY; i++) {
+        Awakened* ally = new Awakened(stats.partyNames[i],
+                                      static_cast<Awakened::Specialty>(stats.partySpecialties[i]));
+        ally->setLoyalty(stats.partyLoyalty[i]);
+        ally->setHealth(stats.partyHealth[i]);
+        ally->join();
+        party[partyCount++] = ally;
+    }
+}
+
+// Delete every recruited Awakened
+void Game::releaseParty() {
+    for (int i = 0; i < partyCount; i++) {
+        delete party[i];
+        party[i] = nullptr;
+    }
+    partyCount = 0;
+}
+
+// Build the encounter from the current sector and enter the COMBAT state
+// Step 1: Copy the sector's Sentinels (and the party) into Entity arrays
+// Step 2: Start the combat queue
+// Step 3: Run AI turns until the player is up
+void Game::startCombat() {
+    MEM_SCOPE(MemSubsystem::COMBAT);
+    SectorNode* sector = worldMap->getCurrentSector();
+
+    // Step 1: Gather enemies
+    releaseCombat();
+    combatEnemyCount = sector->enemyCount;
+    combatEnemies = new Entity*[combatEnemyCount];
+    for (int i = 0; i < combatEnemyCount; i++) {
+        combatEnemies[i] = sector->enemies[i];
+    }
+    combatAllies = new Entity*[partyCount];
+    for (int i = 0; i < partyCount; i++) {
+        combatAllies[i] = party[i];
+    }
+
+    // Step 2: Start combat
+    combatSystem->initiateCombat(player, combatEnemies, combatEnemyCount,
+                                 combatAllies, partyCount);
+    logEvent("Engaged " + std::to_string(combatEnemyCount) + " hostile(s) in " +
+             sector->name, "COMBAT");
+    setState(GameState::COMBAT);
+
+    // Step 3: Faster enemies act first
+    advanceCombat();
+}
+
+// Process AI turns until the player must act or the fight is over
+void Game::advanceCombat() {
+    while (combatSystem->processTurn()) {
+        if (combatSystem->isPlayerTurn()) {
+            return;
         }
+    }
+    finishCombat();
+}
+
+// Hand out rewards (or end the game) once combat has been decided
+void Game::finishCombat() {
+    if (combatSystem->isDefeat()) {
+        logEvent("Deleted by the Sentinels", "COMBAT");
+        combatSystem->endCombat();
+        releaseCombat();
+        setState(GameState::GAME_OVER);
+        return;
+    }
 
-        if (hackingSystem->isSuccess()) {
-            hacksCompleted++;
-            player->gainExperience(50);
-            logEvent("Successfully hacked terminal", "HACKING");
+    int experience = combatSystem->calculateExperienceReward();
+    player->gainExperience(experience);
+    enemiesDefeated += combatEnemyCount;
+    giveItem(combatSystem->rollLootDrop());
+    logEvent("Defeated " + std::to_string(combatEnemyCount) + " Sentinel(s), +" +
+             std::to_string(experience) + " XP", "COMBAT");
+
+    combatSystem->endCombat();
+    worldMap->getCurrentSector()->clearEnemies();
+    releaseCombat();
+
+    // Surviving allies grow more loyal, fallen ones leave the party
+    int kept = 0;
+    for (int i = 0; i < partyCount; i++) {
+        if (party[i]->isAlive()) {
+            party[i]->increaseLoyalty(5);
+            party[kept++] = party[i];
+        } else {
+            logEvent(party[i]->getName() + " was lost in combat", "ALLY");
+            delete party[i];
         }
+    }
+    for (int i = kept; i < partyCount; i++) {
+        party[i] = nullptr;
+    }
+    partyCount = kept;
 
-        hackingSystem->endHacking();
-    } else {
-        std::cout << "No terminal available here." << std::endl;
+    setState(GameState::PLAYING);
+}
+
+// Free the encounter arrays (Sentinels belong to the sector, allies to the party)
+void Game::releaseCombat() {
+    delete[] combatEnemies;
+    delete[] combatAllies;
+    combatEnemies = nullptr;
+    combatAllies = nullptr;
+    combatEnemyCount = 0;
+}
+
+// Add a reward to the inventory, freeing it if it was stacked or rejected
+void Game::giveItem(Item* item) {
+    if (item == nullptr) return;
+
+    if (!inventory->addItem(item) || inventory->getItem(item->code) != item) {
+        delete item;
     }
 }
 
@@ -734,11 +1106,97 @@ void Game::rest() {
     if (overseer != nullptr) {
         overseer->evaluateAndTrigger();
     }
+
+    checkForRecruit();
+    checkForEncounter();
+}
+
+// Helper: Session counters and the party for the save system
+void Game::captureStats(SessionStats& stats) const {
+    stats.turnCount = turnCount;
+    stats.sectorsExplored = sectorsExplored;
+    stats.enemiesDefeated = enemiesDefeated;
+    stats.hacksCompleted = hacksCompleted;
+    stats.eventsTriggered = eventLog != nullptr ? eventLog->getEventCount() : 0;
+
+    static_assert(MAX_PARTY <= SAVE_MAX_PARTY, "a full party must fit in SessionStats");
+    stats.partyCount = partyCount;
+    for (int i = 0; i < partyCount; i++) {
+        stats.partyNames[i] = party[i]->getName();
+        stats.partySpecialties[i] = static_cast<int>(party[i]->getSpecialty());
+        stats.partyLoyalty[i] = party[i]->getLoyalty();
+        stats.partyHealth[i] = party[i]->getHealth();
+    }
+}
+
+// Helper: Queue a background auto-save once enough turns have passed
+// Only while exploring - combat and hacking sessions are not part of a save
+void Game::checkAutoSave() {
+    if (autoSaveInterval <= 0 || player == nullptr || currentState != GameState::PLAYING) {
+        return;
+    }
+    if (turnCount - lastAutoSaveTurn < autoSaveInterval) {
+        return;
+    }
+
+    SessionStats stats;
+    captureStats(stats);
+    SaveLoadManager::getInstance().autoSave(player, inventory, abilities, worldMap,
+                                             eventLog, stats);
+    lastAutoSaveTurn = turnCount;
+}
+
+// Helper: Push settings that changed since previous into the running systems
+// (verbose_mode is read by logEvent, show_tutorials by getConfig() readers)
+void Game::applyConfig(const ConfigData& previous) {
+    if (overseer != nullptr) {
+        overseer->setBaseDifficulty(storytellerDifficulty(*config));
+    }
+
+    if (!config->autoSave) {
+        autoSaveInterval = 0;
+    } else if (!previous.autoSave && autoSaveInterval == 0) {
+        autoSaveInterval = AUTOSAVE_INTERVAL;
+        lastAutoSaveTurn = turnCount;
+    }
+    SaveLoadManager::getInstance().setCompression(config->compressSaves);
+
+    // Only toggled on change, so a device that failed to open stays off
+    AudioManager& audio = AudioManager::getInstance();
+    if (config->audioEnabled != previous.audioEnabled) {
+        audio.enableAudio(config->audioEnabled);
+    }
+    audio.setMasterVolume(config->masterVolume);
+    audio.setMusicVolume(config->musicVolume);
+    audio.setSFXVolume(config->sfxVolume);
+}
+
+// Helper: Stat config.ini at most once per CONFIG_CHECK_MS, apply it if edited
+void Game::checkConfigReload() {
+    long long now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    if (now < nextConfigCheck) {
+        return;
+    }
+    nextConfigCheck = now + CONFIG_CHECK_MS;
+
+    ConfigData previous = *config;
+    if (SaveLoadManager::getInstance().reloadConfigIfChanged(*config)) {
+        applyConfig(previous);
+        std::cout << "[Game] Settings reloaded from config.ini." << std::endl;
+    }
+}
+
+void Game::setAutoSaveInterval(int turns) {
+    autoSaveInterval = turns;
 }
 
 bool Game::saveGame(const std::string& slot) {
+    SessionStats stats;
+    captureStats(stats);
+
     return SaveLoadManager::getInstance().saveGame(slot, player, inventory,
-                                                    abilities, worldMap, turnCount);
+                                                    abilities, worldMap, eventLog, stats);
 }
 
 bool Game::loadGame(const std::string& slot) {
@@ -747,14 +1205,31 @@ bool Game::loadGame(const std::string& slot) {
         return false;
     }
 
+    // Release systems left over from a previous session
+    if (itemDatabase != nullptr) {
+        cleanupSystems();
+    }
     initializeSystems();
-    player = new Player("Loading...");
+    {
+        MEM_SCOPE(MemSubsystem::ENTITY);
+        player = new Player("Loading...");
+    }
 
+    SessionStats stats;
     bool success = SaveLoadManager::getInstance().loadGame(slot, player, inventory,
-                                                            abilities, worldMap, turnCount);
+                                                            abilities, worldMap, eventLog,
+                                                            stats, itemDatabase);
     if (success) {
+        turnCount = stats.turnCount;
+        sectorsExplored = stats.sectorsExplored;
+        enemiesDefeated = stats.enemiesDefeated;
+        hacksCompleted = stats.hacksCompleted;
+        lastAutoSaveTurn = turnCount;
+        restoreParty(stats);
+
         initializeOverseer(player);
         overseer = g_Overseer;
+        overseer->setBaseDifficulty(storytellerDifficulty(*config));
         // Start the background music for the loaded game session
         AudioManager::getInstance().playMusic("ambient_grid.wav", true); // Use the same filename
         // ======================
@@ -768,52 +1243,128 @@ void Game::logEvent(const std::string& description, const std::string& type) {
     if (eventLog != nullptr) {
         eventLog->addEvent(description, type);
     }
+    if (config->verboseMode) {
+        std::cout << "[Log] " << type << ": " << description << std::endl;
+    }
 }
 
 Player* Game::getPlayer() const { return player; }
 Inventory* Game::getInventory() const { return inventory; }
 AbilityTree* Game::getAbilities() const { return abilities; }
 int Game::getTurnCount() const { return turnCount; }
+const ConfigData& Game::getConfig() const { return *config; }
+
+/*******************************************************************************
+ * STATE MACHINE
+ *
+ * Ordered by GameState so the current state indexes straight into the table.
+ * States without an entry (OPTIONS, QUIT) have no prompt or handler.
+ ******************************************************************************/
+
+const Game::StateHandler Game::stateTable[static_cast<int>(GameState::STATE_COUNT)] = {
+    { GameState::MAIN_MENU,      &Game::promptMainMenu,      &Game::handleMainMenu },
+    { GameState::NEW_GAME,       &Game::promptNewGame,       &Game::handleNewGame },
+    { GameState::LOAD_GAME,      &Game::promptLoadGame,      &Game::handleLoadGame },
+    { GameState::PLAYING,        &Game::promptPlaying,       &Game::handlePlaying },
+    { GameState::COMBAT,         &Game::promptCombat,        &Game::handleCombat },
+    { GameState::HACKING,        &Game::promptHacking,       &Game::handleHacking },
+    { GameState::INVENTORY,      &Game::promptInventory,     &Game::handleInventory },
+    { GameState::ABILITIES,      &Game::promptAbilities,     &Game::handleAbilities },
+    { GameState::EVENT_LOG,      &Game::promptEventLog,      &Game::handleEventLog },
+    { GameState::SAVE_MENU,      &Game::promptSaveMenu,      &Game::handleSaveMenu },
+    { GameState::OPTIONS,        nullptr,                    nullptr },
+    { GameState::GAME_OVER,      &Game::promptGameOver,      &Game::handleGameOver },
+    { GameState::VICTORY,        &Game::promptVictory,       &Game::handleVictory },
+    { GameState::UNLOCK_ABILITY, &Game::promptUnlockAbility, &Game::handleUnlockAbility },
+    { GameState::COMBAT_ABILITY, &Game::promptCombatAbility, &Game::handleCombatAbility },
+    { GameState::QUIT,           nullptr,                    nullptr }
+};
+
+// A row that does not carry the state it is indexed by (table out of order
+// or missing an entry) falls back to a search by the state field
+const Game::StateHandler* Game::findHandler(GameState state) {
+    int index = static_cast<int>(state);
+    if (index < 0 || index >= static_cast<int>(GameState::STATE_COUNT)) {
+        return nullptr;
+    }
+    if (stateTable[index].state == state) {
+        return &stateTable[index];
+    }
+
+    for (int i = 0; i < static_cast<int>(GameState::STATE_COUNT); i++) {
+        if (stateTable[i].state == state) {
+            return &stateTable[i];
+        }
+    }
+    return nullptr;
+}
+
+// Show the prompt for the current state
+void Game::prompt() const {
+    const StateHandler* entry = findHandler(currentState);
+    if (entry != nullptr && entry->prompt != nullptr) {
+        (this->*(entry->prompt))();
+    }
+}
+
+// STEP: Feed one line of input to the state machine
+// Step 1: Look up the handler for the current state
+// Step 2: Let it consume the input and pick the next state
+// Step 3: Apply the transition, return false once the game has quit
+bool Game::step(const std::string& input) {
+    PROFILE_SCOPE(ProfilePhase::GAME_STEP);
+    if (!isRunning) return false;
+
+    // Step 1: Find handler
+    const StateHandler* entry = findHandler(currentState);
+
+    // Step 2: Handle input (states without a handler fall back to the menu)
+    GameState next = GameState::MAIN_MENU;
+    int turnBefore = turnCount;
+    if (entry != nullptr && entry->handle != nullptr) {
+        next = (this->*(entry->handle))(input);
+    }
+    if (turnCount != turnBefore) {
+        MEM_END_TURN();
+    }
+
+    // Step 3: Transition
+    if (next != currentState) {
+        setState(next);
+    }
+
+    if (currentState == GameState::QUIT) {
+        isRunning = false;
+    }
+
+    // Settings edited while the game runs take effect between inputs
+    if (itemDatabase != nullptr) {
+        checkConfigReload();
+    }
+
+    // Auto-save is queued here and written by a background thread
+    if (turnCount != turnBefore) {
+        checkAutoSave();
+    }
 
-// Main game loop
+    return isRunning;
+}
+
+// Main game loop - console driver for the state machine
 void Game::run() {
     displayTitle();
 
     while (isRunning) {
-        switch (currentState) {
-            case GameState::MAIN_MENU:
-                handleMainMenu();
-                break;
-            case GameState::NEW_GAME:
-                handleNewGame();
-                break;
-            case GameState::PLAYING:
-                handlePlaying();
-                break;
-            case GameState::INVENTORY:
-                handleInventory();
-                break;
-            case GameState::ABILITIES:
-                handleAbilities();
-                break;
-            case GameState::EVENT_LOG:
-                handleEventLog();
-                break;
-            case GameState::SAVE_MENU:
-                handleSaveMenu();
-                break;
-            case GameState::GAME_OVER:
-                handleGameOver();
-                break;
-            case GameState::VICTORY:
-                handleVictory();
-                break;
-            case GameState::QUIT:
-                isRunning = false;
-                break;
-            default:
-                break;
+        prompt();
+        std::string input = getInput();
+
+        // End of input (closed console or replay file) quits the game
+        if (!std::cin) {
+            quit();
+            break;
         }
+
+        step(input);
     }
 
     std::cout << "\nThank you for playing Digital Exodus!" << std::endl;
@@ -823,67 +1374,215 @@ void Game::quit() {
     isRunning = false;
 }
 
-void Game::handleMainMenu() {
+bool Game::isActive() const {
+    return isRunning;
+}
+
+/*******************************************************************************
+ * STATE PROMPTS AND HANDLERS
+ ******************************************************************************/
+
+void Game::promptMainMenu() const {
     displayMainMenu();
-    std::string input = getInput();
+}
 
+GameState Game::handleMainMenu(const std::string& input) {
     if (input == "1") {
-        setState(GameState::NEW_GAME);
+        return GameState::NEW_GAME;
     } else if (input == "2") {
-        std::cout << "Enter save name: ";
-        std::string slot = getInput();
-        if (loadGame(slot)) {
-            setState(GameState::PLAYING);
-        }
+        return GameState::LOAD_GAME;
     } else if (input == "3") {
         AudioManager::getInstance().displayStatus();
     } else if (input == "4") {
-        setState(GameState::QUIT);
+        return GameState::QUIT;
     }
+    return GameState::MAIN_MENU;
 }
 
-void Game::handleNewGame() {
+void Game::promptNewGame() const {
     std::cout << "\nEnter your name, Awakened one: ";
-    std::string name = getInput();
+}
 
+GameState Game::handleNewGame(const std::string& input) {
+    std::string name = input;
     if (name.empty()) name = "Unknown";
 
     newGame(name);
+    return GameState::PLAYING;
 }
 
-void Game::handlePlaying() {
+void Game::promptLoadGame() const {
+    // The save system is set up with a session; the menu may come first
+    SaveLoadManager& saves = SaveLoadManager::getInstance();
+    if (!saves.isInitialized()) {
+        saves.initialize("saves");
+    }
+
+    int count = 0;
+    std::string* slots = saves.listSaves(count);
+    std::cout << "\n=== LOAD GAME ===" << std::endl;
+    if (count == 0) {
+        std::cout << "No saved games found." << std::endl;
+    }
+    for (int i = 0; i < count; i++) {
+        std::cout << "  " << slots[i] << ": " << saves.getSaveInfo(slots[i]) << std::endl;
+    }
+    delete[] slots;
+    std::cout << "Enter save name: ";
+}
+
+GameState Game::handleLoadGame(const std::string& input) {
+    if (loadGame(input)) {
+        return GameState::PLAYING;
+    }
+    return GameState::MAIN_MENU;
+}
+
+void Game::promptPlaying() const {
     displayStats();
     displayGameScreen();
+}
 
-    std::string input = getInput();
+GameState Game::handlePlaying(const std::string& input) {
+    GameState next = GameState::PLAYING;
 
     if (input == "n" || input == "N" || input == "s" || input == "S" ||
         input == "e" || input == "E" || input == "w" || input == "W") {
         explore(input);
+        next = currentState;    // COMBAT if hostiles were found
     } else if (input == "i" || input == "I") {
-        setState(GameState::INVENTORY);
+        next = GameState::INVENTORY;
     } else if (input == "a" || input == "A") {
-        setState(GameState::ABILITIES);
+        next = GameState::ABILITIES;
     } else if (input == "l" || input == "L") {
-        setState(GameState::EVENT_LOG);
+        next = GameState::EVENT_LOG;
     } else if (input == "h" || input == "H") {
         interactWithTerminal();
+        next = currentState;    // HACKING if a terminal was found
     } else if (input == "r" || input == "R") {
         rest();
+        next = currentState;
     } else if (input == "v" || input == "V") {
-        setState(GameState::SAVE_MENU);
+        next = GameState::SAVE_MENU;
     } else if (input == "q" || input == "Q") {
-        setState(GameState::MAIN_MENU);
         cleanupSystems();
+        return GameState::MAIN_MENU;
+#ifdef DEXODUS_PROFILE
+    } else if (input == "p" || input == "P") {
+        // Hidden in profiling builds: dump phase timings on demand
+        Profiler::getInstance().displayReport();
+        Profiler::getInstance().exportChromeTrace("profile_trace.json");
+#endif
+#ifdef DEXODUS_MEMPROFILE
+    } else if (input == "m" || input == "M") {
+        // Hidden in memprofile builds: dump per-subsystem memory usage
+        MemoryTracker::displayReport();
+#endif
     }
 
     // Check game over condition
     if (player != nullptr && !player->isAlive()) {
-        setState(GameState::GAME_OVER);
+        next = GameState::GAME_OVER;
+    }
+
+    return next;
+}
+
+void Game::promptCombat() const {
+    combatSystem->displayCombatStatus();
+    combatSystem->displayPlayerOptions();
+}
+
+// Helper: The first Sentinel still standing (target of attacks and abilities)
+Entity* Game::combatTarget() const {
+    for (int i = 0; i < combatEnemyCount; i++) {
+        if (combatEnemies[i]->isAlive()) {
+            return combatEnemies[i];
+        }
+    }
+    return nullptr;
+}
+
+// One player action, then AI turns until the player is up again
+GameState Game::handleCombat(const std::string& input) {
+    Entity* target = combatTarget();
+
+    if (input == "1") {
+        combatSystem->playerAttack(target);
+    } else if (input == "2") {
+        combatSystem->playerDefend();
+    } else if (input == "3") {
+        if (abilities->getUnlockedCount() > 0) {
+            return GameState::COMBAT_ABILITY;
+        }
+        std::cout << "No abilities unlocked." << std::endl;
+        return GameState::COMBAT;
+    } else if (input == "4") {
+        // Use the first consumable in the inventory
+        InventoryIterator* it = inventory->createIterator("consumables");
+        Item* item = it->hasNext() ? it->next() : nullptr;
+        delete it;
+
+        if (item != nullptr) {
+            combatSystem->playerUseItem(item->code);
+            player->heal(item->value);
+            inventory->decreaseQuantity(item->code, 1);
+        } else {
+            std::cout << "No consumables available." << std::endl;
+        }
+    } else if (input == "5") {
+        combatSystem->playerFlee();
+        if (!combatSystem->isInCombat()) {
+            logEvent("Fled from combat", "COMBAT");
+            releaseCombat();
+            return GameState::PLAYING;
+        }
+    } else {
+        std::cout << "Invalid action." << std::endl;
+        return GameState::COMBAT;
+    }
+
+    turnCount++;
+    advanceCombat();
+    return currentState;
+}
+
+void Game::promptHacking() const {
+    hackingSystem->displayHackingInterface();
+    std::cout << "\nHack Actions:" << std::endl;
+    std::cout << "  1. Inject Code" << std::endl;
+    std::cout << "  2. Bypass Firewall" << std::endl;
+    std::cout << "  3. Decrypt Layer" << std::endl;
+    std::cout << "  4. Undo (uses revert token)" << std::endl;
+    std::cout << "  5. Abort" << std::endl;
+}
+
+GameState Game::handleHacking(const std::string& input) {
+    bool abort = false;
+
+    if (input == "1") {
+        hackingSystem->injectCode("0x" + std::to_string(rand() % 10000));
+    } else if (input == "2") {
+        hackingSystem->bypassFirewall();
+    } else if (input == "3") {
+        hackingSystem->decryptLayer();
+    } else if (input == "4") {
+        hackingSystem->undoLastAction();
+    } else if (input == "5") {
+        abort = true;
+    }
+
+    // Session ends on abort, success, lockout or running out of attempts
+    if (abort || !hackingSystem->isHacking() || hackingSystem->isSuccess() ||
+        hackingSystem->getRemainingAttempts() <= 0) {
+        finishHacking();
+        return GameState::PLAYING;
     }
+
+    return GameState::HACKING;
 }
 
-void Game::handleInventory() {
+void Game::promptInventory() const {
     inventory->displayAll();
 
     // Demonstrate iterator pattern
@@ -892,15 +1591,14 @@ void Game::handleInventory() {
     std::cout << "  2. Weapons" << std::endl;
     std::cout << "  3. Consumables" << std::endl;
     std::cout << "  4. Back" << std::endl;
+}
 
-    std::string input = getInput();
-
+GameState Game::handleInventory(const std::string& input) {
     std::string filter = "all";
     if (input == "2") filter = "weapons";
     else if (input == "3") filter = "consumables";
     else if (input == "4") {
-        setState(GameState::PLAYING);
-        return;
+        return GameState::PLAYING;
     }
 
     // Use iterator to display filtered items
@@ -916,68 +1614,114 @@ void Game::handleInventory() {
     if (count == 0) {
         std::cout << "No items of this type." << std::endl;
     }
+
+    return GameState::INVENTORY;
 }
 
-void Game::handleAbilities() {
+void Game::promptAbilities() const {
     abilities->displayTree();
 
     std::cout << "\nOptions:" << std::endl;
     std::cout << "  1. Unlock ability" << std::endl;
     std::cout << "  2. View unlocked" << std::endl;
     std::cout << "  3. Back" << std::endl;
+}
 
-    std::string input = getInput();
-
+GameState Game::handleAbilities(const std::string& input) {
     if (input == "1") {
-        abilities->displayAvailable();
-        std::cout << "Enter ability code to unlock: ";
-        std::string code = getInput();
-        abilities->unlock(code);
+        return GameState::UNLOCK_ABILITY;
     } else if (input == "2") {
         abilities->displayUnlocked();
-    } else {
-        setState(GameState::PLAYING);
+        return GameState::ABILITIES;
     }
+    return GameState::PLAYING;
+}
+
+void Game::promptCombatAbility() const {
+    abilities->displayUnlocked();
+    std::cout << "Enter ability number (or 'back'): ";
 }
 
-void Game::handleEventLog() {
+// Use the chosen unlocked ability (numbered as displayUnlocked lists them)
+GameState Game::handleCombatAbility(const std::string& input) {
+    int count = 0;
+    Ability** unlocked = abilities->getUnlockedAbilities(count);
+    const Ability* chosen = nullptr;
+    for (int i = 0; i < count; i++) {
+        if (input == std::to_string(i + 1)) {
+            chosen = unlocked[i];
+            break;
+        }
+    }
+
+    if (chosen == nullptr) {
+        delete[] unlocked;
+        if (input != "back") {
+            std::cout << "Invalid ability." << std::endl;
+        }
+        return GameState::COMBAT;
+    }
+
+    combatSystem->playerUseAbility(*chosen, combatTarget());
+    delete[] unlocked;
+
+    turnCount++;
+    advanceCombat();
+    return currentState == GameState::COMBAT_ABILITY ? GameState::COMBAT : currentState;
+}
+
+void Game::promptUnlockAbility() const {
+    abilities->displayAvailable();
+    std::cout << "Enter ability code to unlock: ";
+}
+
+GameState Game::handleUnlockAbility(const std::string& input) {
+    abilities->unlock(input);
+    return GameState::ABILITIES;
+}
+
+void Game::promptEventLog() const {
     std::cout << "\nEvent Log Options:" << std::endl;
     std::cout << "  1. Show recent (5)" << std::endl;
     std::cout << "  2. Show all" << std::endl;
     std::cout << "  3. Back" << std::endl;
+}
 
-    std::string input = getInput();
-
+GameState Game::handleEventLog(const std::string& input) {
     if (input == "1") {
         eventLog->displayRecent(5);
     } else if (input == "2") {
         eventLog->displayAll();
     } else {
-        setState(GameState::PLAYING);
+        return GameState::PLAYING;
     }
+    return GameState::EVENT_LOG;
 }
 
-void Game::handleSaveMenu() {
+void Game::promptSaveMenu() const {
     std::cout << "\n=== SAVE GAME ===" << std::endl;
     std::cout << "Enter save name (or 'back'): ";
-    std::string slot = getInput();
+}
 
-    if (slot != "back" && !slot.empty()) {
-        saveGame(slot);
+GameState Game::handleSaveMenu(const std::string& input) {
+    if (input != "back" && !input.empty()) {
+        saveGame(input);
     }
-
-    setState(GameState::PLAYING);
+    return GameState::PLAYING;
 }
 
-void Game::handleGameOver() {
+void Game::promptGameOver() const {
     displayGameOver();
     std::cout << "\nPress Enter to return to main menu..." << std::endl;
-    getInput();
+}
+
+GameState Game::handleGameOver(const std::string& input) {
+    (void)input;  // Any input returns to the menu
     cleanupSystems();
-    setState(GameState::MAIN_MENU);
+    return GameState::MAIN_MENU;
 }
 
-void Game::handleVictory() {
+void Game::promptVictory() const {
     displayVictory();
     std::cout << "\nFinal Statistics:" << std::endl;
     std::cout << "  Turns: " << turnCount << std::endl;
@@ -986,7 +1730,10 @@ void Game::handleVictory() {
     std::cout << "  Hacks Completed: " << hacksCompleted << std::endl;
 
     std::cout << "\nPress Enter to return to main menu..." << std::endl;
-    getInput();
+}
+
+GameState Game::handleVictory(const std::string& input) {
+    (void)input;  // Any input returns to the menu
     cleanupSystems();
-    setState(GameState::MAIN_MENU);
-}
\ No newline at end of file
+    return GameState::MAIN_MENU;
+}
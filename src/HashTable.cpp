@@ -8,6 +8,7 @@
  ******************************************************************************/
 
 #include "../include/HashTable.h"
+#include "../include/MemoryTracker.h"
 
 /*******************************************************************************
  * ITEM STRUCTURE IMPLEMENTATION
@@ -44,6 +45,7 @@ HashNode::~HashNode() {
 
 // Constructor: Initialize empty buckets
 HashTable::HashTable() : itemCount(0) {
+    MEM_SCOPE(MemSubsystem::ITEMS);
     // Allocate array of bucket pointers
     buckets = new HashNode*[TABLE_SIZE];
 
@@ -100,6 +102,7 @@ unsigned int HashTable::hashFunction(const std::string& key) const {
 // Step 2: Create new HashNode
 // Step 3: Insert at head of bucket's chain
 void HashTable::insert(const std::string& key, Item* item) {
+    MEM_SCOPE(MemSubsystem::ITEMS);
     // Step 1: Calculate the bucket index
     unsigned int index = hashFunction(key);
 
@@ -214,6 +217,7 @@ void HashTable::displayAll() const {
 
 // Get all items as array
 Item** HashTable::getAllItems(int& outCount) const {
+    MEM_SCOPE(MemSubsystem::ITEMS);
     if (itemCount == 0) {
         outCount = 0;
         return nullptr;
@@ -239,6 +243,7 @@ Item** HashTable::getAllItems(int& outCount) const {
  ******************************************************************************/
 
 ItemDatabase::ItemDatabase() {
+    MEM_SCOPE(MemSubsystem::ITEMS);
     table = new HashTable();
 }
 
@@ -248,6 +253,7 @@ ItemDatabase::~ItemDatabase() {
 
 // Initialize with default game items
 void ItemDatabase::initializeDefaultItems() {
+    MEM_SCOPE(MemSubsystem::ITEMS);
     // Weapons
     addItem(createWeapon("WEAPON_PULSE", "Pulse Rifle",
             "Standard energy weapon for combat", 15));
@@ -272,6 +278,14 @@ void ItemDatabase::initializeDefaultItems() {
     addItem(createHackTool("HACK_ELITE", "Quantum Key",
             "Unlocks the most secure terminals", 50));
 
+    // Items handed out by the game itself (start kit, loot, hack rewards)
+    addItem(createWeapon("WEAPON_BASIC", "Energy Fist",
+            "Basic combat program", 10));
+    addItem(createConsumable("HEAL_START", "Data Fragment",
+            "Restores 25 HP", 25));
+    addItem(createHackTool("HACK_REWARD", "Extracted Data",
+            "Valuable system data", 10));
+
     std::cout << "[ItemDatabase] Initialized with default items." << std::endl;
 }
 
@@ -294,18 +308,38 @@ void ItemDatabase::displayAllItems() const {
     table->displayAll();
 }
 
+// Bulk lookup: one hash per distinct run of codes
+int ItemDatabase::resolveItems(const std::string* codes, int count, Item** out) const {
+    int resolved = 0;
+    const std::string* previous = nullptr;
+    Item* previousItem = nullptr;
+
+    for (int i = 0; i < count; i++) {
+        if (previous == nullptr || codes[i] != *previous) {
+            previous = &codes[i];
+            previousItem = table->get(codes[i]);
+        }
+        out[i] = previousItem;
+        if (previousItem != nullptr) resolved++;
+    }
+    return resolved;
+}
+
 // Factory methods
 Item* ItemDatabase::createWeapon(const std::string& code, const std::string& name,
                                   const std::string& desc, int damage) {
+    MEM_SCOPE(MemSubsystem::ITEMS);
     return new Item(code, name, desc, Item::Type::WEAPON, damage);
 }
 
 Item* ItemDatabase::createConsumable(const std::string& code, const std::string& name,
                                       const std::string& desc, int healAmount) {
+    MEM_SCOPE(MemSubsystem::ITEMS);
     return new Item(code, name, desc, Item::Type::CONSUMABLE, healAmount);
 }
 
 Item* ItemDatabase::createHackTool(const std::string& code, const std::string& name,
                                     const std::string& desc, int power) {
+    MEM_SCOPE(MemSubsystem::ITEMS);
     return new Item(code, name, desc, Item::Type::HACK_TOOL, power);
 }
\ No newline at end of file
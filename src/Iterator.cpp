@@ -8,17 +8,22 @@
  ******************************************************************************/
 
 #include "../include/Iterator.h"
+#include "../include/MemoryTracker.h"
 
 /*******************************************************************************
  * INVENTORY IMPLEMENTATION
  ******************************************************************************/
 
 Inventory::Inventory(int capacity)
-    : head(nullptr), itemCount(0), maxCapacity(capacity) {
+    : head(nullptr), itemCount(0), maxCapacity(capacity), modCount(0) {
 }
 
 Inventory::~Inventory() {
-    // Delete all nodes
+    clear();
+}
+
+// Delete all nodes
+void Inventory::clear() {
     InventoryNode* current = head;
     while (current != nullptr) {
         InventoryNode* temp = current;
@@ -27,10 +32,33 @@ Inventory::~Inventory() {
         delete temp->item;
         delete temp;
     }
+    head = nullptr;
+    itemCount = 0;
+    modCount++;
+}
+
+// Bulk restore: build the list back to front so items[0] ends up at head
+void Inventory::restoreItems(Item** items, int count) {
+    MEM_SCOPE(MemSubsystem::INVENTORY);
+    if (items == nullptr || count <= 0) return;
+
+    if (itemCount + count > maxCapacity) {
+        maxCapacity = itemCount + count;
+    }
+    modCount++;
+
+    for (int i = count - 1; i >= 0; i--) {
+        if (items[i] == nullptr) continue;
+        InventoryNode* newNode = new InventoryNode(items[i]);
+        newNode->next = head;
+        head = newNode;
+        itemCount++;
+    }
 }
 
 // Add item to inventory
 bool Inventory::addItem(Item* item) {
+    MEM_SCOPE(MemSubsystem::INVENTORY);
     if (item == nullptr) return false;
 
     // Check if item already exists (stack it)
@@ -49,6 +77,7 @@ bool Inventory::addItem(Item* item) {
     newNode->next = head;
     head = newNode;
     itemCount++;
+    modCount++;
 
     std::cout << "Added to inventory: " << item->name << std::endl;
     return true;
@@ -73,6 +102,7 @@ bool Inventory::removeItem(const std::string& code) {
             delete current->item;
             delete current;
             itemCount--;
+            modCount++;
             return true;
         }
 
@@ -105,6 +135,7 @@ bool Inventory::increaseQuantity(const std::string& code, int amount) {
     Item* item = getItem(code);
     if (item != nullptr) {
         item->quantity += amount;
+        modCount++;
         std::cout << item->name << " x" << item->quantity << std::endl;
         return true;
     }
@@ -116,6 +147,7 @@ bool Inventory::decreaseQuantity(const std::string& code, int amount) {
     Item* item = getItem(code);
     if (item != nullptr) {
         item->quantity -= amount;
+        modCount++;
         if (item->quantity <= 0) {
             removeItem(code);
         }
@@ -129,6 +161,7 @@ int Inventory::getItemCount() const { return itemCount; }
 int Inventory::getMaxCapacity() const { return maxCapacity; }
 bool Inventory::isFull() const { return itemCount >= maxCapacity; }
 bool Inventory::isEmpty() const { return head == nullptr; }
+int Inventory::getModCount() const { return modCount; }
 
 // Display all items
 void Inventory::displayAll() const {
@@ -158,6 +191,7 @@ void Inventory::displayAll() const {
 
 // ITERATOR FACTORY METHOD: Create iterator based on filter type
 InventoryIterator* Inventory::createIterator(const std::string& filter) const {
+    MEM_SCOPE(MemSubsystem::INVENTORY);
     return new InventoryIterator(this, filter);
 }
 
@@ -271,6 +305,7 @@ Item* InventoryIterator::current() const {
 
 SortedInventoryIterator::SortedInventoryIterator(const Inventory* inv, SortBy sortBy)
     : sortedItems(nullptr), totalItems(0), currentIndex(0) {
+    MEM_SCOPE(MemSubsystem::INVENTORY);
 
     // Count items
     InventoryNode* node = inv->getHead();
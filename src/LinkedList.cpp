@@ -9,6 +9,7 @@
 
 #include "../include/LinkedList.h"
 #include "../include/Entity.h"
+#include "../include/MemoryTracker.h"
 #include <ctime>
 #include <sstream>
 #include <cstring>
@@ -59,6 +60,7 @@ EventLog::~EventLog() {
 // Step 3: Update head to point to new node
 // Step 4: Increment event count
 void EventLog::addEvent(const std::string& description, const std::string& type) {
+    MEM_SCOPE(MemSubsystem::EVENT_LOG);
     // Step 1: Create new node
     EventNode* newNode = new EventNode(description, type);
 
@@ -74,6 +76,17 @@ void EventLog::addEvent(const std::string& description, const std::string& type)
     std::cout << "[EventLog] Added: [" << type << "] " << description << std::endl;
 }
 
+// Restore a saved event at head (callers replay oldest first)
+void EventLog::restoreEvent(const std::string& description, const std::string& type,
+                            const std::string& timestamp) {
+    MEM_SCOPE(MemSubsystem::EVENT_LOG);
+    EventNode* newNode = new EventNode(description, type);
+    newNode->timestamp = timestamp;
+    newNode->next = head;
+    head = newNode;
+    eventCount++;
+}
+
 // DISPLAY RECENT: Show last n events
 // Step 1: Start at head (most recent)
 // Step 2: Traverse and display up to n events
@@ -154,6 +167,7 @@ bool EventLog::isEmpty() const {
 
 // Get events as string array (for save system)
 std::string* EventLog::getEventsAsArray(int& outCount) const {
+    MEM_SCOPE(MemSubsystem::EVENT_LOG);
     if (isEmpty()) {
         outCount = 0;
         return nullptr;
@@ -172,6 +186,10 @@ std::string* EventLog::getEventsAsArray(int& outCount) const {
     return events;
 }
 
+const EventNode* EventLog::getHead() const {
+    return head;
+}
+
 /*******************************************************************************
  * SECTOR NODE IMPLEMENTATION (Doubly Linked List)
  ******************************************************************************/
@@ -181,6 +199,7 @@ SectorNode::SectorNode(const std::string& name, const std::string& desc, int dan
       visited(false), hasTerminal(false),
       north(nullptr), south(nullptr), east(nullptr), west(nullptr),
       enemies(nullptr), enemyCount(0), maxEnemies(5) {
+    MEM_SCOPE(MemSubsystem::GRID_MAP);
 
     // Allocate enemy array
     enemies = new Sentinel*[maxEnemies];
@@ -243,6 +262,7 @@ bool SectorNode::hasEnemies() const {
 GridMap::GridMap()
     : currentSector(nullptr), startSector(nullptr),
       allSectors(nullptr), sectorCount(0), maxSectors(50) {
+    MEM_SCOPE(MemSubsystem::GRID_MAP);
 
     allSectors = new SectorNode*[maxSectors];
     for (int i = 0; i < maxSectors; i++) {
@@ -444,6 +464,7 @@ SectorNode* GridMap::findSector(const std::string& name) const {
 
 // Initialize default game map
 void GridMap::initializeDefaultMap() {
+    MEM_SCOPE(MemSubsystem::GRID_MAP);
     // Create sectors
     SectorNode* spawn = new SectorNode("Data Stream Junction",
         "A central hub where data flows converge. Faint pulses of light stream through the corridors.", 1);
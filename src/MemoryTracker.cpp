@@ -0,0 +1,281 @@
+/*******************************************************************************
+ * MemoryTracker.cpp - Per-Subsystem Allocation Accounting Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/MemoryTracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <new>
+
+namespace {
+
+const int SUBSYSTEMS = static_cast<int>(MemSubsystem::SUBSYSTEM_COUNT);
+
+// Counters (constant-initialised, safe before static constructors run)
+std::atomic<uint64_t> liveBytes[SUBSYSTEMS];
+std::atomic<uint64_t> peakBytes[SUBSYSTEMS];
+std::atomic<uint64_t> allocations[SUBSYSTEMS];
+std::atomic<uint64_t> frees[SUBSYSTEMS];
+std::atomic<uint64_t> bytesAllocated[SUBSYSTEMS];
+
+// Per-turn counters
+std::atomic<uint64_t> turnAllocations[SUBSYSTEMS];
+std::atomic<uint64_t> turnBytes[SUBSYSTEMS];
+std::atomic<uint64_t> turnPeakBytes[SUBSYSTEMS];
+std::atomic<uint64_t> lastTurnAllocations[SUBSYSTEMS];
+std::atomic<uint64_t> lastTurnBytes[SUBSYSTEMS];
+std::atomic<uint64_t> lastTurnPeakBytes[SUBSYSTEMS];
+std::atomic<uint64_t> maxTurnAllocations[SUBSYSTEMS];
+std::atomic<uint64_t> turnsCompleted(0);
+
+thread_local MemSubsystem currentTag = MemSubsystem::OTHER;
+
+// Raise a high-water mark if value exceeds it
+void raiseTo(std::atomic<uint64_t>& mark, uint64_t value) {
+    uint64_t seen = mark.load(std::memory_order_relaxed);
+    while (value > seen &&
+           !mark.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+    }
+}
+
+int indexOf(MemSubsystem tag) {
+    int index = static_cast<int>(tag);
+    return (index >= 0 && index < SUBSYSTEMS) ? index : 0;
+}
+
+} // namespace
+
+/*******************************************************************************
+ * MEMORY TRACKER IMPLEMENTATION
+ ******************************************************************************/
+
+void MemoryTracker::recordAlloc(MemSubsystem tag, size_t bytes) {
+    int i = indexOf(tag);
+
+    uint64_t live = liveBytes[i].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    allocations[i].fetch_add(1, std::memory_order_relaxed);
+    bytesAllocated[i].fetch_add(bytes, std::memory_order_relaxed);
+    turnAllocations[i].fetch_add(1, std::memory_order_relaxed);
+    turnBytes[i].fetch_add(bytes, std::memory_order_relaxed);
+
+    raiseTo(peakBytes[i], live);
+    raiseTo(turnPeakBytes[i], live);
+}
+
+void MemoryTracker::recordFree(MemSubsystem tag, size_t bytes) {
+    int i = indexOf(tag);
+
+    liveBytes[i].fetch_sub(bytes, std::memory_order_relaxed);
+    frees[i].fetch_add(1, std::memory_order_relaxed);
+}
+
+MemSubsystem MemoryTracker::getCurrentTag() {
+    return currentTag;
+}
+
+MemSubsystem MemoryTracker::setCurrentTag(MemSubsystem tag) {
+    MemSubsystem previous = currentTag;
+    currentTag = tag;
+    return previous;
+}
+
+// END TURN: Roll per-turn counters over
+// Step 1: Publish this turn's counts as "last turn"
+// Step 2: Track the worst turn seen
+// Step 3: Reset counters, peak restarts from current live bytes
+void MemoryTracker::endTurn() {
+    for (int i = 0; i < SUBSYSTEMS; i++) {
+        // Step 1: Publish
+        uint64_t count = turnAllocations[i].exchange(0, std::memory_order_relaxed);
+        lastTurnAllocations[i].store(count, std::memory_order_relaxed);
+        lastTurnBytes[i].store(turnBytes[i].exchange(0, std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+        lastTurnPeakBytes[i].store(turnPeakBytes[i].load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+
+        // Step 2: Worst turn
+        raiseTo(maxTurnAllocations[i], count);
+
+        // Step 3: Reset peak
+        turnPeakBytes[i].store(liveBytes[i].load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+    }
+    turnsCompleted.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool MemoryTracker::isEnabled() {
+#ifdef DEXODUS_MEMPROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+MemoryTracker::Stats MemoryTracker::getStats(MemSubsystem tag) {
+    int i = indexOf(tag);
+
+    Stats stats;
+    stats.liveBytes = liveBytes[i].load(std::memory_order_relaxed);
+    stats.peakBytes = peakBytes[i].load(std::memory_order_relaxed);
+    stats.allocations = allocations[i].load(std::memory_order_relaxed);
+    stats.frees = frees[i].load(std::memory_order_relaxed);
+    stats.bytesAllocated = bytesAllocated[i].load(std::memory_order_relaxed);
+    stats.lastTurnAllocations = lastTurnAllocations[i].load(std::memory_order_relaxed);
+    stats.lastTurnBytes = lastTurnBytes[i].load(std::memory_order_relaxed);
+    stats.maxTurnAllocations = maxTurnAllocations[i].load(std::memory_order_relaxed);
+    stats.lastTurnPeakBytes = lastTurnPeakBytes[i].load(std::memory_order_relaxed);
+    return stats;
+}
+
+uint64_t MemoryTracker::getTotalLiveBytes() {
+    uint64_t total = 0;
+    for (int i = 0; i < SUBSYSTEMS; i++) {
+        total += liveBytes[i].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t MemoryTracker::getTotalAllocations() {
+    uint64_t total = 0;
+    for (int i = 0; i < SUBSYSTEMS; i++) {
+        total += allocations[i].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t MemoryTracker::getTurnCount() {
+    return turnsCompleted.load(std::memory_order_relaxed);
+}
+
+const char* MemoryTracker::getSubsystemName(MemSubsystem tag) {
+    switch (tag) {
+        case MemSubsystem::OTHER: return "Other";
+        case MemSubsystem::ENTITY: return "Entity";
+        case MemSubsystem::ITEMS: return "Items";
+        case MemSubsystem::INVENTORY: return "Inventory";
+        case MemSubsystem::EVENT_LOG: return "EventLog";
+        case MemSubsystem::GRID_MAP: return "GridMap";
+        case MemSubsystem::HACKING: return "Hacking";
+        case MemSubsystem::COMBAT: return "Combat";
+        case MemSubsystem::ABILITIES: return "Abilities";
+        case MemSubsystem::STORYTELLER: return "Storyteller";
+        case MemSubsystem::SAVE_LOAD: return "SaveLoad";
+        default: return "UNKNOWN";
+    }
+}
+
+// Display per-subsystem memory table
+void MemoryTracker::displayReport() {
+    if (!isEnabled()) {
+        std::cout << "[MemoryTracker] Not compiled in (build with 'make memprofile')." << std::endl;
+        return;
+    }
+
+    uint64_t turns = getTurnCount();
+
+    std::cout << "\n=== MEMORY REPORT (turns: " << turns << ") ===" << std::endl;
+    std::cout << std::left << std::setw(13) << "Subsystem"
+              << std::right << std::setw(11) << "Live B"
+              << std::setw(11) << "Peak B"
+              << std::setw(11) << "Allocs"
+              << std::setw(11) << "Alloc/turn"
+              << std::setw(11) << "Last turn"
+              << std::setw(11) << "Worst turn"
+              << std::setw(13) << "Turn peak B" << std::endl;
+
+    for (int i = 0; i < SUBSYSTEMS; i++) {
+        Stats s = getStats(static_cast<MemSubsystem>(i));
+        if (s.allocations == 0) continue;
+
+        double rate = turns > 0 ? static_cast<double>(s.allocations) / static_cast<double>(turns) : 0.0;
+
+        std::cout << std::left << std::setw(13) << getSubsystemName(static_cast<MemSubsystem>(i))
+                  << std::right << std::setw(11) << s.liveBytes
+                  << std::setw(11) << s.peakBytes
+                  << std::setw(11) << s.allocations
+                  << std::setw(11) << std::fixed << std::setprecision(1) << rate
+                  << std::setw(11) << s.lastTurnAllocations
+                  << std::setw(11) << s.maxTurnAllocations
+                  << std::setw(13) << s.lastTurnPeakBytes << std::endl;
+    }
+
+    std::cout << "Total live: " << getTotalLiveBytes() << " bytes" << std::endl;
+    std::cout << "==========================================" << std::endl;
+}
+
+/*******************************************************************************
+ * GLOBAL OPERATOR NEW/DELETE REPLACEMENT (memprofile builds only)
+ *
+ * Every block carries a 16-byte header holding its size and tag so the
+ * free can be charged back to the subsystem that allocated it. 16 bytes
+ * keeps the user pointer aligned for any fundamental type.
+ ******************************************************************************/
+#ifdef DEXODUS_MEMPROFILE
+
+namespace {
+
+struct AllocHeader {
+    uint64_t size;
+    uint32_t tag;
+    uint32_t padding;
+};
+
+static_assert(sizeof(AllocHeader) == 16, "AllocHeader must preserve 16-byte alignment");
+
+void* trackedAlloc(size_t size) {
+    void* raw = std::malloc(sizeof(AllocHeader) + size);
+    if (raw == nullptr) return nullptr;
+
+    AllocHeader* header = static_cast<AllocHeader*>(raw);
+    header->size = size;
+    header->tag = static_cast<uint32_t>(currentTag);
+    header->padding = 0;
+
+    MemoryTracker::recordAlloc(currentTag, size);
+    return header + 1;
+}
+
+void trackedFree(void* ptr) {
+    if (ptr == nullptr) return;
+
+    AllocHeader* header = static_cast<AllocHeader*>(ptr) - 1;
+    MemoryTracker::recordFree(static_cast<MemSubsystem>(header->tag),
+                              static_cast<size_t>(header->size));
+    std::free(header);
+}
+
+} // namespace
+
+void* operator new(size_t size) {
+    void* ptr = trackedAlloc(size);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    void* ptr = trackedAlloc(size);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+
+#endif // DEXODUS_MEMPROFILE
@@ -9,6 +9,8 @@
 
 #include "../include/Observer.h"
 #include "../include/Entity.h"
+#include "../include/Profiler.h"
+#include "../include/MemoryTracker.h"
 
 // Global overseer instance
 Overseer* g_Overseer = nullptr;
@@ -19,6 +21,7 @@ Overseer* g_Overseer = nullptr;
 
 PlayerState::PlayerState(Player* player, int maxObs)
     : player(player), observerCount(0), maxObservers(maxObs) {
+    MEM_SCOPE(MemSubsystem::STORYTELLER);
     observers = new Observer*[maxObservers];
     for (int i = 0; i < maxObservers; i++) {
         observers[i] = nullptr;
@@ -70,6 +73,7 @@ void PlayerState::detach(Observer* observer) {
 // Step 1: Iterate through all observers
 // Step 2: Call update() on each with player reference
 void PlayerState::notify() {
+    PROFILE_SCOPE(ProfilePhase::PLAYERSTATE_NOTIFY);
     for (int i = 0; i < observerCount; i++) {
         if (observers[i] != nullptr) {
             observers[i]->update(player);
@@ -87,7 +91,8 @@ Player* PlayerState::getPlayer() const {
 
 CombatStorytellerModule::CombatStorytellerModule()
     : baseDifficulty(3), spawnCooldown(0), minCooldown(3) {
-    srand(static_cast<unsigned int>(time(nullptr)));
+    // Random stream is seeded once at startup (main); reseeding here would
+    // restart it on every new game
 }
 
 CombatStorytellerModule::~CombatStorytellerModule() {
@@ -95,6 +100,7 @@ CombatStorytellerModule::~CombatStorytellerModule() {
 
 // React to player state changes
 void CombatStorytellerModule::update(Player* player) {
+    PROFILE_SCOPE(ProfilePhase::STORYTELLER_COMBAT);
     if (player == nullptr) return;
 
     // Decrement cooldown each turn
@@ -184,6 +190,7 @@ EventStorytellerModule::~EventStorytellerModule() {
 
 // React to player state
 void EventStorytellerModule::update(Player* player) {
+    PROFILE_SCOPE(ProfilePhase::STORYTELLER_EVENT);
     if (player == nullptr) return;
 
     decrementCooldown();
@@ -252,6 +259,7 @@ EnvironmentStorytellerModule::~EnvironmentStorytellerModule() {
 
 // React to player state
 void EnvironmentStorytellerModule::update(Player* player) {
+    PROFILE_SCOPE(ProfilePhase::STORYTELLER_ENVIRONMENT);
     if (player == nullptr) return;
 
     bool wasInCrisis = crisisMode;
@@ -295,7 +303,8 @@ void EnvironmentStorytellerModule::adjustEnvironment(Player* player) {
 Overseer::Overseer()
     : playerState(nullptr), combatModule(nullptr), eventModule(nullptr),
       envModule(nullptr), turnCounter(0), lastMajorEvent(0), initialized(false),
-      lastEventType(""), pendingEvent(""), hasPendingEvent(false) {
+      lastEventType(""), pendingEvent(""), hasPendingEvent(false),
+      pendingEncounterDifficulty(0), hasPendingEncounter(false), hasPendingAlly(false) {
 }
 
 Overseer::~Overseer() {
@@ -307,6 +316,7 @@ Overseer::~Overseer() {
 
 // Initialize the overseer with player
 void Overseer::initialize(Player* player) {
+    MEM_SCOPE(MemSubsystem::STORYTELLER);
     if (player == nullptr) return;
 
     // Create player state (subject)
@@ -329,6 +339,7 @@ void Overseer::initialize(Player* player) {
 // MAIN EVALUATION FUNCTION
 // Called each turn to evaluate and potentially trigger events
 void Overseer::evaluateAndTrigger() {
+    PROFILE_SCOPE(ProfilePhase::OVERSEER_EVALUATE);
     if (!initialized) return;
 
     // Update turn counter
@@ -358,6 +369,8 @@ void Overseer::evaluateAndTrigger() {
 void Overseer::spawnCombatEncounter(int difficulty) {
     std::cout << "\n*** ALERT: HOSTILE ENTITY DETECTED ***" << std::endl;
     std::cout << "[OVERSEER] Difficulty level: " << difficulty << std::endl;
+    pendingEncounterDifficulty = difficulty;
+    hasPendingEncounter = true;
     lastEventType = "COMBAT";
     lastMajorEvent = turnCounter;
 }
@@ -370,6 +383,7 @@ void Overseer::triggerStoryEvent(const std::string& eventType) {
         std::cout << "You discover a hidden data cache with healing supplies!" << std::endl;
     } else if (eventType == "ALLY") {
         std::cout << "An Awakened entity emerges from the shadows..." << std::endl;
+        hasPendingAlly = true;
     } else if (eventType == "DISCOVERY") {
         std::cout << "You uncover ancient Grid secrets!" << std::endl;
     } else if (eventType == "STORY") {
@@ -412,6 +426,32 @@ std::string Overseer::consumePendingEvent() {
     return event;
 }
 
+// Encounter management
+bool Overseer::checkPendingEncounter() const {
+    return hasPendingEncounter;
+}
+
+int Overseer::consumePendingEncounter() {
+    hasPendingEncounter = false;
+    return pendingEncounterDifficulty;
+}
+
+// Ally management
+bool Overseer::checkPendingAlly() const {
+    return hasPendingAlly;
+}
+
+void Overseer::consumePendingAlly() {
+    hasPendingAlly = false;
+}
+
+// Settings
+void Overseer::setBaseDifficulty(int difficulty) {
+    if (combatModule != nullptr) {
+        combatModule->setBaseDifficulty(difficulty);
+    }
+}
+
 // Getters
 int Overseer::getTurnCounter() const { return turnCounter; }
 std::string Overseer::getLastEventType() const { return lastEventType; }
@@ -431,6 +471,7 @@ void Overseer::displayStatus() const {
  ******************************************************************************/
 
 void initializeOverseer(Player* player) {
+    MEM_SCOPE(MemSubsystem::STORYTELLER);
     if (g_Overseer != nullptr) {
         cleanupOverseer();
     }
@@ -0,0 +1,289 @@
+/*******************************************************************************
+ * Profiler.cpp - Per-Turn Phase Profiler Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/Profiler.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+#if defined(DEXODUS_PROFILE_RDTSC)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace {
+
+int64_t steadyNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Index of the highest set bit (value must be non-zero)
+int highestBit(uint64_t value) {
+    int bit = 0;
+    while (value >>= 1) {
+        bit++;
+    }
+    return bit;
+}
+
+} // namespace
+
+/*******************************************************************************
+ * PHASE HISTOGRAM IMPLEMENTATION
+ ******************************************************************************/
+
+PhaseHistogram::PhaseHistogram() {
+    clear();
+}
+
+void PhaseHistogram::clear() {
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        buckets[i] = 0;
+    }
+    count = 0;
+    totalTicks = 0;
+    minTicks = 0;
+    maxTicks = 0;
+}
+
+// Map a value to its log-linear bucket
+// Step 1: Small values map directly
+// Step 2: Otherwise find the power of two
+// Step 3: Use the next two bits below it as the sub-bucket
+int PhaseHistogram::bucketFor(uint64_t ticks) {
+    // Step 1: Linear range
+    if (ticks < static_cast<uint64_t>(LINEAR_BUCKETS)) {
+        return static_cast<int>(ticks);
+    }
+
+    // Step 2 & 3: Power of two plus sub-bucket
+    int exponent = highestBit(ticks);                       // >= 4
+    int sub = static_cast<int>((ticks >> (exponent - 2)) & (SUB_BUCKETS - 1));
+    int bucket = LINEAR_BUCKETS + (exponent - 4) * SUB_BUCKETS + sub;
+
+    return bucket < BUCKET_COUNT ? bucket : BUCKET_COUNT - 1;
+}
+
+// Largest value that falls into a bucket
+uint64_t PhaseHistogram::bucketUpperBound(int bucket) {
+    if (bucket < LINEAR_BUCKETS) {
+        return static_cast<uint64_t>(bucket);
+    }
+
+    int offset = bucket - LINEAR_BUCKETS;
+    int exponent = offset / SUB_BUCKETS + 4;
+    uint64_t sub = static_cast<uint64_t>(offset % SUB_BUCKETS);
+    uint64_t width = 1ULL << (exponent - 2);
+    uint64_t lower = (static_cast<uint64_t>(SUB_BUCKETS) + sub) * width;
+
+    return lower + width - 1;
+}
+
+void PhaseHistogram::record(uint64_t ticks) {
+    buckets[bucketFor(ticks)]++;
+
+    if (count == 0 || ticks < minTicks) minTicks = ticks;
+    if (ticks > maxTicks) maxTicks = ticks;
+
+    count++;
+    totalTicks += ticks;
+}
+
+// PERCENTILE: Walk buckets until the cumulative count covers the fraction
+uint64_t PhaseHistogram::percentile(double fraction) const {
+    if (count == 0) return 0;
+
+    uint64_t target = static_cast<uint64_t>(fraction * static_cast<double>(count));
+    if (target >= count) target = count - 1;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen > target) {
+            uint64_t bound = bucketUpperBound(i);
+            return bound < maxTicks ? bound : maxTicks;
+        }
+    }
+
+    return maxTicks;
+}
+
+/*******************************************************************************
+ * PROFILER IMPLEMENTATION
+ ******************************************************************************/
+
+Profiler::Profiler()
+    : histograms(nullptr), trace(nullptr), traceHead(0), traceTotal(0),
+      originTicks(0), originNanos(0) {
+    histograms = new PhaseHistogram[static_cast<int>(ProfilePhase::PHASE_COUNT)];
+    trace = new TraceEvent[TRACE_CAPACITY];
+
+    originTicks = now();
+    originNanos = steadyNanos();
+}
+
+Profiler& Profiler::getInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::~Profiler() {
+    delete[] histograms;
+    delete[] trace;
+}
+
+// Read the configured clock
+uint64_t Profiler::now() {
+#if defined(DEXODUS_PROFILE_RDTSC) && (defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__))
+    return static_cast<uint64_t>(__rdtsc());
+#else
+    return static_cast<uint64_t>(steadyNanos());
+#endif
+}
+
+// Conversion factor from ticks to nanoseconds
+// (calibrated against steady_clock over the whole profiling window)
+double Profiler::nanosPerTick() const {
+#if defined(DEXODUS_PROFILE_RDTSC) && (defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__))
+    uint64_t ticks = now() - originTicks;
+    int64_t nanos = steadyNanos() - originNanos;
+    if (ticks == 0 || nanos <= 0) return 1.0;
+    return static_cast<double>(nanos) / static_cast<double>(ticks);
+#else
+    return 1.0;
+#endif
+}
+
+// RECORD: Add one scope to its histogram and the trace ring buffer
+void Profiler::record(ProfilePhase phase, uint64_t startTicks, uint64_t endTicks) {
+    int index = static_cast<int>(phase);
+    if (index < 0 || index >= static_cast<int>(ProfilePhase::PHASE_COUNT)) return;
+
+    uint64_t duration = endTicks > startTicks ? endTicks - startTicks : 0;
+    histograms[index].record(duration);
+
+    TraceEvent& event = trace[traceHead];
+    event.phase = phase;
+    event.startTicks = startTicks;
+    event.durationTicks = duration;
+
+    traceHead = (traceHead + 1) % TRACE_CAPACITY;
+    traceTotal++;
+}
+
+void Profiler::reset() {
+    for (int i = 0; i < static_cast<int>(ProfilePhase::PHASE_COUNT); i++) {
+        histograms[i].clear();
+    }
+    traceHead = 0;
+    traceTotal = 0;
+    originTicks = now();
+    originNanos = steadyNanos();
+}
+
+uint64_t Profiler::getCount(ProfilePhase phase) const {
+    return histograms[static_cast<int>(phase)].count;
+}
+
+uint64_t Profiler::getPercentile(ProfilePhase phase, double fraction) const {
+    uint64_t ticks = histograms[static_cast<int>(phase)].percentile(fraction);
+    return static_cast<uint64_t>(static_cast<double>(ticks) * nanosPerTick());
+}
+
+const char* Profiler::getPhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::GAME_STEP: return "Game::step";
+        case ProfilePhase::GAME_EXPLORE: return "Game::explore";
+        case ProfilePhase::OVERSEER_EVALUATE: return "Overseer::evaluateAndTrigger";
+        case ProfilePhase::PLAYERSTATE_NOTIFY: return "PlayerState::notify";
+        case ProfilePhase::STORYTELLER_COMBAT: return "CombatStorytellerModule::update";
+        case ProfilePhase::STORYTELLER_EVENT: return "EventStorytellerModule::update";
+        case ProfilePhase::STORYTELLER_ENVIRONMENT: return "EnvironmentStorytellerModule::update";
+        case ProfilePhase::COMBAT_PROCESS_TURN: return "CombatSystem::processTurn";
+        case ProfilePhase::HACK_INJECT: return "HackingSystem::injectCode";
+        case ProfilePhase::HACK_BYPASS: return "HackingSystem::bypassFirewall";
+        case ProfilePhase::HACK_DECRYPT: return "HackingSystem::decryptLayer";
+        case ProfilePhase::HACK_UNDO: return "HackingSystem::undoLastAction";
+        case ProfilePhase::SAVE_GAME: return "SaveLoadManager::saveGame";
+        default: return "UNKNOWN";
+    }
+}
+
+// Display per-phase summary (nanoseconds)
+void Profiler::displayReport() const {
+    double scale = nanosPerTick();
+
+    std::cout << "\n=== PROFILER REPORT (ns) ===" << std::endl;
+    std::cout << std::left << std::setw(38) << "Phase"
+              << std::right << std::setw(10) << "Calls"
+              << std::setw(12) << "Mean"
+              << std::setw(12) << "p50"
+              << std::setw(12) << "p99"
+              << std::setw(12) << "Max" << std::endl;
+
+    for (int i = 0; i < static_cast<int>(ProfilePhase::PHASE_COUNT); i++) {
+        const PhaseHistogram& h = histograms[i];
+        if (h.count == 0) continue;
+
+        double mean = static_cast<double>(h.totalTicks) / static_cast<double>(h.count);
+
+        std::cout << std::left << std::setw(38) << getPhaseName(static_cast<ProfilePhase>(i))
+                  << std::right << std::setw(10) << h.count
+                  << std::setw(12) << static_cast<uint64_t>(mean * scale)
+                  << std::setw(12) << static_cast<uint64_t>(h.percentile(0.50) * scale)
+                  << std::setw(12) << static_cast<uint64_t>(h.percentile(0.99) * scale)
+                  << std::setw(12) << static_cast<uint64_t>(h.maxTicks * scale) << std::endl;
+    }
+
+    std::cout << "============================" << std::endl;
+}
+
+// EXPORT CHROME TRACE: Write retained events as complete ("X") events
+// Step 1: Open output file
+// Step 2: Walk the ring buffer from oldest to newest
+// Step 3: Write each event with microsecond timestamps
+bool Profiler::exportChromeTrace(const std::string& path) const {
+    // Step 1: Open file
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cout << "[Profiler] Failed to open trace file: " << path << std::endl;
+        return false;
+    }
+
+    double scale = nanosPerTick();
+    int retained = traceTotal < static_cast<uint64_t>(TRACE_CAPACITY)
+                       ? static_cast<int>(traceTotal) : TRACE_CAPACITY;
+    int start = (traceHead - retained + TRACE_CAPACITY) % TRACE_CAPACITY;
+
+    file << "{\"traceEvents\":[\n";
+    file << std::fixed << std::setprecision(3);
+
+    // Step 2 & 3: Oldest to newest
+    for (int i = 0; i < retained; i++) {
+        const TraceEvent& event = trace[(start + i) % TRACE_CAPACITY];
+        uint64_t offset = event.startTicks > originTicks ? event.startTicks - originTicks : 0;
+        double ts = static_cast<double>(offset) * scale / 1000.0;
+        double dur = static_cast<double>(event.durationTicks) * scale / 1000.0;
+
+        file << "{\"name\":\"" << getPhaseName(event.phase)
+             << "\",\"cat\":\"dexodus\",\"ph\":\"X\",\"ts\":" << ts
+             << ",\"dur\":" << dur << ",\"pid\":1,\"tid\":1}";
+        if (i + 1 < retained) file << ",";
+        file << "\n";
+    }
+
+    file << "],\"displayTimeUnit\":\"ns\"}\n";
+    file.close();
+
+    std::cout << "[Profiler] Chrome trace written: " << path
+              << " (" << retained << " events)" << std::endl;
+    return true;
+}
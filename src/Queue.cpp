@@ -9,6 +9,7 @@
 
 #include "../include/Queue.h"
 #include "../include/Entity.h"
+#include "../include/MemoryTracker.h"
 
 /*******************************************************************************
  * COMBAT QUEUE IMPLEMENTATION
@@ -18,6 +19,7 @@
  ******************************************************************************/
 
 CombatQueue::CombatQueue() : roundNumber(0) {
+    MEM_SCOPE(MemSubsystem::COMBAT);
     turnQueue = new Queue<Entity*>();
 }
 
@@ -30,6 +32,7 @@ CombatQueue::~CombatQueue() {
 // Step 2: Sort by speed (highest first) using simple bubble sort
 // Step 3: Enqueue in sorted order
 void CombatQueue::initializeCombat(Entity** combatants, int count) {
+    MEM_SCOPE(MemSubsystem::COMBAT);
     // Clear any existing queue
     turnQueue->clear();
     roundNumber = 1;
@@ -92,6 +95,7 @@ Entity* CombatQueue::getNextTurn() {
 
 // Add entity to combat (during combat)
 void CombatQueue::addToCombat(Entity* entity) {
+    MEM_SCOPE(MemSubsystem::COMBAT);
     if (entity != nullptr && entity->isAlive()) {
         turnQueue->enqueue(entity);
         std::cout << entity->getName() << " enters combat!" << std::endl;
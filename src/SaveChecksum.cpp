@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * SaveChecksum.cpp - CRC-32C Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/SaveChecksum.h"
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRC32C_X86 1
+#include <nmmintrin.h>
+#elif defined(_M_X64) && defined(_MSC_VER)
+#define CRC32C_X86 1
+#include <intrin.h>
+#include <nmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define CRC32C_ARM 1
+#include <arm_acle.h>
+#endif
+
+static const unsigned int CRC32C_POLY = 0x82F63B78u;   // Reflected Castagnoli
+
+/*******************************************************************************
+ * PORTABLE (slicing-by-8)
+ ******************************************************************************/
+
+// table[0] is the byte-at-a-time table; table[k][b] = CRC of b followed by k zero bytes
+struct Crc32cTables {
+    unsigned int table[8][256];
+
+    Crc32cTables() {
+        for (unsigned int b = 0; b < 256; b++) {
+            unsigned int crc = b;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc >> 1) ^ ((crc & 1) ? CRC32C_POLY : 0);
+            }
+            table[0][b] = crc;
+        }
+        for (unsigned int b = 0; b < 256; b++) {
+            for (int k = 1; k < 8; k++) {
+                unsigned int previous = table[k - 1][b];
+                table[k][b] = (previous >> 8) ^ table[0][previous & 0xFF];
+            }
+        }
+    }
+};
+
+static const Crc32cTables& getTables() {
+    static const Crc32cTables tables;
+    return tables;
+}
+
+// Step 1: Eight bytes per step through the eight tables
+// Step 2: The remaining bytes one at a time
+unsigned int crc32cPortable(unsigned int crc, const void* data, std::size_t size) {
+    const unsigned int (*table)[256] = getTables().table;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+
+    // Step 1
+    while (size >= 8) {
+        unsigned int low = crc ^ (static_cast<unsigned int>(bytes[0]) |
+                                  (static_cast<unsigned int>(bytes[1]) << 8) |
+                                  (static_cast<unsigned int>(bytes[2]) << 16) |
+                                  (static_cast<unsigned int>(bytes[3]) << 24));
+        crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^
+              table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+              table[3][bytes[4]] ^ table[2][bytes[5]] ^
+              table[1][bytes[6]] ^ table[0][bytes[7]];
+        bytes += 8;
+        size -= 8;
+    }
+
+    // Step 2
+    while (size > 0) {
+        crc = (crc >> 8) ^ table[0][(crc ^ *bytes++) & 0xFF];
+        size--;
+    }
+    return ~crc;
+}
+
+/*******************************************************************************
+ * HARDWARE
+ ******************************************************************************/
+
+#if defined(CRC32C_X86)
+
+#if defined(_MSC_VER)
+static bool cpuHasCrc() {
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0;     // ECX bit 20: SSE4.2
+}
+#define CRC32C_TARGET
+#else
+static bool cpuHasCrc() {
+    return __builtin_cpu_supports("sse4.2");
+}
+#define CRC32C_TARGET __attribute__((target("sse4.2")))
+#endif
+
+CRC32C_TARGET
+static unsigned int crc32cHardwareImpl(unsigned int crc, const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    unsigned long long value = ~crc;
+    while (size >= 8) {
+        unsigned long long word;
+        memcpy(&word, bytes, sizeof(word));
+        value = _mm_crc32_u64(value, word);
+        bytes += 8;
+        size -= 8;
+    }
+    unsigned int result = static_cast<unsigned int>(value);
+    while (size > 0) {
+        result = _mm_crc32_u8(result, *bytes++);
+        size--;
+    }
+    return ~result;
+}
+
+#elif defined(CRC32C_ARM)
+
+// Built with the CRC extension, so every CPU this binary runs on has it
+static bool cpuHasCrc() {
+    return true;
+}
+
+static unsigned int crc32cHardwareImpl(unsigned int crc, const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+    while (size >= 8) {
+        unsigned long long word;
+        memcpy(&word, bytes, sizeof(word));
+        crc = __crc32cd(crc, word);
+        bytes += 8;
+        size -= 8;
+    }
+    while (size > 0) {
+        crc = __crc32cb(crc, *bytes++);
+        size--;
+    }
+    return ~crc;
+}
+
+#endif
+
+bool crc32cHardware() {
+#if defined(CRC32C_X86) || defined(CRC32C_ARM)
+    static const bool available = cpuHasCrc();
+    return available;
+#else
+    return false;
+#endif
+}
+
+unsigned int crc32c(unsigned int crc, const void* data, std::size_t size) {
+#if defined(CRC32C_X86) || defined(CRC32C_ARM)
+    if (crc32cHardware()) {
+        return crc32cHardwareImpl(crc, data, size);
+    }
+#endif
+    return crc32cPortable(crc, data, size);
+}
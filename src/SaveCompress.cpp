@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * SaveCompress.cpp - Built-in LZ77 Block Codec Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/SaveCompress.h"
+#include <cstring>
+
+static const int HASH_BITS = 12;
+static const std::size_t MIN_MATCH = 4;
+static const std::size_t LAST_LITERALS = 5;    // Block always ends in literals
+static const std::size_t MATCH_LIMIT = 12;     // No match starts this close to the end
+static const std::size_t MAX_OFFSET = 65535;
+
+// Helper: Unaligned 4-byte load
+static unsigned int read32(const unsigned char* p) {
+    unsigned int value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Helper: Multiplicative hash of a 4-byte prefix
+static unsigned int hash4(unsigned int sequence) {
+    return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+// Helper: Length overflow bytes (after a 15 in the token nibble)
+static unsigned char* writeLength(unsigned char* out, std::size_t length) {
+    while (length >= 255) {
+        *out++ = 255;
+        length -= 255;
+    }
+    *out++ = static_cast<unsigned char>(length);
+    return out;
+}
+
+// Helper: One sequence - literals [anchor, anchor+literals), then the match
+// (matchLength 0 = final literals-only sequence)
+static unsigned char* writeSequence(unsigned char* out, const unsigned char* literals,
+                                    std::size_t literalCount, std::size_t offset,
+                                    std::size_t matchLength) {
+    unsigned char* token = out++;
+    std::size_t matchCode = matchLength > 0 ? matchLength - MIN_MATCH : 0;
+
+    *token = static_cast<unsigned char>((literalCount < 15 ? literalCount : 15) << 4);
+    if (literalCount >= 15) {
+        out = writeLength(out, literalCount - 15);
+    }
+    memcpy(out, literals, literalCount);
+    out += literalCount;
+
+    if (matchLength == 0) return out;
+
+    *out++ = static_cast<unsigned char>(offset & 0xFF);
+    *out++ = static_cast<unsigned char>(offset >> 8);
+    *token |= static_cast<unsigned char>(matchCode < 15 ? matchCode : 15);
+    if (matchCode >= 15) {
+        out = writeLength(out, matchCode - 15);
+    }
+    return out;
+}
+
+std::size_t lzCompressBound(std::size_t size) {
+    return size + size / 255 + 16;
+}
+
+// COMPRESS: Greedy single pass
+// Step 1: Hash the 4 bytes at the cursor, look up the last position with that hash
+// Step 2: No match (or too far back) - advance, faster the longer nothing matches
+// Step 3: Match - extend it, emit pending literals + match, continue after it
+// Step 4: Emit the remaining bytes as literals
+std::size_t lzCompress(const unsigned char* source, std::size_t size, unsigned char* dest) {
+    unsigned char* out = dest;
+    std::size_t anchor = 0;
+
+    if (size > MATCH_LIMIT) {
+        int table[1 << HASH_BITS];
+        for (int i = 0; i < (1 << HASH_BITS); i++) {
+            table[i] = -1;
+        }
+
+        const std::size_t searchEnd = size - MATCH_LIMIT;
+        const std::size_t matchEnd = size - LAST_LITERALS;
+        std::size_t position = 0;
+        unsigned int misses = 0;
+
+        while (position < searchEnd) {
+            // Step 1
+            unsigned int sequence = read32(source + position);
+            unsigned int slot = hash4(sequence);
+            int candidate = table[slot];
+            table[slot] = static_cast<int>(position);
+
+            // Step 2
+            if (candidate < 0 || position - candidate > MAX_OFFSET ||
+                read32(source + candidate) != sequence) {
+                position += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+
+            // Step 3
+            std::size_t length = MIN_MATCH;
+            while (position + length < matchEnd &&
+                   source[candidate + length] == source[position + length]) {
+                length++;
+            }
+            out = writeSequence(out, source + anchor, position - anchor,
+                                position - candidate, length);
+            position += length;
+            anchor = position;
+        }
+    }
+
+    // Step 4
+    out = writeSequence(out, source + anchor, size - anchor, 0, 0);
+    return static_cast<std::size_t>(out - dest);
+}
+
+// Helper: Read length overflow bytes; false if the input ends first
+static bool readLength(const unsigned char* source, std::size_t size, std::size_t& position,
+                       std::size_t& length) {
+    unsigned char value;
+    do {
+        if (position >= size) return false;
+        value = source[position++];
+        length += value;
+    } while (value == 255);
+    return true;
+}
+
+// DECOMPRESS: Copy literals, then copy the match from earlier output
+// (byte by byte, since a match may overlap the bytes it is producing)
+bool lzDecompress(const unsigned char* source, std::size_t size,
+                  unsigned char* dest, std::size_t destSize) {
+    std::size_t in = 0;
+    std::size_t out = 0;
+
+    while (in < size) {
+        unsigned char token = source[in++];
+
+        // Literals
+        std::size_t literals = token >> 4;
+        if (literals == 15 && !readLength(source, size, in, literals)) return false;
+        if (literals > size - in || literals > destSize - out) return false;
+        memcpy(dest + out, source + in, literals);
+        in += literals;
+        out += literals;
+
+        if (in == size) break;      // Final literals-only sequence
+
+        // Match
+        if (size - in < 2) return false;
+        std::size_t offset = source[in] | (static_cast<std::size_t>(source[in + 1]) << 8);
+        in += 2;
+        if (offset == 0 || offset > out) return false;
+
+        std::size_t length = token & 0x0F;
+        if (length == 15 && !readLength(source, size, in, length)) return false;
+        length += MIN_MATCH;
+        if (length > destSize - out) return false;
+
+        const unsigned char* match = dest + out - offset;
+        unsigned char* target = dest + out;
+        for (std::size_t i = 0; i < length; i++) {
+            target[i] = match[i];
+        }
+        out += length;
+    }
+    return out == destSize;
+}
@@ -0,0 +1,970 @@
+/*******************************************************************************
+ * SaveFormat.cpp - Chunked Save Format Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/SaveFormat.h"
+#include "../include/SaveLoad.h"
+#include "../include/SaveCompress.h"
+#include "../include/SaveChecksum.h"
+#include "../include/MemoryTracker.h"
+#include <cstring>
+#include <climits>
+#include <utility>
+
+/*******************************************************************************
+ * SAVE STATE
+ ******************************************************************************/
+
+SaveState::SaveState()
+    : version(0), sections(SECTION_ALL), journalGeneration(0), compressed(false),
+      saveTime(0), level(1),
+      health(0), maxHealth(0), experience(0), attackPower(0), defense(0), speed(0),
+      hackingSkill(0),
+      sectorCount(0), visitedWordCount(0), visitedSectors(nullptr),
+      sectorEnemyCount(0), enemySectors(nullptr), enemyTypes(nullptr),
+      enemyHealth(nullptr), enemyNames(nullptr),
+      inventoryCount(0), inventoryCodes(nullptr), inventoryQuantities(nullptr),
+      abilityCount(0), skillPoints(0), unlockedAbilityCount(0),
+      unlockedWordCount(0), unlockedAbilities(nullptr),
+      unlockedCodeCount(0), unlockedCodes(nullptr),
+      turnCount(0), sectorsExplored(0), enemiesDefeated(0), eventsTriggered(0),
+      hacksCompleted(0),
+      partyCount(0), partyNames(nullptr), partySpecialties(nullptr), partyLoyalty(nullptr),
+      partyHealth(nullptr),
+      eventCount(0), eventCapacity(0), eventTypes(nullptr), eventDescriptions(nullptr),
+      eventTimestamps(nullptr) {
+}
+
+SaveState::~SaveState() {
+    delete[] visitedSectors;
+    delete[] enemySectors;
+    delete[] enemyTypes;
+    delete[] enemyHealth;
+    delete[] enemyNames;
+    delete[] inventoryCodes;
+    delete[] inventoryQuantities;
+    delete[] unlockedAbilities;
+    delete[] unlockedCodes;
+    delete[] partyNames;
+    delete[] partySpecialties;
+    delete[] partyLoyalty;
+    delete[] partyHealth;
+    delete[] eventTypes;
+    delete[] eventDescriptions;
+    delete[] eventTimestamps;
+}
+
+void SaveState::setInventoryCount(int count) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    delete[] inventoryCodes;
+    delete[] inventoryQuantities;
+    inventoryCount = count > 0 ? count : 0;
+    inventoryCodes = inventoryCount > 0 ? new std::string[inventoryCount] : nullptr;
+    inventoryQuantities = inventoryCount > 0 ? new int[inventoryCount]() : nullptr;
+}
+
+void SaveState::setUnlockedWordCount(int count) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    delete[] unlockedAbilities;
+    unlockedWordCount = count > 0 ? count : 0;
+    unlockedAbilities = unlockedWordCount > 0 ? new unsigned long long[unlockedWordCount]() : nullptr;
+}
+
+void SaveState::setUnlockedCodeCount(int count) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    delete[] unlockedCodes;
+    unlockedCodeCount = count > 0 ? count : 0;
+    unlockedCodes = unlockedCodeCount > 0 ? new std::string[unlockedCodeCount] : nullptr;
+}
+
+void SaveState::setVisitedWordCount(int count) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    delete[] visitedSectors;
+    visitedWordCount = count > 0 ? count : 0;
+    visitedSectors = visitedWordCount > 0 ? new unsigned long long[visitedWordCount]() : nullptr;
+}
+
+void SaveState::setSectorEnemyCount(int count) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    delete[] enemySectors;
+    delete[] enemyTypes;
+    delete[] enemyHealth;
+    delete[] enemyNames;
+    sectorEnemyCount = count > 0 ? count : 0;
+    enemySectors = sectorEnemyCount > 0 ? new int[sectorEnemyCount]() : nullptr;
+    enemyTypes = sectorEnemyCount > 0 ? new int[sectorEnemyCount]() : nullptr;
+    enemyHealth = sectorEnemyCount > 0 ? new int[sectorEnemyCount]() : nullptr;
+    enemyNames = sectorEnemyCount > 0 ? new std::string[sectorEnemyCount] : nullptr;
+}
+
+void SaveState::setPartyCount(int count) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    delete[] partyNames;
+    delete[] partySpecialties;
+    delete[] partyLoyalty;
+    delete[] partyHealth;
+    partyCount = count > 0 ? count : 0;
+    partyNames = partyCount > 0 ? new std::string[partyCount] : nullptr;
+    partySpecialties = partyCount > 0 ? new int[partyCount]() : nullptr;
+    partyLoyalty = partyCount > 0 ? new int[partyCount]() : nullptr;
+    partyHealth = partyCount > 0 ? new int[partyCount]() : nullptr;
+}
+
+// Grow by doubling (journal replay appends events record by record)
+int SaveState::appendEvents(int count) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    int first = eventCount;
+    if (count <= 0) return first;
+
+    if (eventCount + count > eventCapacity) {
+        int capacity = eventCapacity > 0 ? eventCapacity : 16;
+        while (capacity < eventCount + count) capacity *= 2;
+
+        std::string* types = new std::string[capacity];
+        std::string* descriptions = new std::string[capacity];
+        std::string* timestamps = new std::string[capacity];
+        for (int i = 0; i < eventCount; i++) {
+            types[i].swap(eventTypes[i]);
+            descriptions[i].swap(eventDescriptions[i]);
+            timestamps[i].swap(eventTimestamps[i]);
+        }
+        delete[] eventTypes;
+        delete[] eventDescriptions;
+        delete[] eventTimestamps;
+        eventTypes = types;
+        eventDescriptions = descriptions;
+        eventTimestamps = timestamps;
+        eventCapacity = capacity;
+    }
+
+    eventCount += count;
+    return first;
+}
+
+/*******************************************************************************
+ * SAVE WRITER
+ ******************************************************************************/
+
+SaveWriter::SaveWriter() : chunkTag(0), inChunk(false) {
+}
+
+// Helper: LEB128 - 7 bits per byte, high bit = more bytes follow
+void SaveWriter::appendVarint(std::string& target, unsigned long long value) {
+    while (value >= 0x80) {
+        target.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    target.push_back(static_cast<char>(value));
+}
+
+void SaveWriter::beginFile(int version) {
+    output.assign(SAVE_MAGIC, sizeof(SAVE_MAGIC));
+    appendVarint(output, static_cast<unsigned long long>(version));
+}
+
+void SaveWriter::beginChunk(unsigned int tag) {
+    if (inChunk) endChunk();
+    chunk.clear();
+    chunkTag = tag;
+    inChunk = true;
+}
+
+// Tag (4 bytes, little-endian), payload length, payload, CRC-32C of all three
+void SaveWriter::endChunk() {
+    if (!inChunk) return;
+    std::size_t start = output.size();
+    for (int i = 0; i < 4; i++) {
+        output.push_back(static_cast<char>((chunkTag >> (8 * i)) & 0xFF));
+    }
+    appendVarint(output, chunk.size());
+    unsigned int crc = crc32c(0, output.data() + start, output.size() - start);
+    crc = crc32c(crc, chunk.data(), chunk.size());
+    output += chunk;
+    for (int i = 0; i < 4; i++) {
+        output.push_back(static_cast<char>((crc >> (8 * i)) & 0xFF));
+    }
+    inChunk = false;
+}
+
+void SaveWriter::writeVarint(unsigned long long value) {
+    appendVarint(chunk, value);
+}
+
+// Zigzag: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...
+void SaveWriter::writeInt(long long value) {
+    unsigned long long zigzag = (static_cast<unsigned long long>(value) << 1) ^
+                                static_cast<unsigned long long>(value >> 63);
+    appendVarint(chunk, zigzag);
+}
+
+void SaveWriter::writeString(const std::string& value) {
+    appendVarint(chunk, value.size());
+    chunk += value;
+}
+
+void SaveWriter::writeBytes(const void* data, std::size_t size) {
+    chunk.append(static_cast<const char*>(data), size);
+}
+
+std::size_t SaveWriter::getSize() {
+    endChunk();
+    return output.size();
+}
+
+const std::string& SaveWriter::getOutput() {
+    endChunk();
+    return output;
+}
+
+void SaveWriter::truncate(std::size_t size) {
+    endChunk();
+    if (size < output.size()) output.resize(size);
+}
+
+const std::string& SaveWriter::finish() {
+    beginChunk(CHUNK_END);
+    endChunk();
+    return output;
+}
+
+/*******************************************************************************
+ * SAVE READER
+ ******************************************************************************/
+
+SaveReader::SaveReader()
+    : data(nullptr), size(0), position(0), failedFlag(false), checksummed(false),
+      checksumFlag(false) {
+}
+
+SaveReader::SaveReader(const unsigned char* data, std::size_t size)
+    : data(data), size(size), position(0), failedFlag(false), checksummed(false),
+      checksumFlag(false) {
+}
+
+unsigned long long SaveReader::readVarint() {
+    unsigned long long value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (position >= size) {
+            failedFlag = true;
+            return 0;
+        }
+        unsigned char byte = data[position++];
+        value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return value;
+    }
+    failedFlag = true;      // More than 10 bytes
+    return 0;
+}
+
+long long SaveReader::readInt() {
+    unsigned long long zigzag = readVarint();
+    return static_cast<long long>(zigzag >> 1) ^ -static_cast<long long>(zigzag & 1);
+}
+
+int SaveReader::readInt32() {
+    long long value = readInt();
+    if (value < INT_MIN || value > INT_MAX) {
+        failedFlag = true;
+        return 0;
+    }
+    return static_cast<int>(value);
+}
+
+std::string SaveReader::readString() {
+    unsigned long long length = readVarint();
+    if (failedFlag || length > size - position) {
+        failedFlag = true;
+        return std::string();
+    }
+    std::string value(reinterpret_cast<const char*>(data + position), static_cast<std::size_t>(length));
+    position += static_cast<std::size_t>(length);
+    return value;
+}
+
+bool SaveReader::readBytes(void* out, std::size_t count) {
+    if (failedFlag || count > size - position) {
+        failedFlag = true;
+        return false;
+    }
+    memcpy(out, data + position, count);
+    position += count;
+    return true;
+}
+
+const unsigned char* SaveReader::peek() const {
+    return data + position;
+}
+
+// CHUNK: Header, payload, then (checksummed) the CRC trailer, checked here
+// while the chunk is still hot in cache - decoding never needs a second pass
+bool SaveReader::nextChunk(unsigned int& tag, SaveReader& payload, bool verify) {
+    std::size_t start = position;
+    unsigned char tagBytes[4];
+    if (!readBytes(tagBytes, sizeof(tagBytes))) return false;
+    tag = saveTag(static_cast<char>(tagBytes[0]), static_cast<char>(tagBytes[1]),
+                  static_cast<char>(tagBytes[2]), static_cast<char>(tagBytes[3]));
+
+    unsigned long long length = readVarint();
+    std::size_t trailer = checksummed ? CHUNK_CHECKSUM_SIZE : 0;
+    if (failedFlag || length > size - position || trailer > size - position - length) {
+        failedFlag = true;
+        return false;
+    }
+    payload = SaveReader(data + position, static_cast<std::size_t>(length));
+    payload.checksummed = checksummed;
+    position += static_cast<std::size_t>(length);
+
+    if (checksummed) {
+        if (verify && !chunkChecksumMatches(data + start, position - start)) {
+            failedFlag = true;
+            checksumFlag = true;
+            return false;
+        }
+        position += CHUNK_CHECKSUM_SIZE;
+    }
+    return true;
+}
+
+bool SaveReader::readSlice(std::size_t count, SaveReader& slice) {
+    if (failedFlag || count > size - position) {
+        failedFlag = true;
+        return false;
+    }
+    slice = SaveReader(data + position, count);
+    slice.checksummed = checksummed;
+    position += count;
+    return true;
+}
+
+void SaveReader::setChecksummed(bool enabled) { checksummed = enabled; }
+bool SaveReader::isChecksummed() const { return checksummed; }
+bool SaveReader::checksumFailed() const { return checksumFlag; }
+bool SaveReader::failed() const { return failedFlag; }
+bool SaveReader::atEnd() const { return position >= size; }
+std::size_t SaveReader::getPosition() const { return position; }
+std::size_t SaveReader::remaining() const { return size - position; }
+
+/*******************************************************************************
+ * ENCODE
+ ******************************************************************************/
+
+// Helper: One sector's enemies (state lists them grouped by sector)
+static void writeSectorEnemies(SaveWriter& writer, const SaveState& state, int first, int last) {
+    for (int i = first; i < last; i++) {
+        writer.writeVarint(static_cast<unsigned long long>(state.enemyTypes[i]));
+        writer.writeInt(state.enemyHealth[i]);
+        writer.writeString(state.enemyNames[i]);
+    }
+}
+
+// SECTION: One chunk per tag
+void encodeSection(SaveWriter& writer, unsigned int tag, const SaveState& state) {
+    writer.beginChunk(tag);
+    if (tag == CHUNK_INFO) {
+        writer.writeString(state.playerName);
+        writer.writeInt(state.level);
+        writer.writeInt(state.saveTime);
+        writer.writeInt(state.turnCount);
+    } else if (tag == CHUNK_JOURNAL) {
+        writer.writeVarint(state.journalGeneration);
+    } else if (tag == CHUNK_PLAYER) {
+        writer.writeInt(state.health);
+        writer.writeInt(state.maxHealth);
+        writer.writeInt(state.experience);
+        writer.writeInt(state.attackPower);
+        writer.writeInt(state.defense);
+        writer.writeInt(state.speed);
+        writer.writeInt(state.hackingSkill);
+    } else if (tag == CHUNK_WORLD) {
+        writer.writeString(state.currentSector);
+    } else if (tag == CHUNK_SECTORS) {
+        writer.writeVarint(static_cast<unsigned long long>(state.sectorCount));
+        writer.writeVarint(static_cast<unsigned long long>(state.visitedWordCount));
+        for (int i = 0; i < state.visitedWordCount; i++) {
+            writer.writeVarint(state.visitedSectors[i]);
+        }
+        writer.writeVarint(static_cast<unsigned long long>(state.sectorEnemyCount));
+        for (int i = 0; i < state.sectorEnemyCount; i++) {
+            writer.writeVarint(static_cast<unsigned long long>(state.enemySectors[i]));
+            writeSectorEnemies(writer, state, i, i + 1);
+        }
+    } else if (tag == CHUNK_INVENTORY) {
+        writer.writeVarint(static_cast<unsigned long long>(state.inventoryCount));
+        for (int i = 0; i < state.inventoryCount; i++) {
+            writer.writeString(state.inventoryCodes[i]);
+            writer.writeInt(state.inventoryQuantities[i]);
+        }
+    } else if (tag == CHUNK_ABILITIES) {
+        writer.writeVarint(static_cast<unsigned long long>(state.abilityCount));
+        writer.writeInt(state.skillPoints);
+        writer.writeVarint(static_cast<unsigned long long>(state.unlockedAbilityCount));
+        writer.writeVarint(static_cast<unsigned long long>(state.unlockedWordCount));
+        for (int i = 0; i < state.unlockedWordCount; i++) {
+            writer.writeVarint(state.unlockedAbilities[i]);
+        }
+    } else if (tag == CHUNK_STATS) {
+        writer.writeInt(state.turnCount);
+        writer.writeInt(state.sectorsExplored);
+        writer.writeInt(state.enemiesDefeated);
+        writer.writeInt(state.eventsTriggered);
+        writer.writeInt(state.hacksCompleted);
+    } else if (tag == CHUNK_PARTY) {
+        writer.writeVarint(static_cast<unsigned long long>(state.partyCount));
+        for (int i = 0; i < state.partyCount; i++) {
+            writer.writeString(state.partyNames[i]);
+            writer.writeVarint(static_cast<unsigned long long>(state.partySpecialties[i]));
+            writer.writeInt(state.partyLoyalty[i]);
+            writer.writeInt(state.partyHealth[i]);
+        }
+    } else if (tag == CHUNK_EVENTS) {
+        writer.writeVarint(static_cast<unsigned long long>(state.eventCount));
+        for (int i = 0; i < state.eventCount; i++) {
+            writer.writeString(state.eventTypes[i]);
+            writer.writeString(state.eventTimestamps[i]);
+            writer.writeString(state.eventDescriptions[i]);
+        }
+    }
+    writer.endChunk();
+}
+
+// SECTOR DELTA: index, visited flag and full enemy list of each changed sector
+void encodeSectorDelta(SaveWriter& writer, const SaveState& state, const bool* changed) {
+    int count = 0;
+    for (int i = 0; i < state.sectorCount; i++) {
+        if (changed[i]) count++;
+    }
+
+    writer.beginChunk(CHUNK_SECTOR_DELTA);
+    writer.writeVarint(static_cast<unsigned long long>(count));
+    int enemy = 0;
+    for (int i = 0; i < state.sectorCount; i++) {
+        int first = enemy;
+        while (enemy < state.sectorEnemyCount && state.enemySectors[enemy] == i) enemy++;
+        if (!changed[i]) continue;
+
+        bool visited = (state.visitedSectors[i / 64] & (1ULL << (i % 64))) != 0;
+        writer.writeVarint(static_cast<unsigned long long>(i));
+        writer.writeVarint(visited ? 1 : 0);
+        writer.writeVarint(static_cast<unsigned long long>(enemy - first));
+        writeSectorEnemies(writer, state, first, enemy);
+    }
+    writer.endChunk();
+}
+
+// Helper: One ZBLK chunk (stored raw if compression does not shrink it)
+static void writeBlock(SaveWriter& writer, const char* data, std::size_t size,
+                       std::string& scratch) {
+    scratch.resize(lzCompressBound(size));
+    unsigned char* packed = reinterpret_cast<unsigned char*>(&scratch[0]);
+    std::size_t packedSize = lzCompress(reinterpret_cast<const unsigned char*>(data), size, packed);
+
+    writer.beginChunk(CHUNK_BLOCK);
+    if (packedSize < size) {
+        writer.writeVarint(static_cast<unsigned long long>(size) << 1);
+        writer.writeBytes(packed, packedSize);
+    } else {
+        writer.writeVarint((static_cast<unsigned long long>(size) << 1) | 1);
+        writer.writeBytes(data, size);
+    }
+    writer.endChunk();
+}
+
+// ENCODE: INFO first, then the sections, then END
+// Compressed: each body section is encoded on its own and fed into the
+// block buffer, which is flushed as a ZBLK chunk whenever it fills up
+void encodeSave(const SaveState& state, std::string& out) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    static const unsigned int order[] = {
+        CHUNK_INFO, CHUNK_JOURNAL, CHUNK_PLAYER, CHUNK_WORLD, CHUNK_SECTORS,
+        CHUNK_INVENTORY, CHUNK_ABILITIES, CHUNK_STATS, CHUNK_PARTY, CHUNK_EVENTS
+    };
+
+    SaveWriter writer;
+    writer.beginFile(SAVE_VERSION);
+    std::string block;          // Inner chunk stream not yet compressed
+    std::string scratch;
+    for (unsigned int tag : order) {
+        if (tag == CHUNK_JOURNAL && state.journalGeneration == 0) continue;
+        if (!state.compressed || tag == CHUNK_INFO || tag == CHUNK_JOURNAL) {
+            encodeSection(writer, tag, state);
+            continue;
+        }
+
+        SaveWriter section;
+        encodeSection(section, tag, state);
+        block += section.getOutput();
+
+        std::size_t flushed = 0;
+        while (block.size() - flushed >= SAVE_BLOCK_SIZE) {
+            writeBlock(writer, block.data() + flushed, SAVE_BLOCK_SIZE, scratch);
+            flushed += SAVE_BLOCK_SIZE;
+        }
+        block.erase(0, flushed);
+    }
+    if (!block.empty()) {
+        writeBlock(writer, block.data(), block.size(), scratch);
+    }
+    out = writer.finish();
+}
+
+/*******************************************************************************
+ * DECODE
+ ******************************************************************************/
+
+// Helper: Fields versions 1 and 2 share (same names in both structs)
+template <typename Legacy>
+static void decodeLegacyCommon(Legacy& legacy, SaveState& state) {
+    legacy.playerName[31] = '\0';
+    legacy.currentSector[63] = '\0';
+
+    state.version = legacy.version;
+    state.playerName = legacy.playerName;
+    state.saveTime = static_cast<long long>(legacy.saveTime);
+    state.level = legacy.level;
+    state.health = legacy.health;
+    state.maxHealth = legacy.maxHealth;
+    state.experience = legacy.experience;
+    state.attackPower = legacy.attackPower;
+    state.defense = legacy.defense;
+    state.speed = legacy.speed;
+    state.hackingSkill = legacy.hackingSkill;
+    state.skillPoints = legacy.skillPoints;
+    state.currentSector = legacy.currentSector;
+
+    int items = legacy.inventoryCount;
+    if (items < 0 || items > 50) items = 0;
+    state.setInventoryCount(items);
+    for (int i = 0; i < items; i++) {
+        legacy.inventoryCodes[i][31] = '\0';
+        state.inventoryCodes[i] = legacy.inventoryCodes[i];
+        state.inventoryQuantities[i] = legacy.inventoryQuantities[i];
+    }
+
+    state.turnCount = legacy.turnCount;
+    state.sectorsExplored = legacy.sectorsVisited;
+    state.enemiesDefeated = legacy.enemiesDefeated;
+    state.eventsTriggered = legacy.eventsTriggered;
+}
+
+// Helper: Version 1 files are one raw SaveDataV1 struct (unlocks by code,
+// resolved against the tree when the state is applied)
+static bool decodeLegacyV1(const unsigned char* data, std::size_t size, SaveState& state) {
+    if (size < sizeof(SaveDataV1)) return false;
+
+    SaveDataV1 legacy;
+    memcpy(&legacy, data, sizeof(SaveDataV1));
+    decodeLegacyCommon(legacy, state);
+
+    int unlocked = legacy.unlockedAbilityCount;
+    if (unlocked < 0 || unlocked > 20) unlocked = 0;
+    state.setUnlockedCodeCount(unlocked);
+    for (int i = 0; i < unlocked; i++) {
+        legacy.unlockedAbilities[i][31] = '\0';
+        state.unlockedCodes[i] = legacy.unlockedAbilities[i];
+    }
+    state.unlockedAbilityCount = unlocked;
+    return true;
+}
+
+// Helper: Version 1 and 2 files are one raw struct ("DEXODUS" + version)
+static bool decodeLegacy(const unsigned char* data, std::size_t size, SaveState& state) {
+    const std::size_t versionOffset = offsetof(SaveData, version);
+    if (size < versionOffset + sizeof(int) || strncmp(reinterpret_cast<const char*>(data),
+                                                      "DEXODUS", 7) != 0) {
+        return false;
+    }
+    int version = 0;
+    memcpy(&version, data + versionOffset, sizeof(int));
+    if (version == ORIGINAL_SAVE_VERSION) {
+        return decodeLegacyV1(data, size, state);
+    }
+    if (version != LEGACY_SAVE_VERSION || size < sizeof(SaveData)) return false;
+
+    SaveData legacy;
+    memcpy(&legacy, data, sizeof(SaveData));
+    decodeLegacyCommon(legacy, state);
+
+    state.abilityCount = legacy.abilityCount;
+    state.unlockedAbilityCount = legacy.unlockedAbilityCount;
+    state.setUnlockedWordCount(SAVE_ABILITY_WORDS);
+    memcpy(state.unlockedAbilities, legacy.unlockedAbilities,
+           sizeof(unsigned long long) * SAVE_ABILITY_WORDS);
+    return true;
+}
+
+// Helper: SCTD - replace the listed sectors' visited flag and enemies
+// Step 1: Read the changed sectors (ascending) and their enemies into scratch arrays
+// Step 2: Merge with the kept sectors' enemies in one pass, in sector order
+static bool decodeSectorDelta(SaveReader& in, SaveState& state) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    unsigned long long count = in.readVarint();
+    if (in.failed() || count > static_cast<unsigned long long>(state.sectorCount)) return false;
+    if (count == 0) return true;
+
+    // Step 1
+    bool* changed = new bool[state.sectorCount]();
+    int* newSectors = nullptr;
+    int* newTypes = nullptr;
+    int* newHealth = nullptr;
+    std::string* newNames = nullptr;
+    int newCount = 0;
+    int newCapacity = 0;
+    long long lastSector = -1;
+
+    bool ok = true;
+    for (unsigned long long c = 0; c < count && ok; c++) {
+        unsigned long long index = in.readVarint();
+        unsigned long long visited = in.readVarint();
+        unsigned long long enemies = in.readVarint();
+        if (in.failed() || index >= static_cast<unsigned long long>(state.sectorCount) ||
+            static_cast<long long>(index) <= lastSector || enemies > in.remaining() / 3) {
+            ok = false;
+            break;
+        }
+
+        int sector = static_cast<int>(index);
+        changed[sector] = true;
+        lastSector = sector;
+        unsigned long long bit = 1ULL << (sector % 64);
+        if (sector / 64 < state.visitedWordCount) {
+            if (visited != 0) state.visitedSectors[sector / 64] |= bit;
+            else state.visitedSectors[sector / 64] &= ~bit;
+        }
+
+        if (newCount + static_cast<int>(enemies) > newCapacity) {
+            int capacity = newCapacity > 0 ? newCapacity : 8;
+            while (capacity < newCount + static_cast<int>(enemies)) capacity *= 2;
+            int* sectors = new int[capacity];
+            int* types = new int[capacity];
+            int* health = new int[capacity];
+            std::string* names = new std::string[capacity];
+            for (int i = 0; i < newCount; i++) {
+                sectors[i] = newSectors[i];
+                types[i] = newTypes[i];
+                health[i] = newHealth[i];
+                names[i].swap(newNames[i]);
+            }
+            delete[] newSectors;
+            delete[] newTypes;
+            delete[] newHealth;
+            delete[] newNames;
+            newSectors = sectors;
+            newTypes = types;
+            newHealth = health;
+            newNames = names;
+            newCapacity = capacity;
+        }
+        for (unsigned long long e = 0; e < enemies && !in.failed(); e++) {
+            newSectors[newCount] = sector;
+            newTypes[newCount] = static_cast<int>(in.readVarint() & INT_MAX);
+            newHealth[newCount] = in.readInt32();
+            newNames[newCount] = in.readString();
+            newCount++;
+        }
+        ok = !in.failed();
+    }
+
+    // Step 2
+    if (ok) {
+        int kept = 0;
+        for (int i = 0; i < state.sectorEnemyCount; i++) {
+            int sector = state.enemySectors[i];
+            if (sector < state.sectorCount && !changed[sector]) kept++;
+        }
+
+        SaveState merged;
+        merged.setSectorEnemyCount(kept + newCount);
+        int out = 0;
+        int oldIndex = 0;
+        int newIndex = 0;
+        for (int sector = 0; sector < state.sectorCount; sector++) {
+            while (oldIndex < state.sectorEnemyCount && state.enemySectors[oldIndex] == sector) {
+                if (!changed[sector]) {
+                    merged.enemySectors[out] = sector;
+                    merged.enemyTypes[out] = state.enemyTypes[oldIndex];
+                    merged.enemyHealth[out] = state.enemyHealth[oldIndex];
+                    merged.enemyNames[out].swap(state.enemyNames[oldIndex]);
+                    out++;
+                }
+                oldIndex++;
+            }
+            while (newIndex < newCount && newSectors[newIndex] == sector) {
+                merged.enemySectors[out] = sector;
+                merged.enemyTypes[out] = newTypes[newIndex];
+                merged.enemyHealth[out] = newHealth[newIndex];
+                merged.enemyNames[out].swap(newNames[newIndex]);
+                out++;
+                newIndex++;
+            }
+        }
+
+        // Take merged's arrays (swap so merged frees the old ones)
+        std::swap(state.sectorEnemyCount, merged.sectorEnemyCount);
+        std::swap(state.enemySectors, merged.enemySectors);
+        std::swap(state.enemyTypes, merged.enemyTypes);
+        std::swap(state.enemyHealth, merged.enemyHealth);
+        std::swap(state.enemyNames, merged.enemyNames);
+        state.sectorEnemyCount = out;
+    }
+
+    delete[] changed;
+    delete[] newSectors;
+    delete[] newTypes;
+    delete[] newHealth;
+    delete[] newNames;
+    return ok;
+}
+
+// Section bit of a body chunk (0 = INFO, JGEN and framing, always decoded)
+unsigned int chunkSection(unsigned int tag) {
+    if (tag == CHUNK_PLAYER) return SECTION_PLAYER;
+    if (tag == CHUNK_WORLD) return SECTION_WORLD;
+    if (tag == CHUNK_SECTORS || tag == CHUNK_SECTOR_DELTA) return SECTION_SECTORS;
+    if (tag == CHUNK_INVENTORY) return SECTION_INVENTORY;
+    if (tag == CHUNK_ABILITIES) return SECTION_ABILITIES;
+    if (tag == CHUNK_STATS) return SECTION_STATS;
+    if (tag == CHUNK_PARTY) return SECTION_PARTY;
+    if (tag == CHUNK_EVENTS) return SECTION_EVENTS;
+    return 0;
+}
+
+// Fill state from one known chunk (unknown tags and unwanted sections are skipped)
+bool decodeSection(SaveReader& in, unsigned int tag, SaveState& state) {
+    unsigned int section = chunkSection(tag);
+    if (section != 0 && (state.sections & section) == 0) return true;
+
+    if (tag == CHUNK_INFO) {
+        state.playerName = in.readString();
+        state.level = in.readInt32();
+        state.saveTime = in.readInt();
+        state.turnCount = in.readInt32();
+    } else if (tag == CHUNK_PLAYER) {
+        state.health = in.readInt32();
+        state.maxHealth = in.readInt32();
+        state.experience = in.readInt32();
+        state.attackPower = in.readInt32();
+        state.defense = in.readInt32();
+        state.speed = in.readInt32();
+        state.hackingSkill = in.readInt32();
+    } else if (tag == CHUNK_WORLD) {
+        state.currentSector = in.readString();
+    } else if (tag == CHUNK_SECTORS) {
+        // Enemies take at least four bytes each (sector, type, health, name)
+        unsigned long long sectors = in.readVarint();
+        unsigned long long words = in.readVarint();
+        if (in.failed() || sectors > INT_MAX || words > in.remaining()) return false;
+        state.sectorCount = static_cast<int>(sectors);
+        state.setVisitedWordCount(static_cast<int>(words));
+        for (int i = 0; i < state.visitedWordCount && !in.failed(); i++) {
+            state.visitedSectors[i] = in.readVarint();
+        }
+        unsigned long long enemies = in.readVarint();
+        if (in.failed() || enemies > in.remaining() / 4) return false;
+        state.setSectorEnemyCount(static_cast<int>(enemies));
+        for (int i = 0; i < state.sectorEnemyCount && !in.failed(); i++) {
+            state.enemySectors[i] = static_cast<int>(in.readVarint() & INT_MAX);
+            state.enemyTypes[i] = static_cast<int>(in.readVarint() & INT_MAX);
+            state.enemyHealth[i] = in.readInt32();
+            state.enemyNames[i] = in.readString();
+        }
+    } else if (tag == CHUNK_INVENTORY) {
+        // Each item takes at least two bytes; reject counts the chunk can't hold
+        unsigned long long count = in.readVarint();
+        if (in.failed() || count > in.remaining() / 2) return false;
+        state.setInventoryCount(static_cast<int>(count));
+        for (int i = 0; i < state.inventoryCount && !in.failed(); i++) {
+            state.inventoryCodes[i] = in.readString();
+            state.inventoryQuantities[i] = in.readInt32();
+        }
+    } else if (tag == CHUNK_ABILITIES) {
+        state.abilityCount = static_cast<int>(in.readVarint() & INT_MAX);
+        state.skillPoints = in.readInt32();
+        state.unlockedAbilityCount = static_cast<int>(in.readVarint() & INT_MAX);
+        unsigned long long words = in.readVarint();
+        if (in.failed() || words > in.remaining()) return false;
+        state.setUnlockedWordCount(static_cast<int>(words));
+        for (int i = 0; i < state.unlockedWordCount && !in.failed(); i++) {
+            state.unlockedAbilities[i] = in.readVarint();
+        }
+    } else if (tag == CHUNK_SECTOR_DELTA) {
+        return decodeSectorDelta(in, state);
+    } else if (tag == CHUNK_JOURNAL) {
+        state.journalGeneration = in.readVarint();
+    } else if (tag == CHUNK_EVENTS) {
+        // Each event takes at least three bytes (three string lengths)
+        unsigned long long count = in.readVarint();
+        if (in.failed() || count > in.remaining() / 3) return false;
+        int first = state.appendEvents(static_cast<int>(count));
+        for (int i = first; i < state.eventCount && !in.failed(); i++) {
+            state.eventTypes[i] = in.readString();
+            state.eventTimestamps[i] = in.readString();
+            state.eventDescriptions[i] = in.readString();
+        }
+    } else if (tag == CHUNK_STATS) {
+        state.turnCount = in.readInt32();
+        state.sectorsExplored = in.readInt32();
+        state.enemiesDefeated = in.readInt32();
+        state.eventsTriggered = in.readInt32();
+        if (!in.atEnd()) {
+            state.hacksCompleted = in.readInt32();
+        }
+    } else if (tag == CHUNK_PARTY) {
+        // Each ally takes at least four bytes (name length, specialty, loyalty, health)
+        unsigned long long count = in.readVarint();
+        if (in.failed() || count > in.remaining() / 4) return false;
+        state.setPartyCount(static_cast<int>(count));
+        for (int i = 0; i < state.partyCount && !in.failed(); i++) {
+            state.partyNames[i] = in.readString();
+            state.partySpecialties[i] = static_cast<int>(in.readVarint() & INT_MAX);
+            state.partyLoyalty[i] = in.readInt32();
+            state.partyHealth[i] = in.readInt32();
+        }
+    }
+    return !in.failed();
+}
+
+// DECODE: Detect the version, then walk the chunks
+// Step 1: Legacy struct dump ("DEXODUS" signature)
+// Step 2: Magic + version
+// Step 3: Chunks until END (unknown tags skipped by length)
+bool decodeSave(const unsigned char* data, std::size_t size, SaveState& state, bool infoOnly) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    if (data == nullptr) return false;
+
+    // Step 1
+    if (size >= 7 && memcmp(data, "DEXODUS", 7) == 0) {
+        return decodeLegacy(data, size, state);
+    }
+
+    // Step 2
+    if (size < sizeof(SAVE_MAGIC) || memcmp(data, SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0) {
+        return false;
+    }
+    SaveReader reader(data + sizeof(SAVE_MAGIC), size - sizeof(SAVE_MAGIC));
+    unsigned long long version = reader.readVarint();
+    if (reader.failed() || version <= static_cast<unsigned long long>(LEGACY_SAVE_VERSION) ||
+        version > static_cast<unsigned long long>(SAVE_VERSION)) {
+        return false;
+    }
+    state.version = static_cast<int>(version);
+    reader.setChecksummed(state.version >= FIRST_CHECKSUM_VERSION);
+
+    // Step 3
+    return decodeChunks(reader, state, infoOnly);
+}
+
+// Helper: ZBLK - decompress onto the carried-over bytes, decode the
+// chunks that are now complete, keep the unfinished tail for the next block
+static bool decodeBlock(SaveReader& in, std::string& pending, SaveState& state) {
+    unsigned long long header = in.readVarint();
+    std::size_t rawSize = static_cast<std::size_t>(header >> 1);
+    if (in.failed() || rawSize > SAVE_BLOCK_SIZE) return false;
+
+    std::size_t start = pending.size();
+    pending.resize(start + rawSize);
+    unsigned char* target = reinterpret_cast<unsigned char*>(&pending[0]) + start;
+    if (header & 1) {
+        if (!in.readBytes(target, rawSize) || !in.atEnd()) return false;
+    } else if (!lzDecompress(in.peek(), in.remaining(), target, rawSize)) {
+        return false;
+    }
+
+    SaveReader inner(reinterpret_cast<const unsigned char*>(pending.data()), pending.size());
+    inner.setChecksummed(in.isChecksummed());
+    std::size_t consumed = 0;
+    unsigned int tag = 0;
+    SaveReader payload;
+    while (!inner.atEnd()) {
+        SaveReader probe = inner;
+        if (!probe.nextChunk(tag, payload)) {
+            if (probe.checksumFailed()) return false;
+            break;      // Rest arrives in the next block
+        }
+        if (tag == CHUNK_END || tag == CHUNK_BLOCK) return false;
+        if (!decodeSection(payload, tag, state)) return false;
+        inner = probe;
+        consumed = inner.getPosition();
+    }
+    pending.erase(0, consumed);
+    return true;
+}
+
+// CHUNKS: Decode until END (false if malformed or truncated)
+bool decodeChunks(SaveReader& reader, SaveState& state, bool infoOnly) {
+    unsigned int tag = 0;
+    SaveReader payload;
+    std::string pending;        // Decompressed bytes of an unfinished inner chunk
+    while (reader.nextChunk(tag, payload)) {
+        if (tag == CHUNK_END) return pending.empty();
+        if (tag == CHUNK_BLOCK) {
+            state.compressed = true;
+            if (!decodeBlock(payload, pending, state)) return false;
+            continue;
+        }
+        if (!decodeSection(payload, tag, state)) return false;
+        if (infoOnly && tag == CHUNK_INFO) return true;
+    }
+    return false;   // Truncated: no END chunk
+}
+
+/*******************************************************************************
+ * INTEGRITY
+ ******************************************************************************/
+
+// chunk = tag + length + payload, followed by its 4-byte little-endian CRC
+bool chunkChecksumMatches(const unsigned char* chunk, std::size_t size) {
+    const unsigned char* trailer = chunk + size;
+    unsigned int stored = static_cast<unsigned int>(trailer[0]) |
+                          (static_cast<unsigned int>(trailer[1]) << 8) |
+                          (static_cast<unsigned int>(trailer[2]) << 16) |
+                          (static_cast<unsigned int>(trailer[3]) << 24);
+    return crc32c(0, chunk, size) == stored;
+}
+
+// VERIFY: Walk the top-level chunks, checking each CRC (ZBLK payloads are
+// checked as compressed bytes, so nothing is decompressed or decoded)
+SaveIntegrity verifySave(const unsigned char* data, std::size_t size) {
+    if (data == nullptr) return SaveIntegrity::INVALID;
+    if (size >= 7 && memcmp(data, "DEXODUS", 7) == 0) {
+        SaveState legacy;
+        return decodeLegacy(data, size, legacy) ? SaveIntegrity::UNCHECKED
+                                                : SaveIntegrity::INVALID;
+    }
+    if (size < sizeof(SAVE_MAGIC) || memcmp(data, SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0) {
+        return SaveIntegrity::INVALID;
+    }
+
+    SaveReader reader(data + sizeof(SAVE_MAGIC), size - sizeof(SAVE_MAGIC));
+    unsigned long long version = reader.readVarint();
+    if (reader.failed() || version <= static_cast<unsigned long long>(LEGACY_SAVE_VERSION) ||
+        version > static_cast<unsigned long long>(SAVE_VERSION)) {
+        return SaveIntegrity::INVALID;
+    }
+    bool checksummed = version >= static_cast<unsigned long long>(FIRST_CHECKSUM_VERSION);
+    reader.setChecksummed(checksummed);
+
+    unsigned int tag = 0;
+    SaveReader payload;
+    while (reader.nextChunk(tag, payload)) {
+        if (tag == CHUNK_END) {
+            return checksummed ? SaveIntegrity::VALID : SaveIntegrity::UNCHECKED;
+        }
+    }
+    return reader.checksumFailed() ? SaveIntegrity::CORRUPT : SaveIntegrity::TRUNCATED;
+}
+
+/*******************************************************************************
+ * FINGERPRINT
+ ******************************************************************************/
+
+unsigned long long fingerprintBytes(unsigned long long hash, const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
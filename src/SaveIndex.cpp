@@ -0,0 +1,402 @@
+/*******************************************************************************
+ * SaveIndex.cpp - Save Directory Index Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/SaveIndex.h"
+#include "../include/SaveFormat.h"
+#include "../include/AutoSave.h"
+#include "../include/SaveView.h"
+#include "../include/SaveChecksum.h"
+#include "../include/MemoryTracker.h"
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+static const char INDEX_MAGIC[4] = {'D', 'I', 'D', 'X'};
+static const char* INDEX_FILE = "saves.idx";
+static const unsigned int CHUNK_INDEX = saveTag('S', 'I', 'D', 'X');
+
+/*******************************************************************************
+ * DIRECTORY SCAN
+ ******************************************************************************/
+
+// One "<slot>.dat" found in the directory
+struct SaveFileStat {
+    std::string slot;
+    long long size;
+    long long modified;
+};
+
+// Helper: Append to a growing array (doubling)
+static void appendFile(SaveFileStat*& files, int& count, int& capacity,
+                       const std::string& slot, long long size, long long modified) {
+    if (count == capacity) {
+        capacity = capacity > 0 ? capacity * 2 : 16;
+        SaveFileStat* grown = new SaveFileStat[capacity];
+        for (int i = 0; i < count; i++) {
+            grown[i].slot.swap(files[i].slot);
+            grown[i].size = files[i].size;
+            grown[i].modified = files[i].modified;
+        }
+        delete[] files;
+        files = grown;
+    }
+    files[count].slot = slot;
+    files[count].size = size;
+    files[count].modified = modified;
+    count++;
+}
+
+// Helper: Slot name if fileName ends in ".dat" (temp files end in ".tmp")
+static bool slotFromFileName(const char* fileName, std::string& slot) {
+    std::size_t length = strlen(fileName);
+    if (length <= 4 || strcmp(fileName + length - 4, ".dat") != 0) return false;
+    slot.assign(fileName, length - 4);
+    return true;
+}
+
+#ifdef _WIN32
+
+// Windows: FindFirstFile returns size and write time with each name
+static SaveFileStat* scanSaveFiles(const std::string& directory, int& count) {
+    SaveFileStat* files = nullptr;
+    int capacity = 0;
+    count = 0;
+
+    WIN32_FIND_DATAA found;
+    HANDLE search = FindFirstFileA((directory + "\\*.dat").c_str(), &found);
+    if (search == INVALID_HANDLE_VALUE) return files;
+    do {
+        std::string slot;
+        if ((found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ||
+            !slotFromFileName(found.cFileName, slot)) {
+            continue;
+        }
+        long long size = (static_cast<long long>(found.nFileSizeHigh) << 32) | found.nFileSizeLow;
+        long long modified = (static_cast<long long>(found.ftLastWriteTime.dwHighDateTime) << 32) |
+                             found.ftLastWriteTime.dwLowDateTime;
+        appendFile(files, count, capacity, slot, size, modified);
+    } while (FindNextFileA(search, &found));
+    FindClose(search);
+    return files;
+}
+
+#else
+
+// POSIX: readdir for the names, stat for size and mtime (nanoseconds)
+static SaveFileStat* scanSaveFiles(const std::string& directory, int& count) {
+    SaveFileStat* files = nullptr;
+    int capacity = 0;
+    count = 0;
+
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr) return files;
+
+    struct dirent* item;
+    while ((item = readdir(dir)) != nullptr) {
+        std::string slot;
+        if (!slotFromFileName(item->d_name, slot)) continue;
+
+        struct stat st;
+        if (stat((directory + "/" + item->d_name).c_str(), &st) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+#ifdef __APPLE__
+        long long modified = static_cast<long long>(st.st_mtimespec.tv_sec) * 1000000000LL +
+                             st.st_mtimespec.tv_nsec;
+#else
+        long long modified = static_cast<long long>(st.st_mtim.tv_sec) * 1000000000LL +
+                             st.st_mtim.tv_nsec;
+#endif
+        appendFile(files, count, capacity, slot, static_cast<long long>(st.st_size), modified);
+    }
+    closedir(dir);
+    return files;
+}
+
+#endif
+
+/*******************************************************************************
+ * SAVE INDEX ENTRY
+ ******************************************************************************/
+
+SaveIndexEntry::SaveIndexEntry()
+    : level(0), saveTime(0), fileSize(0), modifiedTime(0), checksum(0),
+      integrity(SaveIntegrity::INVALID) {
+}
+
+/*******************************************************************************
+ * SAVE INDEX
+ ******************************************************************************/
+
+// Constructor
+SaveIndex::SaveIndex() : entries(nullptr), entryCount(0), capacity(0), dirty(false) {
+}
+
+// Destructor
+SaveIndex::~SaveIndex() {
+    delete[] entries;
+}
+
+// Helper: Binary search by slot name
+int SaveIndex::lowerBound(const std::string& slot) const {
+    int low = 0;
+    int high = entryCount;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (entries[middle].slot < slot) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// Helper: Entry for slot, inserted in order if missing
+SaveIndexEntry& SaveIndex::findOrInsert(const std::string& slot) {
+    int position = lowerBound(slot);
+    if (position < entryCount && entries[position].slot == slot) {
+        return entries[position];
+    }
+
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    if (entryCount == capacity) {
+        int grownCapacity = capacity > 0 ? capacity * 2 : 16;
+        SaveIndexEntry* grown = new SaveIndexEntry[grownCapacity];
+        for (int i = 0; i < entryCount; i++) {
+            std::swap(grown[i], entries[i]);
+        }
+        delete[] entries;
+        entries = grown;
+        capacity = grownCapacity;
+    }
+
+    // Shift the tail up one place
+    for (int i = entryCount; i > position; i--) {
+        std::swap(entries[i], entries[i - 1]);
+    }
+    entries[position] = SaveIndexEntry();
+    entries[position].slot = slot;
+    entryCount++;
+    dirty = true;
+    return entries[position];
+}
+
+void SaveIndex::removeAt(int position) {
+    for (int i = position; i < entryCount - 1; i++) {
+        std::swap(entries[i], entries[i + 1]);
+    }
+    entryCount--;
+    entries[entryCount] = SaveIndexEntry();
+    dirty = true;
+}
+
+// Helper: Whole file for the checksums, INFO chunk for the listing
+void SaveIndex::readEntry(SaveIndexEntry& entry, long long size, long long modified) const {
+    entry.fileSize = size;
+    entry.modifiedTime = modified;
+    entry.playerName.clear();
+    entry.level = 0;
+    entry.saveTime = 0;
+    entry.checksum = 0;
+    entry.integrity = SaveIntegrity::INVALID;
+
+    MappedFile file;
+    if (!file.open(directory + "/" + entry.slot + ".dat")) return;
+    entry.checksum = crc32c(0, file.getData(), file.getSize());
+    entry.integrity = verifySave(file.getData(), file.getSize());
+    if (entry.integrity == SaveIntegrity::INVALID) return;
+
+    // INFO is the first chunk, so a slot damaged further in still shows its name
+    SaveState info;
+    if (decodeSave(file.getData(), file.getSize(), info, true)) {
+        entry.playerName = info.playerName;
+        entry.level = info.level;
+        entry.saveTime = info.saveTime;
+    }
+}
+
+// OPEN: Read saves.idx (a missing or damaged index is rebuilt by refresh)
+void SaveIndex::open(const std::string& saveDirectory) {
+    directory = saveDirectory;
+    while (entryCount > 0) {
+        removeAt(entryCount - 1);
+    }
+    dirty = !loadFile();
+}
+
+bool SaveIndex::loadFile() {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    std::string bytes;
+    if (!readFileBytes(directory + "/" + INDEX_FILE, bytes) || bytes.size() < sizeof(INDEX_MAGIC) ||
+        memcmp(bytes.data(), INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+        return false;
+    }
+
+    SaveReader reader(reinterpret_cast<const unsigned char*>(bytes.data()) + sizeof(INDEX_MAGIC),
+                      bytes.size() - sizeof(INDEX_MAGIC));
+    reader.setChecksummed(true);
+    unsigned int tag = 0;
+    SaveReader in;
+    while (reader.nextChunk(tag, in)) {
+        if (tag == CHUNK_END) return true;
+        if (tag != CHUNK_INDEX) continue;
+
+        // Each entry takes at least eight bytes
+        unsigned long long count = in.readVarint();
+        if (in.failed() || count > in.remaining() / 8) return false;
+        for (unsigned long long i = 0; i < count; i++) {
+            std::string slot = in.readString();
+            if (in.failed()) return false;
+            SaveIndexEntry& entry = findOrInsert(slot);
+            entry.playerName = in.readString();
+            entry.level = in.readInt32();
+            entry.saveTime = in.readInt();
+            entry.fileSize = in.readInt();
+            entry.modifiedTime = in.readInt();
+            entry.checksum = in.readVarint();
+            unsigned long long integrity = in.readVarint();
+            if (in.failed() || integrity > static_cast<unsigned long long>(SaveIntegrity::INVALID)) {
+                return false;
+            }
+            entry.integrity = static_cast<SaveIntegrity>(integrity);
+        }
+    }
+    return false;   // Truncated
+}
+
+// FLUSH: Rewrite saves.idx (atomic, so a crash leaves the old index)
+bool SaveIndex::flush() {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    if (!dirty || directory.empty()) return true;
+
+    SaveWriter writer;
+    writer.beginChunk(CHUNK_INDEX);
+    writer.writeVarint(static_cast<unsigned long long>(entryCount));
+    for (int i = 0; i < entryCount; i++) {
+        const SaveIndexEntry& entry = entries[i];
+        writer.writeString(entry.slot);
+        writer.writeString(entry.playerName);
+        writer.writeInt(entry.level);
+        writer.writeInt(entry.saveTime);
+        writer.writeInt(entry.fileSize);
+        writer.writeInt(entry.modifiedTime);
+        writer.writeVarint(entry.checksum);
+        writer.writeVarint(static_cast<unsigned long long>(entry.integrity));
+    }
+
+    std::string bytes(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    bytes += writer.finish();
+    if (!writeFileAtomic(directory + "/" + INDEX_FILE, bytes.data(), bytes.size())) {
+        std::cout << "[SaveIndex] Failed to write " << INDEX_FILE << std::endl;
+        return false;
+    }
+    dirty = false;
+    return true;
+}
+
+// RECORD: The caller already has the bytes, so nothing is read back
+void SaveIndex::recordSave(const std::string& slot, const SaveState& info,
+                           const std::string& bytes) {
+    SaveIndexEntry& entry = findOrInsert(slot);
+    entry.playerName = info.playerName;
+    entry.level = info.level;
+    entry.saveTime = info.saveTime;
+    entry.fileSize = static_cast<long long>(bytes.size());
+    entry.modifiedTime = -1;
+    entry.checksum = crc32c(0, bytes.data(), bytes.size());
+    entry.integrity = SaveIntegrity::VALID;
+    dirty = true;
+}
+
+void SaveIndex::recordInfo(const std::string& slot, const SaveState& info) {
+    int position = lowerBound(slot);
+    if (position == entryCount || entries[position].slot != slot) return;
+
+    SaveIndexEntry& entry = entries[position];
+    entry.playerName = info.playerName;
+    entry.level = info.level;
+    entry.saveTime = info.saveTime;
+    dirty = true;
+}
+
+void SaveIndex::remove(const std::string& slot) {
+    int position = lowerBound(slot);
+    if (position < entryCount && entries[position].slot == slot) {
+        removeAt(position);
+    }
+}
+
+// SCAN
+void SaveIndex::refresh() {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    if (directory.empty()) return;
+
+    // Step 1
+    int fileCount = 0;
+    SaveFileStat* files = scanSaveFiles(directory, fileCount);
+
+    // Step 2
+    bool* seen = new bool[entryCount + fileCount]();
+    int reread = 0;
+    for (int i = 0; i < fileCount; i++) {
+        const SaveFileStat& file = files[i];
+        int position = lowerBound(file.slot);
+        bool known = position < entryCount && entries[position].slot == file.slot;
+        SaveIndexEntry& entry = known ? entries[position] : findOrInsert(file.slot);
+        if (!known) {
+            // Inserted: shift the seen flags of the entries after it
+            for (int j = entryCount - 1; j > position; j--) {
+                seen[j] = seen[j - 1];
+            }
+        }
+        seen[position] = true;
+
+        if (known && entry.fileSize == file.size) {
+            if (entry.modifiedTime == file.modified) continue;
+            if (entry.modifiedTime == -1) {     // Written after it was recorded
+                entry.modifiedTime = file.modified;
+                dirty = true;
+                continue;
+            }
+        }
+        readEntry(entry, file.size, file.modified);
+        dirty = true;
+        reread++;
+    }
+    delete[] files;
+
+    // Step 3
+    for (int i = entryCount - 1; i >= 0; i--) {
+        if (!seen[i]) removeAt(i);
+    }
+    delete[] seen;
+
+    if (reread > 0) {
+        std::cout << "[SaveIndex] Indexed " << reread << " changed save(s)." << std::endl;
+    }
+    flush();
+}
+
+// Access
+int SaveIndex::getCount() const { return entryCount; }
+const SaveIndexEntry& SaveIndex::getEntry(int index) const { return entries[index]; }
+
+const SaveIndexEntry* SaveIndex::find(const std::string& slot) const {
+    int position = lowerBound(slot);
+    if (position < entryCount && entries[position].slot == slot) {
+        return &entries[position];
+    }
+    return nullptr;
+}
@@ -0,0 +1,279 @@
+/*******************************************************************************
+ * SaveJournal.cpp - Delta Save Journal Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/SaveJournal.h"
+#include "../include/SaveFormat.h"
+#include "../include/SaveLoad.h"
+#include "../include/AutoSave.h"
+#include "../include/SaveView.h"
+#include "../include/MemoryTracker.h"
+#include <cstring>
+#include <ctime>
+
+static const char JOURNAL_MAGIC[4] = {'D', 'J', 'N', 'L'};
+
+// Sections fingerprinted as a whole, in record order
+static const unsigned int HASHED_TAGS[] = {
+    CHUNK_PLAYER, CHUNK_WORLD, CHUNK_INVENTORY, CHUNK_ABILITIES, CHUNK_STATS, CHUNK_PARTY
+};
+static const unsigned int HASHED_BITS[] = {
+    SECTION_PLAYER, SECTION_WORLD, SECTION_INVENTORY, SECTION_ABILITIES, SECTION_STATS,
+    SECTION_PARTY
+};
+
+// Helper: Fingerprint an integer field
+static unsigned long long hashInt(unsigned long long hash, long long value) {
+    return fingerprintBytes(hash, &value, sizeof(value));
+}
+
+// Helper: Fingerprint of one sector (visited flag + every enemy)
+// enemy is the sector's first entry in the grouped enemy arrays; advanced past it
+static unsigned long long hashSector(const SaveState& state, int sector, int& enemy) {
+    bool visited = (state.visitedSectors[sector / 64] & (1ULL << (sector % 64))) != 0;
+    unsigned long long hash = hashInt(FINGERPRINT_SEED, visited ? 1 : 0);
+    while (enemy < state.sectorEnemyCount && state.enemySectors[enemy] == sector) {
+        hash = hashInt(hash, state.enemyTypes[enemy]);
+        hash = hashInt(hash, state.enemyHealth[enemy]);
+        const std::string& name = state.enemyNames[enemy];
+        hash = fingerprintBytes(hash, name.data(), name.size());
+        enemy++;
+    }
+    return hash;
+}
+
+/*******************************************************************************
+ * JOURNAL FILE
+ ******************************************************************************/
+
+void encodeJournalHeader(unsigned long long generation, std::string& out) {
+    out.assign(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    SaveWriter::appendVarint(out, generation);
+}
+
+// REPLAY: Header must carry the base's generation; stop at a torn tail
+int replayJournal(const unsigned char* data, std::size_t size, SaveState& state) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    if (data == nullptr || size < sizeof(JOURNAL_MAGIC) ||
+        memcmp(data, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0) {
+        return -1;
+    }
+
+    // Records are written in the same chunk format as their base
+    SaveReader reader(data + sizeof(JOURNAL_MAGIC), size - sizeof(JOURNAL_MAGIC));
+    reader.setChecksummed(state.version >= FIRST_CHECKSUM_VERSION);
+    unsigned long long generation = reader.readVarint();
+    if (reader.failed() || generation == 0 || generation != state.journalGeneration) {
+        return -1;
+    }
+
+    int applied = 0;
+    while (!reader.atEnd()) {
+        unsigned long long length = reader.readVarint();
+        SaveReader record;
+        if (reader.failed() || length > reader.remaining() ||
+            !reader.readSlice(static_cast<std::size_t>(length), record)) {
+            break;      // Torn last record
+        }
+        if (!decodeChunks(record, state)) {
+            std::cout << "[SaveJournal] Corrupt record " << applied << ", replay stopped." << std::endl;
+            break;
+        }
+        applied++;
+    }
+    return applied;
+}
+
+// COMPACT: Decode base + records, write the result as the new base
+// Step 1: Read and decode the base, replay the journal on top
+// Step 2: Write the new base (atomic), then the new empty journal (atomic)
+bool compactJournal(const std::string& basePath, const std::string& journalPath,
+                    unsigned long long generation) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+
+    // Step 1 (mappings closed again before either file is replaced)
+    SaveState state;
+    {
+        MappedFile base;
+        if (!base.open(basePath) || !decodeSave(base.getData(), base.getSize(), state)) {
+            return false;
+        }
+        MappedFile journal;
+        if (journal.open(journalPath)) {
+            replayJournal(journal.getData(), journal.getSize(), state);
+        }
+    }
+
+    // Step 2 (a crash between the writes leaves a stale journal, which is skipped)
+    state.version = SAVE_VERSION;
+    state.journalGeneration = generation;
+    std::string bytes;
+    encodeSave(state, bytes);
+    if (!writeFileAtomic(basePath, bytes.data(), bytes.size())) return false;
+
+    std::string header;
+    encodeJournalHeader(generation, header);
+    return writeFileAtomic(journalPath, header.data(), header.size());
+}
+
+/*******************************************************************************
+ * SAVE JOURNAL
+ ******************************************************************************/
+
+// Constructor
+SaveJournal::SaveJournal(const std::string& slot)
+    : slot(slot), hasBase(false), generation(0), deltaCount(0),
+      sectorHashes(nullptr), sectorCount(0), inventoryModCount(0), eventsWritten(0) {
+    for (int i = 0; i < HASHED_SECTIONS; i++) {
+        sectionHashes[i] = 0;
+    }
+}
+
+// Destructor
+SaveJournal::~SaveJournal() {
+    delete[] sectorHashes;
+}
+
+// Helper: Seconds since the epoch in the high bits, a counter in the low
+unsigned long long SaveJournal::nextGeneration() {
+    static unsigned long long counter = 0;
+    counter++;
+    return (static_cast<unsigned long long>(time(nullptr)) << 16) + (counter & 0xFFFF);
+}
+
+// Helper: Fingerprint every section and sector of a full state
+void SaveJournal::remember(const SaveState& state) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    for (int i = 0; i < HASHED_SECTIONS; i++) {
+        SaveWriter scratch;
+        encodeSection(scratch, HASHED_TAGS[i], state);
+        const std::string& bytes = scratch.getOutput();
+        sectionHashes[i] = fingerprintBytes(FINGERPRINT_SEED, bytes.data(), bytes.size());
+    }
+
+    if (sectorCount != state.sectorCount) {
+        delete[] sectorHashes;
+        sectorCount = state.sectorCount;
+        sectorHashes = sectorCount > 0 ? new unsigned long long[sectorCount] : nullptr;
+    }
+    int enemy = 0;
+    for (int i = 0; i < sectorCount; i++) {
+        sectorHashes[i] = hashSector(state, i, enemy);
+    }
+}
+
+const std::string& SaveJournal::getSlot() const { return slot; }
+bool SaveJournal::hasBaseSnapshot() const { return hasBase; }
+bool SaveJournal::inventoryChanged(int modCount) const { return modCount != inventoryModCount; }
+int SaveJournal::getEventsWritten() const { return eventsWritten; }
+
+// BASE
+void SaveJournal::buildBase(SaveState& state, int modCount, std::string& bytes, std::string& header) {
+    generation = nextGeneration();
+    state.journalGeneration = generation;
+    encodeSave(state, bytes);
+    encodeJournalHeader(generation, header);
+
+    remember(state);
+    inventoryModCount = modCount;
+    eventsWritten = state.eventCount;
+    deltaCount = 0;
+    hasBase = true;
+}
+
+// DELTA
+bool SaveJournal::buildDelta(const SaveState& state, int modCount, std::string& record) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    SaveWriter writer;
+    bool changed = false;
+
+    // Step 1: INFO always (slot summary), hashed sections only when they differ
+    encodeSection(writer, CHUNK_INFO, state);
+    for (int i = 0; i < HASHED_SECTIONS; i++) {
+        if ((state.sections & HASHED_BITS[i]) == 0) continue;
+
+        std::size_t mark = writer.getSize();
+        encodeSection(writer, HASHED_TAGS[i], state);
+        const std::string& bytes = writer.getOutput();
+        unsigned long long hash = fingerprintBytes(FINGERPRINT_SEED, bytes.data() + mark,
+                                                   bytes.size() - mark);
+        if (hash == sectionHashes[i]) {
+            writer.truncate(mark);
+        } else {
+            sectionHashes[i] = hash;
+            changed = true;
+        }
+    }
+    if (state.sections & SECTION_INVENTORY) {
+        inventoryModCount = modCount;
+    }
+
+    // Step 2: Sectors
+    if ((state.sections & SECTION_SECTORS) && state.sectorCount > 0) {
+        if (state.sectorCount != sectorCount) {
+            encodeSection(writer, CHUNK_SECTORS, state);
+            delete[] sectorHashes;
+            sectorCount = state.sectorCount;
+            sectorHashes = new unsigned long long[sectorCount];
+            int enemy = 0;
+            for (int i = 0; i < sectorCount; i++) {
+                sectorHashes[i] = hashSector(state, i, enemy);
+            }
+            changed = true;
+        } else {
+            bool* dirty = new bool[sectorCount];
+            bool anyDirty = false;
+            int enemy = 0;
+            for (int i = 0; i < sectorCount; i++) {
+                unsigned long long hash = hashSector(state, i, enemy);
+                dirty[i] = hash != sectorHashes[i];
+                if (dirty[i]) {
+                    sectorHashes[i] = hash;
+                    anyDirty = true;
+                }
+            }
+            if (anyDirty) {
+                encodeSectorDelta(writer, state, dirty);
+                changed = true;
+            }
+            delete[] dirty;
+        }
+    }
+
+    // Step 3: Events logged since the last save (state holds only those)
+    if ((state.sections & SECTION_EVENTS) && state.eventCount > 0) {
+        encodeSection(writer, CHUNK_EVENTS, state);
+        eventsWritten += state.eventCount;
+        changed = true;
+    }
+
+    if (!changed) return false;
+
+    const std::string& payload = writer.finish();
+    record.clear();
+    SaveWriter::appendVarint(record, payload.size());
+    record += payload;
+    deltaCount++;
+    return true;
+}
+
+bool SaveJournal::needsCompaction() const {
+    return deltaCount >= COMPACT_AFTER;
+}
+
+unsigned long long SaveJournal::beginCompaction() {
+    generation = nextGeneration();
+    deltaCount = 0;
+    return generation;
+}
+
+void SaveJournal::reset() {
+    hasBase = false;
+    generation = 0;
+    deltaCount = 0;
+    inventoryModCount = 0;
+    eventsWritten = 0;
+}
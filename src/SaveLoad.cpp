@@ -8,10 +8,20 @@
  ******************************************************************************/
 
 #include "../include/SaveLoad.h"
+#include "../include/SaveFormat.h"
+#include "../include/AutoSave.h"
+#include "../include/SaveJournal.h"
+#include "../include/SaveIndex.h"
+#include "../include/SaveView.h"
+#include "../include/ConfigFile.h"
 #include "../include/Entity.h"
 #include "../include/Iterator.h"
 #include "../include/Tree.h"
 #include "../include/LinkedList.h"
+#include "../include/HashTable.h"
+#include "../include/SentinelPool.h"
+#include "../include/Profiler.h"
+#include "../include/MemoryTracker.h"
 #include <cstring>
 #include <ctime>
 #include <sys/stat.h>
@@ -19,19 +29,30 @@
 // Cross-platform ctime_r/ctime_s wrapper
 #ifdef _WIN32
 #define SAFE_CTIME(time_ptr, buffer, size) ctime_s(buffer, size, time_ptr)
-#define SAFE_STRNCPY(dest, dest_size, src, count) strncpy_s(dest, dest_size, src, count)
 #else
 #define SAFE_CTIME(time_ptr, buffer, size) ctime_r(time_ptr, buffer)
-#define SAFE_STRNCPY(dest, dest_size, src, count) strncpy(dest, src, count)
 #endif
 
+/*******************************************************************************
+ * SESSION STATISTICS
+ ******************************************************************************/
+
+SessionStats::SessionStats()
+    : turnCount(0), sectorsExplored(0), enemiesDefeated(0), hacksCompleted(0),
+      eventsTriggered(0), partyCount(0), partySpecialties(), partyLoyalty(), partyHealth() {
+}
+
 /*******************************************************************************
  * SAVE/LOAD MANAGER IMPLEMENTATION
  ******************************************************************************/
 
 // Private constructor
 SaveLoadManager::SaveLoadManager()
-    : savePath(""), configPath("config.ini"), initialized(false) {
+    : savePath(""), configPath("config.ini"), configSize(-1), configModified(-1),
+      initialized(false), compressSaves(true),
+      autoSaveWriter(nullptr), reportedAutoSaveFailures(0),
+      quickJournal(new SaveJournal("quicksave")), autoJournal(new SaveJournal("autosave")),
+      saveIndex(new SaveIndex()) {
 }
 
 // Singleton instance
@@ -42,6 +63,11 @@ SaveLoadManager& SaveLoadManager::getInstance() {
 
 // Destructor
 SaveLoadManager::~SaveLoadManager() {
+    delete autoSaveWriter;  // Writes any pending snapshot, joins the thread
+    delete quickJournal;
+    delete autoJournal;
+    saveIndex->flush();     // Entries recorded by auto-saves since the last listing
+    delete saveIndex;
 }
 
 // Initialize save system
@@ -56,263 +82,503 @@ bool SaveLoadManager::initialize(const std::string& saveDirectory) {
     }
 
     configPath = savePath + "/config.ini";
+    saveIndex->open(savePath);
     initialized = true;
 
     std::cout << "[SaveLoad] Initialized. Save path: " << savePath << std::endl;
     return true;
 }
 
+// Helper: Snapshot the game into a SaveState
+void SaveLoadManager::captureState(SaveState& state, Player* player, Inventory* inventory,
+                                   AbilityTree* abilities, GridMap* map, EventLog* events,
+                                   const SessionStats& stats, unsigned int sections,
+                                   int eventsFrom) const {
+    state.version = SAVE_VERSION;
+    state.sections = sections;
+    state.compressed = compressSaves;
+    state.saveTime = static_cast<long long>(time(nullptr));
+
+    // Player data
+    state.playerName = player->getName();
+    state.level = player->getLevel();
+    state.health = player->getHealth();
+    state.maxHealth = player->getMaxHealth();
+    state.experience = player->getExperience();
+    state.attackPower = player->getAttackPower();
+    state.defense = player->getDefense();
+    state.speed = player->getSpeed();
+    state.hackingSkill = player->getHackingSkill();
+
+    if (map != nullptr) {
+        // Current sector
+        if (map->getCurrentSector() != nullptr) {
+            state.currentSector = map->getCurrentSector()->name;
+        }
+
+        // Sectors: visited bitset, then every enemy still standing
+        int sectors = map->getSectorCount();
+        int enemies = 0;
+        state.sectorCount = sectors;
+        state.setVisitedWordCount((sectors + 63) / 64);
+        for (int i = 0; i < sectors; i++) {
+            SectorNode* sector = map->getSector(i);
+            if (sector->visited) {
+                state.visitedSectors[i / 64] |= 1ULL << (i % 64);
+            }
+            enemies += sector->enemyCount;
+        }
+
+        state.setSectorEnemyCount(enemies);
+        int index = 0;
+        for (int i = 0; i < sectors; i++) {
+            SectorNode* sector = map->getSector(i);
+            for (int j = 0; j < sector->enemyCount; j++) {
+                Sentinel* enemy = sector->enemies[j];
+                state.enemySectors[index] = i;
+                state.enemyTypes[index] = static_cast<int>(enemy->getType());
+                state.enemyHealth[index] = enemy->getHealth();
+                state.enemyNames[index] = enemy->getName();
+                index++;
+            }
+        }
+    }
+
+    // Inventory (no cap - the format stores as many items as there are)
+    if (inventory != nullptr && (sections & SECTION_INVENTORY)) {
+        state.setInventoryCount(inventory->getItemCount());
+        int count = 0;
+        InventoryIterator* it = inventory->createIterator("all");
+        while (it->hasNext() && count < state.inventoryCount) {
+            Item* item = it->next();
+            state.inventoryCodes[count] = item->code;
+            state.inventoryQuantities[count] = item->quantity;
+            count++;
+        }
+        delete it;
+        state.inventoryCount = count;
+    }
+
+    // Abilities (unlocked bitset words, as many as the tree needs)
+    if (abilities != nullptr) {
+        const AbilityProgress& progress = abilities->getProgress();
+        state.abilityCount = abilities->getTotalAbilities();
+        state.skillPoints = abilities->getSkillPoints();
+        state.unlockedAbilityCount = progress.unlockedCount;
+        state.setUnlockedWordCount(progress.wordCount);
+        if (progress.wordCount > 0) {
+            memcpy(state.unlockedAbilities, progress.unlockedBits,
+                   sizeof(unsigned long long) * progress.wordCount);
+        }
+    }
+
+    // Statistics
+    state.turnCount = stats.turnCount;
+    state.sectorsExplored = stats.sectorsExplored;
+    state.enemiesDefeated = stats.enemiesDefeated;
+    state.hacksCompleted = stats.hacksCompleted;
+    state.eventsTriggered = stats.eventsTriggered;
+
+    // Party
+    if (sections & SECTION_PARTY) {
+        state.setPartyCount(stats.partyCount);
+        for (int i = 0; i < state.partyCount; i++) {
+            state.partyNames[i] = stats.partyNames[i];
+            state.partySpecialties[i] = stats.partySpecialties[i];
+            state.partyLoyalty[i] = stats.partyLoyalty[i];
+            state.partyHealth[i] = stats.partyHealth[i];
+        }
+    }
+
+    // Events newer than eventsFrom (the log is newest first, the save oldest first)
+    if (events != nullptr && (sections & SECTION_EVENTS)) {
+        int fresh = events->getEventCount() - eventsFrom;
+        if (fresh > 0) {
+            int first = state.appendEvents(fresh);
+            const EventNode* node = events->getHead();
+            for (int i = first + fresh - 1; i >= first && node != nullptr; i--) {
+                state.eventTypes[i] = node->eventType;
+                state.eventDescriptions[i] = node->description;
+                state.eventTimestamps[i] = node->timestamp;
+                node = node->next;
+            }
+        }
+    }
+}
+
+// Helper: Rebuild the inventory in one pass
+// Step 1: Resolve every code through the ItemDatabase in one bulk call
+// Step 2: Clone the templates (reusing the lookup array for the clones)
+// Step 3: Link them all at once, in saved order
+void SaveLoadManager::applyInventory(const SaveState& state, Inventory* inventory,
+                                     const ItemDatabase* items) const {
+    MEM_SCOPE(MemSubsystem::INVENTORY);
+    if (inventory == nullptr) return;
+
+    inventory->clear();
+    if (state.inventoryCount == 0) return;
+    if (items == nullptr) {
+        std::cout << "[SaveLoad] No item database, inventory not restored." << std::endl;
+        return;
+    }
+
+    // Step 1
+    Item** resolved = new Item*[state.inventoryCount];
+    items->resolveItems(state.inventoryCodes, state.inventoryCount, resolved);
+
+    // Step 2
+    int restored = 0;
+    for (int i = 0; i < state.inventoryCount; i++) {
+        const Item* entry = resolved[i];
+        if (entry == nullptr || state.inventoryQuantities[i] <= 0) continue;
+
+        Item* item = new Item(*entry);
+        item->quantity = state.inventoryQuantities[i];
+        resolved[restored++] = item;
+    }
+
+    // Step 3
+    inventory->restoreItems(resolved, restored);
+    delete[] resolved;
+
+    if (restored < state.inventoryCount) {
+        std::cout << "[SaveLoad] Skipped " << (state.inventoryCount - restored)
+                  << " unknown item(s)." << std::endl;
+    }
+}
+
+// Helper: Visited flags and sector enemies (map layout must match the save)
+void SaveLoadManager::applySectors(const SaveState& state, GridMap* map) const {
+    MEM_SCOPE(MemSubsystem::ENTITY);
+    if (map == nullptr || state.sectorCount == 0) return;   // Older save: keep defaults
+
+    int sectors = map->getSectorCount();
+    if (state.sectorCount != sectors) {
+        std::cout << "[SaveLoad] Map changed since save, sectors reset." << std::endl;
+        return;
+    }
+
+    for (int i = 0; i < sectors; i++) {
+        SectorNode* sector = map->getSector(i);
+        int word = i / 64;
+        sector->visited = word < state.visitedWordCount &&
+                          (state.visitedSectors[word] & (1ULL << (i % 64))) != 0;
+        sector->clearEnemies();
+    }
+
+    SentinelPool::getInstance().reserve(state.sectorEnemyCount);
+    for (int i = 0; i < state.sectorEnemyCount; i++) {
+        int index = state.enemySectors[i];
+        int type = state.enemyTypes[i];
+        if (index >= sectors || type > static_cast<int>(Sentinel::Type::ELITE) ||
+            state.enemyHealth[i] <= 0) {
+            continue;
+        }
+
+        SectorNode* sector = map->getSector(index);
+        if (sector->enemyCount >= sector->maxEnemies) continue;
+
+        Sentinel* enemy = new Sentinel(state.enemyNames[i], static_cast<Sentinel::Type>(type));
+        enemy->setHealth(state.enemyHealth[i]);
+        sector->addEnemy(enemy);
+    }
+}
+
+// Helper: Event log, oldest first so the newest ends up at the head
+void SaveLoadManager::applyEvents(const SaveState& state, EventLog* events) const {
+    if (events == nullptr) return;
+
+    events->clear();
+    for (int i = 0; i < state.eventCount; i++) {
+        events->restoreEvent(state.eventDescriptions[i], state.eventTypes[i],
+                             state.eventTimestamps[i]);
+    }
+}
+
+// Helper: Push a decoded SaveState back into the game
+void SaveLoadManager::applyState(const SaveState& state, Player* player, Inventory* inventory,
+                                 AbilityTree* abilities, GridMap* map, EventLog* events,
+                                 SessionStats& stats, const ItemDatabase* items) const {
+    // Player data (max health first, setHealth clamps to it)
+    player->setName(state.playerName);
+    player->setMaxHealth(state.maxHealth);
+    player->setHealth(state.health);
+    player->setLevel(state.level);
+    player->setExperience(state.experience);
+    player->setAttackPower(state.attackPower);
+    player->setDefense(state.defense);
+    player->setSpeed(state.speed);
+    player->setHackingSkill(state.hackingSkill);
+
+    // Map: sectors, then location
+    applySectors(state, map);
+    if (map != nullptr) {
+        if (!state.currentSector.empty()) {
+            SectorNode* sector = map->findSector(state.currentSector);
+            if (sector != nullptr) {
+                map->setCurrentSector(sector);
+            }
+        }
+        if (map->getCurrentSector() != nullptr) {
+            player->setCurrentSector(map->getCurrentSector()->name);
+        }
+    }
+
+    // Inventory
+    applyInventory(state, inventory, items);
+
+    // Abilities (bit i = ability i, so the tree must match; version 1 saves
+    // list codes, which are looked up instead)
+    if (abilities != nullptr) {
+        if (state.version == ORIGINAL_SAVE_VERSION) {
+            int missing = abilities->restoreUnlocked(state.unlockedCodes, state.unlockedCodeCount,
+                                                     state.skillPoints);
+            if (missing > 0) {
+                std::cout << "[SaveLoad] " << missing << " saved abilities no longer exist."
+                          << std::endl;
+            }
+        } else if (state.abilityCount == abilities->getTotalAbilities()) {
+            abilities->restoreUnlocked(state.unlockedAbilities, state.unlockedWordCount,
+                                       state.skillPoints);
+        } else {
+            std::cout << "[SaveLoad] Ability tree changed since save, unlocks reset." << std::endl;
+            abilities->addSkillPoints(state.skillPoints);
+        }
+    }
+
+    // Events
+    applyEvents(state, events);
+
+    // Statistics
+    stats.turnCount = state.turnCount;
+    stats.sectorsExplored = state.sectorsExplored;
+    stats.enemiesDefeated = state.enemiesDefeated;
+    stats.hacksCompleted = state.hacksCompleted;
+    stats.eventsTriggered = state.eventsTriggered;
+
+    // Party (allies beyond SAVE_MAX_PARTY, fallen or of an unknown specialty are dropped)
+    stats.partyCount = 0;
+    for (int i = 0; i < state.partyCount && stats.partyCount < SAVE_MAX_PARTY; i++) {
+        if (state.partyHealth[i] <= 0 ||
+            state.partySpecialties[i] > static_cast<int>(Awakened::Specialty::SCOUT)) {
+            continue;
+        }
+        int slot = stats.partyCount++;
+        stats.partyNames[slot] = state.partyNames[i];
+        stats.partySpecialties[slot] = state.partySpecialties[i];
+        stats.partyLoyalty[slot] = state.partyLoyalty[i];
+        stats.partyHealth[slot] = state.partyHealth[i];
+    }
+}
+
 // SAVE GAME
-// Step 1: Open file for binary writing
-// Step 2: Write signature and version
-// Step 3: Serialize player data
-// Step 4: Serialize inventory
-// Step 5: Serialize abilities
-// Step 6: Serialize game state
-// Step 7: Close file
+// Step 1: Capture player, map, inventory, abilities, events, statistics, party
+// Step 2: Encode as chunks (SaveFormat.h)
+// Step 3: Write the bytes
 bool SaveLoadManager::saveGame(const std::string& filename, Player* player,
                                Inventory* inventory, AbilityTree* abilities,
-                               GridMap* map, int turnCount) {
+                               GridMap* map, EventLog* events, const SessionStats& stats) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    PROFILE_SCOPE(ProfilePhase::SAVE_GAME);
     if (!initialized || player == nullptr) {
         std::cout << "[SaveLoad] Cannot save - system not initialized or no player." << std::endl;
         return false;
     }
 
     std::string fullPath = savePath + "/" + filename + ".dat";
+    flushAutoSave();    // An older background snapshot must not land after this one
 
-    // Step 1: Open file
-    std::ofstream file(fullPath, std::ios::binary);
-    if (!file.is_open()) {
-        std::cout << "[SaveLoad] Failed to open file for writing: " << fullPath << std::endl;
-        return false;
-    }
+    // Step 1: Capture
+    SaveState state;
+    captureState(state, player, inventory, abilities, map, events, stats, SECTION_ALL, 0);
 
-    std::cout << "[SaveLoad] Saving game to: " << fullPath << std::endl;
+    // Step 2: Encode
+    std::string bytes;
+    encodeSave(state, bytes);
 
-    // Create save data structure
-    SaveData data;
-    memset(&data, 0, sizeof(SaveData));
-
-    // Step 2: Write signature and version
-    SAFE_STRNCPY(data.signature, sizeof(data.signature), "DEXODUS", 7);
-    data.signature[7] = '\0';
-    data.version = 1;
-    data.saveTime = time(nullptr);
-
-    // Step 3: Serialize player data
-    SAFE_STRNCPY(data.playerName, sizeof(data.playerName), player->getName().c_str(), 31);
-    data.playerName[31] = '\0';
-    data.health = player->getHealth();
-    data.maxHealth = player->getMaxHealth();
-    data.level = player->getLevel();
-    data.experience = player->getExperience();
-    data.attackPower = player->getAttackPower();
-    data.defense = player->getDefense();
-    data.speed = player->getSpeed();
-    data.hackingSkill = player->getHackingSkill();
-
-    // Current sector
-    if (map != nullptr && map->getCurrentSector() != nullptr) {
-        SAFE_STRNCPY(data.currentSector, sizeof(data.currentSector), map->getCurrentSector()->name.c_str(), 63);
-        data.currentSector[63] = '\0';
-    }
-
-    // Step 4: Serialize inventory
-    data.inventoryCount = 0;
-    if (inventory != nullptr) {
-        InventoryIterator* it = inventory->createIterator("all");
-        while (it->hasNext() && data.inventoryCount < 50) {
-            Item* item = it->next();
-            SAFE_STRNCPY(data.inventoryCodes[data.inventoryCount], sizeof(data.inventoryCodes[data.inventoryCount]), item->code.c_str(), 31);
-            data.inventoryCodes[data.inventoryCount][31] = '\0';
-            data.inventoryQuantities[data.inventoryCount] = item->quantity;
-            data.inventoryCount++;
-        }
-        delete it;
+    // Step 3: Write (temp file + rename, the old save survives a failed write)
+    std::cout << "[SaveLoad] Saving game to: " << fullPath << std::endl;
+    if (!writeFileAtomic(fullPath, bytes.data(), bytes.size())) {
+        std::cout << "[SaveLoad] Failed to write save file: " << fullPath << std::endl;
+        return false;
     }
 
-    // Step 5: Serialize abilities
-    data.unlockedAbilityCount = 0;
-    data.skillPoints = abilities ? abilities->getSkillPoints() : 0;
-    if (abilities != nullptr) {
-        int count = 0;
-        Ability** unlocked = abilities->getUnlockedAbilities(count);
-        for (int i = 0; i < count && data.unlockedAbilityCount < 20; i++) {
-            SAFE_STRNCPY(data.unlockedAbilities[data.unlockedAbilityCount],
-                    sizeof(data.unlockedAbilities[data.unlockedAbilityCount]),
-                    unlocked[i]->code.c_str(), 31);
-            data.unlockedAbilities[data.unlockedAbilityCount][31] = '\0';
-            data.unlockedAbilityCount++;
+    saveIndex->recordSave(filename, state, bytes);
+    saveIndex->flush();
+
+    // A full save over a journaled slot replaces its base: drop the journal
+    SaveJournal* journals[] = {quickJournal, autoJournal};
+    for (SaveJournal* journal : journals) {
+        if (journal->getSlot() == filename) {
+            journal->reset();
+            std::remove((savePath + "/" + filename + ".jnl").c_str());
         }
-        delete[] unlocked;
     }
 
-    // Step 6: Game state
-    data.turnCount = turnCount;
-    data.sectorsVisited = 0;
-    data.enemiesDefeated = 0;
-    data.eventsTriggered = 0;
-
-    // Step 7: Write and close
-    file.write(reinterpret_cast<char*>(&data), sizeof(SaveData));
-    file.close();
-
     std::cout << "[SaveLoad] Game saved successfully!" << std::endl;
-    std::cout << "  Player: " << data.playerName << " (Level " << data.level << ")" << std::endl;
-    std::cout << "  Items: " << data.inventoryCount << std::endl;
-    std::cout << "  Abilities: " << data.unlockedAbilityCount << std::endl;
+    std::cout << "  Player: " << state.playerName << " (Level " << state.level << ")" << std::endl;
+    std::cout << "  Items: " << state.inventoryCount << std::endl;
+    std::cout << "  Abilities: " << state.unlockedAbilityCount << std::endl;
+    std::cout << "  Sector enemies: " << state.sectorEnemyCount << std::endl;
+    std::cout << "  Size: " << bytes.size() << " bytes" << std::endl;
 
     return true;
 }
 
 // LOAD GAME
-// Step 1: Open file for binary reading
-// Step 2: Verify signature and version
-// Step 3: Deserialize player data
-// Step 4: Deserialize inventory
-// Step 5: Deserialize abilities
-// Step 6: Deserialize game state
-// Step 7: Close file
+// Step 1: Map the file (pages are read as the decoder reaches them)
+// Step 2: Decode (chunked or legacy version 1/2), replay the slot's journal
+// Step 3: Restore player, map, inventory, abilities, events, statistics, party
 bool SaveLoadManager::loadGame(const std::string& filename, Player* player,
                                Inventory* inventory, AbilityTree* abilities,
-                               GridMap* map, int& turnCount) {
-    // Suppress unused parameter warnings - parameters used in full implementation
-    (void)inventory;
-    (void)abilities;
-    (void)map;
-    (void)turnCount;
-
+                               GridMap* map, EventLog* events, SessionStats& stats,
+                               const ItemDatabase* items) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
     if (!initialized || player == nullptr) {
         std::cout << "[SaveLoad] Cannot load - system not initialized or no player." << std::endl;
         return false;
     }
 
     std::string fullPath = savePath + "/" + filename + ".dat";
+    flushAutoSave();    // Read the newest snapshot, not a half-finished one
 
-    // Step 1: Open file
-    std::ifstream file(fullPath, std::ios::binary);
-    if (!file.is_open()) {
+    // Step 1: Map file
+    MappedFile file;
+    if (!file.open(fullPath)) {
         std::cout << "[SaveLoad] Save file not found: " << fullPath << std::endl;
         return false;
     }
 
     std::cout << "[SaveLoad] Loading game from: " << fullPath << std::endl;
 
-    // Read save data
-    SaveData data;
-    file.read(reinterpret_cast<char*>(&data), sizeof(SaveData));
-    file.close();
-
-    // Step 2: Verify signature
-    if (strncmp(data.signature, "DEXODUS", 7) != 0) {
-        std::cout << "[SaveLoad] Invalid save file format!" << std::endl;
-        return false;
-    }
-
-    if (data.version != 1) {
-        std::cout << "[SaveLoad] Incompatible save version: " << data.version << std::endl;
+    // Step 2: Decode
+    SaveState state;
+    if (!decodeSave(file.getData(), file.getSize(), state)) {
+        // Say why (the failure path is the only one that checks twice)
+        SaveIntegrity integrity = verifySave(file.getData(), file.getSize());
+        if (integrity == SaveIntegrity::CORRUPT) {
+            std::cout << "[SaveLoad] Save file is damaged (section checksum mismatch)!" << std::endl;
+        } else if (integrity == SaveIntegrity::TRUNCATED) {
+            std::cout << "[SaveLoad] Save file is incomplete (cut off mid-write)!" << std::endl;
+        } else {
+            std::cout << "[SaveLoad] Invalid or unsupported save file!" << std::endl;
+        }
         return false;
     }
+    file.close();
 
-    // Step 3: Restore player data
-    player->setHealth(data.health);
-    player->setLevel(data.level);
-    player->setExperience(data.experience);
-    player->setAttackPower(data.attackPower);
-    player->setHackingSkill(data.hackingSkill);
-
-    // Step 4: Restore location
-    if (map != nullptr && strlen(data.currentSector) > 0) {
-        SectorNode* sector = map->findSector(data.currentSector);
-        if (sector != nullptr) {
-            map->setCurrentSector(sector);
+    // Delta records written since the base (a stale journal is skipped)
+    int replayed = 0;
+    if (state.journalGeneration != 0) {
+        MappedFile journal;
+        if (journal.open(savePath + "/" + filename + ".jnl")) {
+            replayed = replayJournal(journal.getData(), journal.getSize(), state);
         }
     }
 
-    // Step 5: Restore abilities
-    if (abilities != nullptr) {
-        abilities->addSkillPoints(data.skillPoints);
-        // Note: Actual ability unlocking would need to iterate through saved codes
-    }
-
-    // Step 6: Restore game state
-    turnCount = data.turnCount;
+    // Step 3: Restore
+    applyState(state, player, inventory, abilities, map, events, stats, items);
+    beginSession();     // Journals describe the old game state now
 
     std::cout << "[SaveLoad] Game loaded successfully!" << std::endl;
-    std::cout << "  Player: " << data.playerName << " (Level " << data.level << ")" << std::endl;
-    std::cout << "  Location: " << data.currentSector << std::endl;
+    std::cout << "  Player: " << state.playerName << " (Level " << state.level << ")" << std::endl;
+    std::cout << "  Location: " << state.currentSector << std::endl;
+    std::cout << "  Items: " << (inventory != nullptr ? inventory->getItemCount() : 0) << std::endl;
+    if (replayed > 0) {
+        std::cout << "  Journal: " << replayed << " delta record(s) replayed" << std::endl;
+    }
+    if (state.version != SAVE_VERSION) {
+        std::cout << "  Format: version " << state.version << " (upgraded on next save)" << std::endl;
+    }
 
     // Display save time
     char timeBuffer[26];
-    SAFE_CTIME(&data.saveTime, timeBuffer, sizeof(timeBuffer));
+    time_t saveTime = static_cast<time_t>(state.saveTime);
+    SAFE_CTIME(&saveTime, timeBuffer, sizeof(timeBuffer));
     std::cout << "  Saved: " << timeBuffer;
 
     return true;
 }
 
-// Save config
+// Helper: Size and modification time of path (false if it does not exist)
+static bool statConfig(const std::string& path, long long& size, long long& modified) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return false;
+    size = static_cast<long long>(st.st_size);
+#if defined(__APPLE__)
+    modified = static_cast<long long>(st.st_mtimespec.tv_sec) * 1000000000LL +
+               st.st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+    modified = static_cast<long long>(st.st_mtime) * 1000000000LL;
+#else
+    modified = static_cast<long long>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+#endif
+    return true;
+}
+
+// Save config (temp file + rename, so a reload never sees half a file)
 bool SaveLoadManager::saveConfig(const ConfigData& config) {
-    std::ofstream file(configPath);
-    if (!file.is_open()) {
+    std::string text;
+    formatConfig(config, text);
+    if (!writeFileAtomic(configPath, text.data(), text.size())) {
         return false;
     }
 
-    file << "[Audio]\n";
-    file << "master_volume=" << config.masterVolume << "\n";
-    file << "music_volume=" << config.musicVolume << "\n";
-    file << "sfx_volume=" << config.sfxVolume << "\n";
-    file << "audio_enabled=" << (config.audioEnabled ? "true" : "false") << "\n";
-    file << "\n";
-
-    file << "[Display]\n";
-    file << "show_tutorials=" << (config.showTutorials ? "true" : "false") << "\n";
-    file << "verbose_mode=" << (config.verboseMode ? "true" : "false") << "\n";
-    file << "\n";
-
-    file << "[Gameplay]\n";
-    file << "difficulty=" << config.difficulty << "\n";
-    file << "auto_save=" << (config.autoSave ? "true" : "false") << "\n";
-
-    file.close();
+    // Our own write is not an outside edit
+    if (!statConfig(configPath, configSize, configModified)) {
+        configSize = configModified = -1;
+    }
     std::cout << "[SaveLoad] Config saved." << std::endl;
     return true;
 }
 
 // Load config
+// Step 1: Defaults for every field
+// Step 2: Remember the file's stamp, read it whole
+// Step 3: One pass over the text (ConfigFile.h)
 bool SaveLoadManager::loadConfig(ConfigData& config) {
-    std::ifstream file(configPath);
-    if (!file.is_open()) {
-        // Set defaults
-        config.masterVolume = 1.0f;
-        config.musicVolume = 0.7f;
-        config.sfxVolume = 0.8f;
-        config.audioEnabled = true;
-        config.showTutorials = true;
-        config.verboseMode = false;
-        config.difficulty = 2;
-        config.autoSave = true;
+    // Step 1
+    setConfigDefaults(config);
+
+    // Step 2
+    if (!statConfig(configPath, configSize, configModified)) {
+        configSize = configModified = -1;
+        return false;
+    }
+    std::string text;
+    if (!readFileBytes(configPath, text)) {
         return false;
     }
 
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.find("master_volume=") == 0) {
-            config.masterVolume = std::stof(line.substr(14));
-        } else if (line.find("music_volume=") == 0) {
-            config.musicVolume = std::stof(line.substr(13));
-        } else if (line.find("sfx_volume=") == 0) {
-            config.sfxVolume = std::stof(line.substr(11));
-        } else if (line.find("audio_enabled=") == 0) {
-            config.audioEnabled = (line.substr(14) == "true");
-        } else if (line.find("difficulty=") == 0) {
-            config.difficulty = std::stoi(line.substr(11));
-        } else if (line.find("auto_save=") == 0) {
-            config.autoSave = (line.substr(10) == "true");
-        }
+    // Step 3
+    int rejected = parseConfig(text.data(), text.size(), config);
+    if (rejected > 0) {
+        std::cout << "[SaveLoad] Config loaded, " << rejected
+                  << " setting(s) ignored." << std::endl;
+    } else {
+        std::cout << "[SaveLoad] Config loaded." << std::endl;
     }
+    return true;
+}
 
-    file.close();
-    std::cout << "[SaveLoad] Config loaded." << std::endl;
+// Reload config if it was edited since we last touched it
+bool SaveLoadManager::reloadConfigIfChanged(ConfigData& config) {
+    long long size = -1;
+    long long modified = -1;
+    if (!statConfig(configPath, size, modified)) {
+        size = modified = -1;
+    }
+    if (size == configSize && modified == configModified) {
+        return false;
+    }
+    if (size < 0) {
+        // Deleted: keep the settings in use, reload when it comes back
+        configSize = configModified = -1;
+        return false;
+    }
+
+    std::cout << "[SaveLoad] Config changed on disk, reloading." << std::endl;
+    loadConfig(config);
     return true;
 }
 
@@ -325,71 +591,229 @@ bool SaveLoadManager::saveExists(const std::string& filename) const {
 
 // Delete save
 bool SaveLoadManager::deleteSave(const std::string& filename) {
+    flushAutoSave();
+    std::remove((savePath + "/" + filename + ".jnl").c_str());
     std::string fullPath = savePath + "/" + filename + ".dat";
-    return std::remove(fullPath.c_str()) == 0;
+    bool removed = std::remove(fullPath.c_str()) == 0;
+    saveIndex->remove(filename);
+    saveIndex->flush();
+    return removed;
+}
+
+// Helper: "Name - Level N - <time>"
+static std::string formatSaveInfo(const std::string& playerName, int level, long long time) {
+    char timeBuffer[26];
+    time_t saveTime = static_cast<time_t>(time);
+    SAFE_CTIME(&saveTime, timeBuffer, sizeof(timeBuffer));
+    timeBuffer[24] = '\0';  // Remove newline
+
+    return playerName + " - Level " + std::to_string(level) + " - " + timeBuffer;
 }
 
-// Get save info
+// Get save info (from the index; slots it has not seen decode only INFO)
 std::string SaveLoadManager::getSaveInfo(const std::string& filename) const {
-    std::string fullPath = savePath + "/" + filename + ".dat";
+    const SaveIndexEntry* entry = saveIndex->find(filename);
+    if (entry != nullptr) {
+        std::string damage;
+        if (entry->integrity == SaveIntegrity::CORRUPT) {
+            damage = "Damaged save file";
+        } else if (entry->integrity == SaveIntegrity::TRUNCATED) {
+            damage = "Incomplete save file";
+        }
+        if (entry->playerName.empty()) {
+            return damage.empty() ? "Invalid save file" : damage;
+        }
+        std::string info = formatSaveInfo(entry->playerName, entry->level, entry->saveTime);
+        return damage.empty() ? info : info + " [" + damage + "]";
+    }
 
-    std::ifstream file(fullPath, std::ios::binary);
-    if (!file.is_open()) {
+    if (!saveExists(filename)) {
         return "Save not found";
     }
-
-    SaveData data;
-    file.read(reinterpret_cast<char*>(&data), sizeof(SaveData));
-    file.close();
-
-    if (strncmp(data.signature, "DEXODUS", 7) != 0) {
+    SaveState state;
+    if (!previewSave(filename, state)) {
         return "Invalid save file";
     }
+    return formatSaveInfo(state.playerName, state.level, state.saveTime);
+}
 
-    char timeBuffer[26];
-    SAFE_CTIME(&data.saveTime, timeBuffer, sizeof(timeBuffer));
-    timeBuffer[24] = '\0';  // Remove newline
+// PREVIEW: Header chunks and the wanted sections straight from the mapping,
+// then the journal's records for those sections
+bool SaveLoadManager::previewSave(const std::string& filename, SaveState& state,
+                                  unsigned int sections) const {
+    SaveView view;
+    if (!view.open(savePath + "/" + filename + ".dat") || !view.load(state, sections)) {
+        return false;
+    }
+    view.close();
 
-    std::string info = std::string(data.playerName) + " - Level " +
-                       std::to_string(data.level) + " - " + timeBuffer;
-    return info;
+    if (state.journalGeneration != 0) {
+        MappedFile journal;
+        if (journal.open(savePath + "/" + filename + ".jnl")) {
+            replayJournal(journal.getData(), journal.getSize(), state);
+        }
+    }
+    return true;
 }
 
 // Quick save/load
 bool SaveLoadManager::quickSave(Player* player, Inventory* inventory,
-                                AbilityTree* abilities, GridMap* map, int turnCount) {
-    return saveGame("quicksave", player, inventory, abilities, map, turnCount);
+                                AbilityTree* abilities, GridMap* map, EventLog* events,
+                                const SessionStats& stats) {
+    bool queued = journalSave(quickJournal, player, inventory, abilities, map, events, stats);
+    if (queued) {
+        std::cout << "[SaveLoad] Quick save queued." << std::endl;
+    }
+    return queued;
 }
 
 bool SaveLoadManager::quickLoad(Player* player, Inventory* inventory,
-                                AbilityTree* abilities, GridMap* map, int& turnCount) {
-    return loadGame("quicksave", player, inventory, abilities, map, turnCount);
+                                AbilityTree* abilities, GridMap* map, EventLog* events,
+                                SessionStats& stats, const ItemDatabase* items) {
+    return loadGame("quicksave", player, inventory, abilities, map, events, stats, items);
+}
+
+// JOURNAL SAVE: Full base the first time, then only what changed
+// (a background write that failed since the last save drops the base first)
+// Step 1: No base this session - capture everything, queue base + empty journal
+// Step 2: Otherwise capture (inventory only if modified, only the new events)
+//         and queue a delta record for appending
+// Step 3: Every COMPACT_AFTER records, queue a compaction into a new base
+bool SaveLoadManager::journalSave(SaveJournal* journal, Player* player, Inventory* inventory,
+                                  AbilityTree* abilities, GridMap* map, EventLog* events,
+                                  const SessionStats& stats) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    if (!initialized || player == nullptr) {
+        return false;
+    }
+    if (autoSaveWriter == nullptr) {
+        autoSaveWriter = new AutoSaveWriter();
+    }
+    reportAutoSaveFailures();
+
+    std::string basePath = savePath + "/" + journal->getSlot() + ".dat";
+    std::string journalPath = savePath + "/" + journal->getSlot() + ".jnl";
+    int modCount = inventory != nullptr ? inventory->getModCount() : 0;
+    SaveState state;
+
+    if (!journal->hasBaseSnapshot()) {
+        // Step 1
+        captureState(state, player, inventory, abilities, map, events, stats, SECTION_ALL, 0);
+        std::string bytes;
+        std::string header;
+        journal->buildBase(state, modCount, bytes, header);
+        saveIndex->recordSave(journal->getSlot(), state, bytes);
+        autoSaveWriter->submit(basePath, bytes);
+        autoSaveWriter->submit(journalPath, header);
+    } else {
+        // Step 2
+        unsigned int sections = SECTION_ALL;
+        if (!journal->inventoryChanged(modCount)) {
+            sections &= ~SECTION_INVENTORY;
+        }
+        captureState(state, player, inventory, abilities, map, events, stats, sections,
+                     journal->getEventsWritten());
+        std::string record;
+        if (journal->buildDelta(state, modCount, record)) {
+            saveIndex->recordInfo(journal->getSlot(), state);
+            autoSaveWriter->submitAppend(journalPath, record);
+
+            // Step 3
+            if (journal->needsCompaction()) {
+                autoSaveWriter->submitCompact(basePath, journalPath, journal->beginCompaction());
+            }
+        }
+    }
+    return true;
 }
 
-// Auto-save
+// Helper: Report background failures once, on the game thread
+// The journals already advanced their fingerprints past the lost write, so
+// later deltas would skip its changes: drop both bases (the writer does not
+// say which slot failed), so the next save of each slot is a full base
+void SaveLoadManager::reportAutoSaveFailures() {
+    int failures = autoSaveWriter->getFailedCount();
+    if (failures > reportedAutoSaveFailures) {
+        std::cout << "[SaveLoad] Warning: background save failed, next save is a full save."
+                  << std::endl;
+        reportedAutoSaveFailures = failures;
+        quickJournal->reset();
+        autoJournal->reset();
+    }
+}
+
+// AUTO-SAVE: Snapshot on the game thread, write on the writer thread
+// Step 1: Capture and encode the changes (usually a few dozen bytes)
+// Step 2: Hand the buffer to the writer and return without touching disk
 bool SaveLoadManager::autoSave(Player* player, Inventory* inventory,
-                               AbilityTree* abilities, GridMap* map, int turnCount) {
-    std::cout << "[SaveLoad] Auto-saving..." << std::endl;
-    return saveGame("autosave", player, inventory, abilities, map, turnCount);
+                               AbilityTree* abilities, GridMap* map, EventLog* events,
+                               const SessionStats& stats) {
+    return journalSave(autoJournal, player, inventory, abilities, map, events, stats);
+}
+
+// Wait for the background writer (no-op if auto-save never ran)
+void SaveLoadManager::flushAutoSave() {
+    if (autoSaveWriter != nullptr) {
+        autoSaveWriter->flush();
+    }
 }
 
+// New session: the journals' fingerprints belong to another game state
+void SaveLoadManager::beginSession() {
+    quickJournal->reset();
+    autoJournal->reset();
+}
+
+// Compression
+void SaveLoadManager::setCompression(bool enabled) { compressSaves = enabled; }
+bool SaveLoadManager::isCompressionEnabled() const { return compressSaves; }
+
 // Getters
 std::string SaveLoadManager::getSavePath() const { return savePath; }
 bool SaveLoadManager::isInitialized() const { return initialized; }
 
-// List saves (simplified)
+// LIST SAVES: Every slot in the save directory, most recent first
+// Step 1: Let queued background saves land, so the scan sees them
+// Step 2: Reconcile the index with the directory (only changed files are read)
+// Step 3: Insertion-sort the slot names by save time
 std::string* SaveLoadManager::listSaves(int& outCount) const {
-    // Return common save names
-    std::string* saves = new std::string[5];
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
     outCount = 0;
+    if (!initialized) {
+        return nullptr;
+    }
+
+    // Step 1
+    if (autoSaveWriter != nullptr) {
+        autoSaveWriter->flush();
+    }
+
+    // Step 2
+    saveIndex->refresh();
+    int count = saveIndex->getCount();
+    if (count == 0) {
+        return nullptr;
+    }
 
-    const char* saveNames[] = {"save1", "save2", "save3", "quicksave", "autosave"};
-    for (int i = 0; i < 5; i++) {
-        if (saveExists(saveNames[i])) {
-            saves[outCount++] = saveNames[i];
+    // Step 3
+    int* order = new int[count];
+    for (int i = 0; i < count; i++) {
+        int j = i;
+        long long time = saveIndex->getEntry(i).saveTime;
+        while (j > 0 && saveIndex->getEntry(order[j - 1]).saveTime < time) {
+            order[j] = order[j - 1];
+            j--;
         }
+        order[j] = i;
+    }
+
+    std::string* saves = new std::string[count];
+    for (int i = 0; i < count; i++) {
+        saves[i] = saveIndex->getEntry(order[i]).slot;
     }
+    delete[] order;
 
+    outCount = count;
     return saves;
 }
 
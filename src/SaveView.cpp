@@ -0,0 +1,317 @@
+/*******************************************************************************
+ * SaveView.cpp - Memory-Mapped Save File Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/SaveView.h"
+#include "../include/SaveFormat.h"
+#include "../include/SaveLoad.h"
+#include "../include/AutoSave.h"
+#include "../include/MemoryTracker.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*******************************************************************************
+ * MAPPED FILE
+ ******************************************************************************/
+
+// Smaller files are read into the buffer (mapping costs more than it saves)
+static const std::size_t MAP_MIN_SIZE = 64 * 1024;
+
+MappedFile::MappedFile() : data(nullptr), size(0), mapped(false) {
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+
+// Windows: file -> mapping object -> view (the view keeps both alive)
+bool MappedFile::open(const std::string& path) {
+    close();
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(handle, &length)) {
+        CloseHandle(handle);
+        return false;
+    }
+    if (length.QuadPart >= static_cast<LONGLONG>(MAP_MIN_SIZE)) {
+        HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (view != nullptr) {
+                data = static_cast<const unsigned char*>(view);
+                size = static_cast<std::size_t>(length.QuadPart);
+                mapped = true;
+            }
+        }
+    }
+    CloseHandle(handle);
+
+    if (!mapped) {
+        if (!readFileBytes(path, buffer)) return false;
+        data = reinterpret_cast<const unsigned char*>(buffer.data());
+        size = buffer.size();
+    }
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapped) {
+        UnmapViewOfFile(data);
+    }
+    buffer.clear();
+    data = nullptr;
+    size = 0;
+    mapped = false;
+}
+
+#else
+
+// POSIX: mmap the whole file private + read-only, the descriptor can go at once
+// (small files are read instead - one read() beats setting up a mapping)
+bool MappedFile::open(const std::string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return false;
+    }
+    std::size_t length = static_cast<std::size_t>(st.st_size);
+    if (length >= MAP_MIN_SIZE) {
+        void* view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view != MAP_FAILED) {
+            data = static_cast<const unsigned char*>(view);
+            size = length;
+            mapped = true;
+        }
+    }
+
+    if (!mapped) {
+        buffer.resize(length);
+        std::size_t offset = 0;
+        while (offset < length) {
+            ssize_t count = read(fd, &buffer[offset], length - offset);
+            if (count <= 0) break;
+            offset += static_cast<std::size_t>(count);
+        }
+        buffer.resize(offset);
+        data = reinterpret_cast<const unsigned char*>(buffer.data());
+        size = buffer.size();
+    }
+    ::close(fd);
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapped) {
+        munmap(const_cast<unsigned char*>(data), size);
+    }
+    buffer.clear();
+    data = nullptr;
+    size = 0;
+    mapped = false;
+}
+
+#endif
+
+const unsigned char* MappedFile::getData() const { return data; }
+std::size_t MappedFile::getSize() const { return size; }
+bool MappedFile::isMapped() const { return mapped; }
+
+/*******************************************************************************
+ * SAVE VIEW
+ ******************************************************************************/
+
+SaveView::SaveView()
+    : version(0), bodyOffset(0), chunks(nullptr), chunkCount(0), chunkCapacity(0),
+      indexed(false), ended(false), blockOffset(0) {
+}
+
+SaveView::~SaveView() {
+    delete[] chunks;
+}
+
+// OPEN: Map, then read only the magic and the version varint
+bool SaveView::open(const std::string& path) {
+    close();
+    if (!file.open(path)) return false;
+
+    const unsigned char* data = file.getData();
+    std::size_t size = file.getSize();
+    if (size >= 7 && memcmp(data, "DEXODUS", 7) == 0) {
+        version = LEGACY_SAVE_VERSION;      // Whole struct (1 or 2), decoded by decodeSave
+        return true;
+    }
+    if (size < sizeof(SAVE_MAGIC) || memcmp(data, SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0) {
+        close();
+        return false;
+    }
+
+    SaveReader reader(data + sizeof(SAVE_MAGIC), size - sizeof(SAVE_MAGIC));
+    unsigned long long fileVersion = reader.readVarint();
+    if (reader.failed() || fileVersion <= static_cast<unsigned long long>(LEGACY_SAVE_VERSION) ||
+        fileVersion > static_cast<unsigned long long>(SAVE_VERSION)) {
+        close();
+        return false;
+    }
+    version = static_cast<int>(fileVersion);
+    bodyOffset = sizeof(SAVE_MAGIC) + reader.getPosition();
+    return true;
+}
+
+void SaveView::close() {
+    file.close();
+    delete[] chunks;
+    chunks = nullptr;
+    chunkCount = 0;
+    chunkCapacity = 0;
+    version = 0;
+    bodyOffset = 0;
+    indexed = false;
+    ended = false;
+    blockOffset = 0;
+}
+
+// Helper: Chunk headers only - the payloads are stepped over, not touched
+bool SaveView::buildDirectory() {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    if (indexed) return ended || blockOffset != 0;
+    indexed = true;
+
+    SaveReader reader(file.getData() + bodyOffset, file.getSize() - bodyOffset);
+    reader.setChecksummed(version >= FIRST_CHECKSUM_VERSION);
+    unsigned int tag = 0;
+    SaveReader payload;
+    while (true) {
+        std::size_t start = reader.getPosition();
+        if (!reader.nextChunk(tag, payload, false)) return false;  // Truncated
+        if (tag == CHUNK_END) {
+            ended = true;
+            return true;
+        }
+        if (tag == CHUNK_BLOCK) {
+            blockOffset = bodyOffset + start;  // Rest is the block stream
+            return true;
+        }
+
+        if (chunkCount == chunkCapacity) {
+            chunkCapacity = chunkCapacity > 0 ? chunkCapacity * 2 : 16;
+            SaveChunkRef* grown = new SaveChunkRef[chunkCapacity];
+            for (int i = 0; i < chunkCount; i++) {
+                grown[i] = chunks[i];
+            }
+            delete[] chunks;
+            chunks = grown;
+        }
+        chunks[chunkCount].tag = tag;
+        chunks[chunkCount].start = bodyOffset + start;
+        chunks[chunkCount].offset = static_cast<std::size_t>(payload.peek() - file.getData());
+        chunks[chunkCount].length = payload.remaining();
+        chunkCount++;
+    }
+}
+
+// INFO: Writers always put it first, so this never looks further
+bool SaveView::readInfo(SaveState& state) const {
+    if (version == 0) return false;
+    if (version == LEGACY_SAVE_VERSION) {
+        return decodeSave(file.getData(), file.getSize(), state, true);
+    }
+
+    SaveReader reader(file.getData() + bodyOffset, file.getSize() - bodyOffset);
+    reader.setChecksummed(version >= FIRST_CHECKSUM_VERSION);
+    unsigned int tag = 0;
+    SaveReader payload;
+    if (!reader.nextChunk(tag, payload) || tag != CHUNK_INFO) return false;
+    state.version = version;
+    return decodeSection(payload, tag, state);
+}
+
+// LOAD: Decode only what was asked for
+bool SaveView::load(SaveState& state, unsigned int sections) {
+    MEM_SCOPE(MemSubsystem::SAVE_LOAD);
+    if (version == 0) return false;
+    state.sections = sections;
+    if (version == LEGACY_SAVE_VERSION) {
+        return decodeSave(file.getData(), file.getSize(), state);
+    }
+
+    // Step 1
+    if (!buildDirectory()) return false;
+    state.version = version;
+
+    // Step 2 (each chunk's CRC is checked just before it is decoded)
+    bool checksummed = version >= FIRST_CHECKSUM_VERSION;
+    for (int i = 0; i < chunkCount; i++) {
+        const SaveChunkRef& chunk = chunks[i];
+        unsigned int section = chunkSection(chunk.tag);
+        if (section != 0 && (sections & section) == 0) continue;
+        if (checksummed && !chunkChecksumMatches(file.getData() + chunk.start,
+                                                 chunk.offset + chunk.length - chunk.start)) {
+            return false;
+        }
+        SaveReader payload(file.getData() + chunk.offset, chunk.length);
+        if (!decodeSection(payload, chunk.tag, state)) return false;
+    }
+
+    // Step 3 (blocks hold body sections only)
+    if (blockOffset != 0 && (sections & SECTION_ALL) != 0) {
+        SaveReader reader(file.getData() + blockOffset, file.getSize() - blockOffset);
+        reader.setChecksummed(checksummed);
+        return decodeChunks(reader, state);
+    }
+    return true;
+}
+
+// Payload in place: the returned bytes are the mapping itself
+const unsigned char* SaveView::findChunk(unsigned int tag, std::size_t& length) {
+    length = 0;
+    if (version <= LEGACY_SAVE_VERSION || !buildDirectory()) return nullptr;
+    for (int i = 0; i < chunkCount; i++) {
+        const SaveChunkRef& chunk = chunks[i];
+        if (chunk.tag != tag) continue;
+        if (version >= FIRST_CHECKSUM_VERSION &&
+            !chunkChecksumMatches(file.getData() + chunk.start,
+                                  chunk.offset + chunk.length - chunk.start)) {
+            return nullptr;
+        }
+        length = chunk.length;
+        return file.getData() + chunk.offset;
+    }
+    return nullptr;
+}
+
+// VERIFY: Every chunk CRC, without decoding
+SaveIntegrity SaveView::verify() const {
+    if (version == 0) return SaveIntegrity::INVALID;
+    return verifySave(file.getData(), file.getSize());
+}
+
+// Access
+int SaveView::getVersion() const { return version; }
+
+bool SaveView::isCompressed() {
+    return buildDirectory() && blockOffset != 0;
+}
+
+const unsigned char* SaveView::getData() const { return file.getData(); }
+std::size_t SaveView::getSize() const { return file.getSize(); }
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * SentinelPool.cpp - Slab Allocator Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/SentinelPool.h"
+#include "../include/Entity.h"
+#include "../include/MemoryTracker.h"
+#include <new>
+
+// Helper: Round size up to a multiple of the strictest fundamental alignment
+static std::size_t alignUp(std::size_t size) {
+    const std::size_t align = alignof(std::max_align_t);
+    return (size + align - 1) / align * align;
+}
+
+// Constructor
+SentinelPool::SentinelPool()
+    : blockSize(alignUp(sizeof(Sentinel))), headerSize(alignUp(sizeof(void*))),
+      slabs(nullptr), freeList(nullptr), freeCount(0), liveCount(0), slabCount(0) {
+}
+
+// Singleton access
+SentinelPool& SentinelPool::getInstance() {
+    static SentinelPool instance;
+    return instance;
+}
+
+// Destructor - slabs are only freed when nothing still points into them
+SentinelPool::~SentinelPool() {
+    if (liveCount > 0) return;
+
+    while (slabs != nullptr) {
+        void* next = *static_cast<void**>(slabs);
+        ::operator delete(slabs);
+        slabs = next;
+    }
+}
+
+// ADD SLAB: One allocation, then thread every block onto the free list
+// Step 1: Allocate header + blocks and link the slab in
+// Step 2: Push blocks in reverse so the lowest address is handed out first
+void SentinelPool::addSlab(int blockCount) {
+    MEM_SCOPE(MemSubsystem::ENTITY);
+
+    // Step 1
+    char* slab = static_cast<char*>(::operator new(headerSize + blockSize * blockCount));
+    *reinterpret_cast<void**>(slab) = slabs;
+    slabs = slab;
+    slabCount++;
+
+    // Step 2
+    char* blocks = slab + headerSize;
+    for (int i = blockCount - 1; i >= 0; i--) {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(blocks + blockSize * i);
+        block->next = freeList;
+        freeList = block;
+    }
+    freeCount += blockCount;
+}
+
+// ALLOCATE: Pop the free list (new slab if empty)
+void* SentinelPool::allocate() {
+    if (freeList == nullptr) {
+        addSlab(BLOCKS_PER_SLAB);
+    }
+
+    FreeBlock* block = freeList;
+    freeList = block->next;
+    freeCount--;
+    liveCount++;
+    return block;
+}
+
+// RELEASE: Push back onto the free list
+void SentinelPool::release(void* block) {
+    if (block == nullptr) return;
+
+    FreeBlock* freed = static_cast<FreeBlock*>(block);
+    freed->next = freeList;
+    freeList = freed;
+    freeCount++;
+    liveCount--;
+}
+
+// RESERVE: Top up the free list in one slab
+void SentinelPool::reserve(int count) {
+    int missing = count - freeCount;
+    if (missing <= 0) return;
+    addSlab(missing > BLOCKS_PER_SLAB ? missing : BLOCKS_PER_SLAB);
+}
+
+// Statistics
+std::size_t SentinelPool::getBlockSize() const { return blockSize; }
+int SentinelPool::getLiveCount() const { return liveCount; }
+int SentinelPool::getFreeCount() const { return freeCount; }
+int SentinelPool::getSlabCount() const { return slabCount; }
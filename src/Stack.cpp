@@ -8,6 +8,7 @@
  ******************************************************************************/
 
 #include "../include/Stack.h"
+#include "../include/MemoryTracker.h"
 
 /*******************************************************************************
  * ACTION STRUCTURE IMPLEMENTATION
@@ -29,6 +30,7 @@ Action::Action(const std::string& type, const std::string& desc, int val, bool s
 
 ActionStack::ActionStack(int maxTokens)
     : maxRevertTokens(maxTokens), revertTokens(maxTokens) {
+    MEM_SCOPE(MemSubsystem::HACKING);
     stack = new Stack<Action>();
 }
 
@@ -38,6 +40,7 @@ ActionStack::~ActionStack() {
 
 // Push action onto stack
 void ActionStack::pushAction(const Action& action) {
+    MEM_SCOPE(MemSubsystem::HACKING);
     stack->push(action);
     std::cout << "[ActionStack] Action recorded: " << action.description << std::endl;
 }
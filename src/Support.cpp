@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Support.cpp - Awakened Ally Support Engine Implementation
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/Support.h"
+#include "../include/MemoryTracker.h"
+#include <cstdlib>
+
+// Constructor
+SupportEngine::SupportEngine()
+    : party(nullptr), partySlots(nullptr), partyCount(0),
+      enemies(nullptr), enemySlots(nullptr), enemyCount(0),
+      mostInjured(-1), weakestEnemy(-1),
+      pendingHeal(nullptr), partyHeal(0), pendingAttackBonus(0), pendingEnemyPenalty(0),
+      attackBonus(0), enemyAttackPenalty(0) {
+}
+
+// Destructor
+SupportEngine::~SupportEngine() {
+    release();
+}
+
+// Helper: Free the encounter arrays
+void SupportEngine::release() {
+    delete[] party;
+    delete[] partySlots;
+    delete[] enemies;
+    delete[] enemySlots;
+    delete[] pendingHeal;
+    party = nullptr;
+    partySlots = nullptr;
+    enemies = nullptr;
+    enemySlots = nullptr;
+    pendingHeal = nullptr;
+    partyCount = 0;
+    enemyCount = 0;
+}
+
+// BEGIN: Copy the party / enemy lists and take the first summary
+void SupportEngine::begin(Entity* player, Entity** allies, int allyCount,
+                          Entity** enemyList, int enemyListCount) {
+    MEM_SCOPE(MemSubsystem::COMBAT);
+    release();
+
+    partyCount = 1 + allyCount;
+    party = new Entity*[partyCount];
+    partySlots = new int[partyCount];
+    pendingHeal = new int[partyCount];
+    party[0] = player;
+    for (int i = 0; i < allyCount; i++) {
+        party[i + 1] = allies[i];
+    }
+    for (int i = 0; i < partyCount; i++) {
+        partySlots[i] = party[i]->getSlot();
+        pendingHeal[i] = 0;
+    }
+
+    enemyCount = enemyListCount;
+    enemies = new Entity*[enemyCount];
+    enemySlots = new int[enemyCount];
+    for (int i = 0; i < enemyCount; i++) {
+        enemies[i] = enemyList[i];
+        enemySlots[i] = enemyList[i]->getSlot();
+    }
+
+    partyHeal = 0;
+    pendingAttackBonus = 0;
+    pendingEnemyPenalty = 0;
+    attackBonus = 0;
+    enemyAttackPenalty = 0;
+    summarize();
+}
+
+// END: Forget the encounter (unapplied support is lost)
+void SupportEngine::end() {
+    release();
+    mostInjured = -1;
+    weakestEnemy = -1;
+    partyHeal = 0;
+    pendingAttackBonus = 0;
+    pendingEnemyPenalty = 0;
+    attackBonus = 0;
+    enemyAttackPenalty = 0;
+}
+
+// SUMMARIZE: One pass over the party, one over the enemies
+void SupportEngine::summarize() {
+    const EntityStore& store = EntityStore::getInstance();
+
+    // Lowest health ratio below 75% (compare health_a * max_b cross-wise)
+    mostInjured = -1;
+    for (int i = 0; i < partyCount; i++) {
+        int slot = partySlots[i];
+        if (!store.isAlive(slot)) continue;
+
+        int health = store.health(slot);
+        int maxHealth = store.maxHealth(slot);
+        if (health * 4 >= maxHealth * 3) continue;
+
+        if (mostInjured < 0) {
+            mostInjured = i;
+        } else {
+            int best = partySlots[mostInjured];
+            if (health * store.maxHealth(best) < store.health(best) * maxHealth) {
+                mostInjured = i;
+            }
+        }
+    }
+
+    summarizeEnemies();
+}
+
+// Helper: Weakest living enemy
+void SupportEngine::summarizeEnemies() {
+    const EntityStore& store = EntityStore::getInstance();
+
+    weakestEnemy = -1;
+    for (int i = 0; i < enemyCount; i++) {
+        int slot = enemySlots[i];
+        if (!store.isAlive(slot)) continue;
+        if (weakestEnemy < 0 || store.health(slot) < store.health(enemySlots[weakestEnemy])) {
+            weakestEnemy = i;
+        }
+    }
+}
+
+// ACT: One ally turn, decided from the round summary
+// Step 1: Loyalty check (low loyalty may hesitate)
+// Step 2: Specialty action - queue heals / buffs, WARRIOR strikes now
+void SupportEngine::act(Awakened& ally) {
+    if (!ally.getHasJoined() || party == nullptr) return;
+
+    // Step 1
+    int loyalty = ally.getLoyalty();
+    if (rand() % 100 >= loyalty + 40) {
+        std::cout << ally.getName() << " hesitates, unsure of the cause." << std::endl;
+        return;
+    }
+    int effectiveness = (loyalty / 10) + 1;  // 1-11 based on loyalty
+
+    // Step 2
+    switch (ally.getSpecialty()) {
+        case Awakened::Specialty::HEALER:
+            if (mostInjured >= 0) {
+                pendingHeal[mostInjured] += 10 + effectiveness;
+                std::cout << ally.getName() << " routes a repair stream to "
+                          << party[mostInjured]->getName() << "." << std::endl;
+            } else {
+                partyHeal += effectiveness / 2 + 1;
+                std::cout << ally.getName() << " spreads a light regeneration field." << std::endl;
+            }
+            break;
+
+        case Awakened::Specialty::WARRIOR:
+            if (weakestEnemy >= 0) {
+                Entity* target = enemies[weakestEnemy];
+                std::cout << ally.getName() << " strikes " << target->getName() << "!" << std::endl;
+                target->takeDamage(ally.getAttackPower() + effectiveness);
+                if (!target->isAlive()) {
+                    summarizeEnemies();
+                }
+            }
+            break;
+
+        case Awakened::Specialty::HACKER:
+            pendingEnemyPenalty += effectiveness / 3 + 1;
+            std::cout << ally.getName() << " scrambles Sentinel targeting routines." << std::endl;
+            break;
+
+        case Awakened::Specialty::SCOUT:
+            pendingAttackBonus += effectiveness / 3 + 1;
+            std::cout << ally.getName() << " marks enemy weak points." << std::endl;
+            break;
+    }
+}
+
+// FLUSH: Apply the round's batch in one pass, then re-summarize
+void SupportEngine::flush() {
+    for (int i = 0; i < partyCount; i++) {
+        int amount = pendingHeal[i] + partyHeal;
+        pendingHeal[i] = 0;
+        if (amount > 0 && party[i]->isAlive()) {
+            party[i]->heal(amount);
+        }
+    }
+    partyHeal = 0;
+
+    if (pendingAttackBonus > 0) {
+        attackBonus += pendingAttackBonus;
+        if (attackBonus > MAX_BONUS) attackBonus = MAX_BONUS;
+        std::cout << "[Support] Party attack bonus: +" << attackBonus << std::endl;
+    }
+    if (pendingEnemyPenalty > 0) {
+        enemyAttackPenalty += pendingEnemyPenalty;
+        if (enemyAttackPenalty > MAX_BONUS) enemyAttackPenalty = MAX_BONUS;
+        std::cout << "[Support] Sentinel attack reduced by " << enemyAttackPenalty << std::endl;
+    }
+    pendingAttackBonus = 0;
+    pendingEnemyPenalty = 0;
+
+    summarize();
+}
+
+// Active effects
+int SupportEngine::getAttackBonus() const { return attackBonus; }
+int SupportEngine::getEnemyAttackPenalty() const { return enemyAttackPenalty; }
@@ -8,6 +8,8 @@
  ******************************************************************************/
 
 #include "../include/Tree.h"
+#include "../include/MemoryTracker.h"
+#include <cstring>
 
 /*******************************************************************************
  * ABILITY STRUCTURE IMPLEMENTATION
@@ -15,25 +17,170 @@
 
 Ability::Ability()
     : code(""), name(""), description(""), type(Type::COMBAT),
-    cost(0), power(0), unlocked(false) {
+    cost(0), power(0), multiTarget(false) {
 }
 
 Ability::Ability(const std::string& code, const std::string& name,
-                 const std::string& desc, Type type, int cost, int power)
+                 const std::string& desc, Type type, int cost, int power,
+                 bool multiTarget)
     : code(code), name(name), description(desc), type(type),
-      cost(cost), power(power), unlocked(false) {
+      cost(cost), power(power), multiTarget(multiTarget) {
 }
 
 /*******************************************************************************
  * ABILITY NODE IMPLEMENTATION
  ******************************************************************************/
 
-AbilityNode::AbilityNode(const Ability& ability)
-    : ability(ability), left(nullptr), right(nullptr), parent(nullptr) {
+AbilityNode::AbilityNode()
+    : ability(), left(-1), right(-1), parent(-1), depth(0), codeHash(0),
+      firstPrereq(-1), firstDependent(-1) {
 }
 
-AbilityNode::~AbilityNode() {
-    // Node deletion is handled by tree destructor
+AbilityNode::AbilityNode(const Ability& ability, int parent, int depth, unsigned int codeHash)
+    : ability(ability), left(-1), right(-1), parent(parent), depth(depth), codeHash(codeHash),
+      firstPrereq(-1), firstDependent(-1) {
+}
+
+/*******************************************************************************
+ * ABILITY PROGRESS IMPLEMENTATION
+ ******************************************************************************/
+
+// Helper: Set bits in one word
+static inline int countBits(unsigned long long word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    while (word != 0) {
+        word &= word - 1;       // Clear lowest set bit
+        count++;
+    }
+    return count;
+#endif
+}
+
+AbilityProgress::AbilityProgress()
+    : unlockedBits(nullptr), unmetPrereqs(nullptr), eligible(nullptr),
+      capacity(0), wordCount(0), unlockedCount(0), skillPoints(0),
+      eligibleCount(0), availableCount(0) {
+}
+
+AbilityProgress::~AbilityProgress() {
+    delete[] unlockedBits;
+    delete[] unmetPrereqs;
+    delete[] eligible;
+}
+
+// Copy: allocate the same capacity, then memcpy each array
+AbilityProgress::AbilityProgress(const AbilityProgress& other)
+    : unlockedBits(nullptr), unmetPrereqs(nullptr), eligible(nullptr),
+      capacity(0), wordCount(0), unlockedCount(0), skillPoints(0),
+      eligibleCount(0), availableCount(0) {
+    *this = other;
+}
+
+AbilityProgress& AbilityProgress::operator=(const AbilityProgress& other) {
+    if (this == &other) return *this;
+
+    // Reuse the arrays when the sizes already match (repeated clones)
+    if (capacity != other.capacity) {
+        MEM_SCOPE(MemSubsystem::ABILITIES);
+        delete[] unlockedBits;
+        delete[] unmetPrereqs;
+        delete[] eligible;
+
+        capacity = other.capacity;
+        wordCount = other.wordCount;
+        unlockedBits = capacity > 0 ? new unsigned long long[wordCount] : nullptr;
+        unmetPrereqs = capacity > 0 ? new int[capacity] : nullptr;
+        eligible = capacity > 0 ? new int[capacity] : nullptr;
+    }
+
+    if (capacity > 0) {
+        std::memcpy(unlockedBits, other.unlockedBits, sizeof(unsigned long long) * wordCount);
+        std::memcpy(unmetPrereqs, other.unmetPrereqs, sizeof(int) * capacity);
+        std::memcpy(eligible, other.eligible, sizeof(int) * capacity);
+    }
+
+    unlockedCount = other.unlockedCount;
+    skillPoints = other.skillPoints;
+    eligibleCount = other.eligibleCount;
+    availableCount = other.availableCount;
+    return *this;
+}
+
+int AbilityProgress::wordsFor(int capacity) {
+    return (capacity + BITS_PER_WORD - 1) / BITS_PER_WORD;
+}
+
+bool AbilityProgress::isUnlocked(int index) const {
+    if (index < 0 || index >= capacity) return false;
+    return (unlockedBits[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1ULL;
+}
+
+void AbilityProgress::setUnlocked(int index) {
+    if (index < 0 || index >= capacity) return;
+    unlockedBits[index / BITS_PER_WORD] |= 1ULL << (index % BITS_PER_WORD);
+}
+
+// RESIZE: Grow every array to newCapacity, new slots zeroed
+void AbilityProgress::resize(int newCapacity) {
+    if (newCapacity <= capacity) return;
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+
+    int newWords = wordsFor(newCapacity);
+    unsigned long long* grownBits = new unsigned long long[newWords]();
+    int* grownUnmet = new int[newCapacity]();
+    int* grownEligible = new int[newCapacity];
+
+    if (capacity > 0) {
+        std::memcpy(grownBits, unlockedBits, sizeof(unsigned long long) * wordCount);
+        std::memcpy(grownUnmet, unmetPrereqs, sizeof(int) * capacity);
+        std::memcpy(grownEligible, eligible, sizeof(int) * eligibleCount);
+    }
+
+    delete[] unlockedBits;
+    delete[] unmetPrereqs;
+    delete[] eligible;
+    unlockedBits = grownBits;
+    unmetPrereqs = grownUnmet;
+    eligible = grownEligible;
+    capacity = newCapacity;
+    wordCount = newWords;
+}
+
+// RESET: Nothing unlocked, no bookkeeping; skill points are kept
+void AbilityProgress::reset(int newCapacity) {
+    delete[] unlockedBits;
+    delete[] unmetPrereqs;
+    delete[] eligible;
+    unlockedBits = nullptr;
+    unmetPrereqs = nullptr;
+    eligible = nullptr;
+    capacity = 0;
+    wordCount = 0;
+    unlockedCount = 0;
+    eligibleCount = 0;
+    availableCount = 0;
+
+    resize(newCapacity);
+}
+
+// DIFF COUNT: popcount(a XOR b), words missing on one side count as zero
+int AbilityProgress::diffCount(const AbilityProgress& other) const {
+    int common = wordCount < other.wordCount ? wordCount : other.wordCount;
+    int count = 0;
+
+    for (int i = 0; i < common; i++) {
+        count += countBits(unlockedBits[i] ^ other.unlockedBits[i]);
+    }
+    for (int i = common; i < wordCount; i++) {
+        count += countBits(unlockedBits[i]);
+    }
+    for (int i = common; i < other.wordCount; i++) {
+        count += countBits(other.unlockedBits[i]);
+    }
+    return count;
 }
 
 /*******************************************************************************
@@ -45,214 +192,579 @@ AbilityNode::~AbilityNode() {
  *           [Time Dilation]    [Code Shield]
  *              /      \           /        \
  *        [Overdrive] [Stealth] [Firewall] [Regen]
+ *
+ * Flattened (insertion order):
+ *   index:  0      1       2      3       4       5       6
+ *   node:  BASIC  TIME   SHIELD  OVER  STEALTH  FIREW  REGEN
+ *   parent: -1     0       0      1       1       2       2
  ******************************************************************************/
 
 // Constructor
 AbilityTree::AbilityTree()
-    : root(nullptr), totalAbilities(0), unlockedCount(0), skillPoints(0) {
+    : nodes(nullptr), capacity(0), totalAbilities(0),
+      codeIndex(nullptr), codeCapacity(0), preorder(nullptr), preorderDirty(false),
+      edgeNode(nullptr), edgeNext(nullptr), edgeCount(0), edgeCapacity(0), progress() {
 }
 
 // Destructor
 AbilityTree::~AbilityTree() {
-    deleteTree(root);
+    delete[] nodes;
+    delete[] codeIndex;
+    delete[] preorder;
+    delete[] edgeNode;
+    delete[] edgeNext;
 }
 
-// Helper: Recursively delete tree
-void AbilityTree::deleteTree(AbilityNode* node) {
-    if (node == nullptr) return;
+// Helper: Drop all abilities (keeps skill points)
+void AbilityTree::clear() {
+    delete[] nodes;
+    delete[] codeIndex;
+    delete[] preorder;
+    delete[] edgeNode;
+    delete[] edgeNext;
+
+    nodes = nullptr;
+    codeIndex = nullptr;
+    preorder = nullptr;
+    edgeNode = nullptr;
+    edgeNext = nullptr;
+    capacity = 0;
+    codeCapacity = 0;
+    edgeCount = 0;
+    edgeCapacity = 0;
+    totalAbilities = 0;
+    preorderDirty = false;
+
+    progress.reset(0);
+}
 
-    deleteTree(node->left);
-    deleteTree(node->right);
-    delete node;
+// HASH: djb2 over the ability code (same function as the item HashTable)
+unsigned int AbilityTree::hashCode(const std::string& code) {
+    unsigned int hash = 5381;
+    for (size_t i = 0; i < code.length(); i++) {
+        hash = ((hash << 5) + hash) + static_cast<unsigned int>(code[i]);
+    }
+    return hash;
 }
 
-// Set root ability (always unlocked)
-void AbilityTree::setRoot(const Ability& ability) {
-    if (root != nullptr) {
-        deleteTree(root);
+// FIND INDEX: Probe the code index (linear probing)
+// Step 1: Start at hash & (capacity - 1)
+// Step 2: Stop at an empty slot (not present)
+// Step 3: Compare hash first, then the string
+int AbilityTree::findIndex(const std::string& code) const {
+    if (codeCapacity == 0) return -1;
+
+    unsigned int hash = hashCode(code);
+    unsigned int mask = static_cast<unsigned int>(codeCapacity - 1);
+
+    // Step 1: Home slot
+    for (unsigned int slot = hash & mask; ; slot = (slot + 1) & mask) {
+        int index = codeIndex[slot];
+
+        // Step 2: Empty slot ends the probe
+        if (index < 0) return -1;
+
+        // Step 3: Match
+        if (nodes[index].codeHash == hash && nodes[index].ability.code == code) {
+            return index;
+        }
     }
+}
 
-    root = new AbilityNode(ability);
-    root->ability.unlocked = true;  // Root is always unlocked
-    totalAbilities = 1;
-    unlockedCount = 1;
+// Helper: Double node storage (and the owned progress alongside)
+void AbilityTree::growNodes() {
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+    int newCapacity = capacity == 0 ? 8 : capacity * 2;
+    AbilityNode* grown = new AbilityNode[newCapacity];
 
-    std::cout << "[AbilityTree] Root set: " << ability.name << std::endl;
+    for (int i = 0; i < totalAbilities; i++) {
+        grown[i] = nodes[i];
+    }
+
+    delete[] nodes;
+    nodes = grown;
+    capacity = newCapacity;
+
+    progress.resize(newCapacity);
 }
 
-// Helper: Find node by code (recursive search)
-AbilityNode* AbilityTree::findNode(AbilityNode* node, const std::string& code) const {
-    if (node == nullptr) return nullptr;
+// Helper: Double the edge pool
+void AbilityTree::growEdges() {
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+    int newCapacity = edgeCapacity == 0 ? 16 : edgeCapacity * 2;
+    int* grownNode = new int[newCapacity];
+    int* grownNext = new int[newCapacity];
+
+    for (int i = 0; i < edgeCount; i++) {
+        grownNode[i] = edgeNode[i];
+        grownNext[i] = edgeNext[i];
+    }
+
+    delete[] edgeNode;
+    delete[] edgeNext;
+    edgeNode = grownNode;
+    edgeNext = grownNext;
+    edgeCapacity = newCapacity;
+}
 
-    // Check current node
-    if (node->ability.code == code) {
-        return node;
+// ADD EDGE: Record "prereqIndex must be unlocked before index"
+// Step 1: Push prereqIndex onto index's prerequisite list
+// Step 2: Push index onto prereqIndex's dependent list
+// Step 3: Count it as unmet while the prerequisite is locked (owned progress)
+void AbilityTree::addEdge(int prereqIndex, int index) {
+    if (edgeCount + 2 > edgeCapacity) {
+        growEdges();
     }
 
-    // Search left subtree
-    AbilityNode* found = findNode(node->left, code);
-    if (found != nullptr) return found;
+    // Step 1: Prerequisite list
+    edgeNode[edgeCount] = prereqIndex;
+    edgeNext[edgeCount] = nodes[index].firstPrereq;
+    nodes[index].firstPrereq = edgeCount++;
+
+    // Step 2: Dependent list
+    edgeNode[edgeCount] = index;
+    edgeNext[edgeCount] = nodes[prereqIndex].firstDependent;
+    nodes[prereqIndex].firstDependent = edgeCount++;
+
+    // Step 3: Unmet count
+    if (!progress.isUnlocked(prereqIndex)) {
+        progress.unmetPrereqs[index]++;
+    }
+}
+
+// Helper: Is prereqIndex already a direct prerequisite of index?
+bool AbilityTree::hasPrerequisite(int index, int prereqIndex) const {
+    for (int e = nodes[index].firstPrereq; e >= 0; e = edgeNext[e]) {
+        if (edgeNode[e] == prereqIndex) return true;
+    }
+    return false;
+}
+
+// DEPENDS ON: Can prereqIndex be reached from index along prerequisite edges?
+// Iterative DFS with an explicit stack; each node is pushed at most once
+bool AbilityTree::dependsOn(int index, int prereqIndex) const {
+    bool* visited = new bool[totalAbilities];
+    int* stack = new int[totalAbilities];
+    for (int i = 0; i < totalAbilities; i++) {
+        visited[i] = false;
+    }
+
+    int top = 0;
+    bool found = false;
+    stack[top++] = index;
+    visited[index] = true;
+
+    while (top > 0 && !found) {
+        int current = stack[--top];
+        if (current == prereqIndex) {
+            found = true;
+            break;
+        }
+
+        for (int e = nodes[current].firstPrereq; e >= 0; e = edgeNext[e]) {
+            if (!visited[edgeNode[e]]) {
+                visited[edgeNode[e]] = true;
+                stack[top++] = edgeNode[e];
+            }
+        }
+    }
+
+    delete[] visited;
+    delete[] stack;
+    return found;
+}
+
+// Helper: A locked prerequisite of index, or -1
+int AbilityTree::firstUnmetPrerequisite(const AbilityProgress& state, int index) const {
+    for (int e = nodes[index].firstPrereq; e >= 0; e = edgeNext[e]) {
+        if (!state.isUnlocked(edgeNode[e])) return edgeNode[e];
+    }
+    return -1;
+}
+
+// ELIGIBLE SLOT: Binary search for index's position in eligible[]
+// Ordered by (cost, node index), so ties keep insertion order
+int AbilityTree::eligibleSlot(const AbilityProgress& state, int index) const {
+    int cost = nodes[index].ability.cost;
+    int low = 0;
+    int high = state.eligibleCount;
+
+    while (low < high) {
+        int mid = (low + high) / 2;
+        const Ability& other = nodes[state.eligible[mid]].ability;
+        if (other.cost < cost || (other.cost == cost && state.eligible[mid] < index)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// Helper: Insert index into eligible[], keeping it sorted
+// An affordable entry always lands inside the available prefix
+void AbilityTree::makeEligible(AbilityProgress& state, int index) const {
+    int slot = eligibleSlot(state, index);
+    for (int i = state.eligibleCount; i > slot; i--) {
+        state.eligible[i] = state.eligible[i - 1];
+    }
+    state.eligible[slot] = index;
+    state.eligibleCount++;
+
+    if (nodes[index].ability.cost <= state.skillPoints) {
+        state.availableCount++;
+    }
+}
+
+// Helper: Remove index from eligible[]
+void AbilityTree::removeEligible(AbilityProgress& state, int index) const {
+    int slot = eligibleSlot(state, index);
+    if (slot >= state.eligibleCount || state.eligible[slot] != index) return;
+
+    for (int i = slot; i < state.eligibleCount - 1; i++) {
+        state.eligible[i] = state.eligible[i + 1];
+    }
+    state.eligibleCount--;
+
+    if (slot < state.availableCount) {
+        state.availableCount--;
+    }
+}
+
+// Helper: Move the available boundary after skillPoints changed
+// Only the entries whose affordability flipped are touched
+void AbilityTree::updateAvailable(AbilityProgress& state) const {
+    while (state.availableCount > 0 &&
+           nodes[state.eligible[state.availableCount - 1]].ability.cost > state.skillPoints) {
+        state.availableCount--;
+    }
+    while (state.availableCount < state.eligibleCount &&
+           nodes[state.eligible[state.availableCount]].ability.cost <= state.skillPoints) {
+        state.availableCount++;
+    }
+}
+
+// Helper: Double the code index and re-insert every node
+void AbilityTree::growCodeIndex() {
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+    delete[] codeIndex;
+
+    codeCapacity = codeCapacity == 0 ? 16 : codeCapacity * 2;
+    codeIndex = new int[codeCapacity];
+    for (int i = 0; i < codeCapacity; i++) {
+        codeIndex[i] = -1;
+    }
+
+    for (int i = 0; i < totalAbilities; i++) {
+        indexCode(i);
+    }
+}
+
+// Helper: Place a node's index in its hash slot
+void AbilityTree::indexCode(int nodeIndex) {
+    unsigned int mask = static_cast<unsigned int>(codeCapacity - 1);
+    unsigned int slot = nodes[nodeIndex].codeHash & mask;
+
+    while (codeIndex[slot] >= 0) {
+        slot = (slot + 1) & mask;
+    }
+    codeIndex[slot] = nodeIndex;
+}
+
+// Helper: Append a node, keeping the code index at most half full
+int AbilityTree::addNode(const Ability& ability, int parent, int depth) {
+    if (totalAbilities == capacity) {
+        growNodes();
+    }
+
+    int index = totalAbilities++;
+    nodes[index] = AbilityNode(ability, parent, depth, hashCode(ability.code));
+
+    if (totalAbilities * 2 > codeCapacity) {
+        growCodeIndex();            // Re-indexes every node, including this one
+    } else {
+        indexCode(index);
+    }
+
+    preorderDirty = true;
+    return index;
+}
+
+// Set root ability (always unlocked)
+void AbilityTree::setRoot(const Ability& ability) {
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+    clear();
+
+    int index = addNode(ability, -1, 0);
+    progress.setUnlocked(index);    // Root is always unlocked
+    progress.unlockedCount = 1;
 
-    // Search right subtree
-    return findNode(node->right, code);
+    std::cout << "[AbilityTree] Root set: " << ability.name << std::endl;
 }
 
 // INSERT: Add ability as child of parent
-// Step 1: Find parent node by code
-// Step 2: Create new AbilityNode
+// Step 1: Look up parent index by code
+// Step 2: Append a new node to the array
 // Step 3: Attach as left or right child
-// Step 4: Set parent pointer
+// Step 4: Record parent index and code hash
 // Step 5: Increment total count
 bool AbilityTree::insert(const Ability& ability, const std::string& parentCode, bool asLeftChild) {
+    MEM_SCOPE(MemSubsystem::ABILITIES);
     // Step 1: Find parent
-    AbilityNode* parentNode = findNode(root, parentCode);
-    if (parentNode == nullptr) {
+    int parentIndex = findIndex(parentCode);
+    if (parentIndex < 0) {
         std::cout << "[AbilityTree] Parent not found: " << parentCode << std::endl;
         return false;
     }
 
-    // Step 2: Create new node
-    AbilityNode* newNode = new AbilityNode(ability);
+    if (findIndex(ability.code) >= 0) {
+        std::cout << "[AbilityTree] Duplicate ability code: " << ability.code << std::endl;
+        return false;
+    }
 
-    // Step 3 & 4: Attach to parent
-    newNode->parent = parentNode;
+    // Step 3: Child slot must be free
+    int& slot = asLeftChild ? nodes[parentIndex].left : nodes[parentIndex].right;
+    if (slot >= 0) {
+        std::cout << "[AbilityTree] " << (asLeftChild ? "Left" : "Right")
+                  << " child already exists!" << std::endl;
+        return false;
+    }
 
+    // Step 2, 4 & 5: Append (may grow the array, so re-read the parent after)
+    int index = addNode(ability, parentIndex, nodes[parentIndex].depth + 1);
     if (asLeftChild) {
-        if (parentNode->left != nullptr) {
-            std::cout << "[AbilityTree] Left child already exists!" << std::endl;
-            delete newNode;
-            return false;
-        }
-        parentNode->left = newNode;
+        nodes[parentIndex].left = index;
     } else {
-        if (parentNode->right != nullptr) {
-            std::cout << "[AbilityTree] Right child already exists!" << std::endl;
-            delete newNode;
-            return false;
-        }
-        parentNode->right = newNode;
+        nodes[parentIndex].right = index;
     }
 
-    // Step 5: Increment count
-    totalAbilities++;
+    // The tree parent is the first prerequisite
+    addEdge(parentIndex, index);
+    if (progress.unmetPrereqs[index] == 0) {
+        makeEligible(progress, index);
+    }
 
     std::cout << "[AbilityTree] Added: " << ability.name << " under " << parentCode << std::endl;
     return true;
 }
 
+// ADD PREREQUISITE: Require prereqCode before code can be unlocked
+// Step 1: Look up both abilities
+// Step 2: Reject duplicates and edges that would form a cycle
+// Step 3: Link the edge, count it as unmet if prereq is locked
+bool AbilityTree::addPrerequisite(const std::string& code, const std::string& prereqCode) {
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+    // Step 1: Find both
+    int index = findIndex(code);
+    int prereqIndex = findIndex(prereqCode);
+    if (index < 0 || prereqIndex < 0) {
+        std::cout << "[AbilityTree] Ability not found: "
+                  << (index < 0 ? code : prereqCode) << std::endl;
+        return false;
+    }
+
+    // Step 2: Validate
+    if (progress.isUnlocked(index)) {
+        std::cout << "[AbilityTree] Already unlocked: " << code << std::endl;
+        return false;
+    }
+    if (hasPrerequisite(index, prereqIndex)) {
+        std::cout << "[AbilityTree] " << code << " already requires " << prereqCode << std::endl;
+        return false;
+    }
+    if (index == prereqIndex || dependsOn(prereqIndex, index)) {
+        std::cout << "[AbilityTree] Prerequisite would form a cycle: "
+                  << prereqCode << " -> " << code << std::endl;
+        return false;
+    }
+
+    // Step 3: Link (a newly unmet prerequisite takes the node out of eligible[])
+    bool wasEligible = progress.unmetPrereqs[index] == 0;
+    addEdge(prereqIndex, index);
+    if (wasEligible && progress.unmetPrereqs[index] > 0) {
+        removeEligible(progress, index);
+    }
+
+    std::cout << "[AbilityTree] " << nodes[index].ability.name << " now requires "
+              << nodes[prereqIndex].ability.name << std::endl;
+    return true;
+}
+
 // FIND: Locate ability by code
 Ability* AbilityTree::findAbility(const std::string& code) const {
-    AbilityNode* node = findNode(root, code);
-    if (node != nullptr) {
-        return &(node->ability);
+    int index = findIndex(code);
+    if (index >= 0) {
+        return &(nodes[index].ability);
     }
     return nullptr;
 }
 
-// CAN UNLOCK: Check if ability can be unlocked
-// Step 1: Find the ability node
-// Step 2: Check if parent is unlocked (or is root)
-// Step 3: Check if player has enough skill points
-// Step 4: Check if not already unlocked
-bool AbilityTree::canUnlock(const std::string& code) const {
-    // Step 1: Find the node
-    AbilityNode* node = findNode(root, code);
-    if (node == nullptr) return false;
+// CAN UNLOCK (index): Unlock rules against any player's progress
+bool AbilityTree::canUnlock(const AbilityProgress& state, int index) const {
+    // Step 1: The node must exist in this tree and in the progress
+    if (index < 0 || index >= totalAbilities || state.capacity < totalAbilities) {
+        return false;
+    }
 
     // Step 4: Check if already unlocked
-    if (node->ability.unlocked) {
+    if (state.isUnlocked(index)) {
         return false;
     }
 
-    // Step 2: Check parent (root has no parent, always OK)
-    if (node->parent != nullptr && !node->parent->ability.unlocked) {
-        return false;  // Parent not unlocked
+    // Step 2: Check prerequisites (root has none, always OK)
+    if (state.unmetPrereqs[index] > 0) {
+        return false;
     }
 
     // Step 3: Check skill points
-    if (skillPoints < node->ability.cost) {
-        return false;  // Not enough points
-    }
+    return state.skillPoints >= nodes[index].ability.cost;
+}
 
-    return true;
+// CAN UNLOCK: Check if ability can be unlocked
+// Step 1: Find the ability node
+// Step 2: Check that no prerequisite is still locked
+// Step 3: Check if player has enough skill points
+// Step 4: Check if not already unlocked
+bool AbilityTree::canUnlock(const std::string& code) const {
+    // Step 1: Find the node
+    int index = findIndex(code);
+    if (index < 0) return false;
+
+    // Steps 2-4
+    return canUnlock(progress, index);
 }
 
-// UNLOCK: Attempt to unlock an ability
-// Step 1: Verify canUnlock returns true
+// UNLOCK (index): Silent unlock against any player's progress
+// Step 1: Verify the node can be unlocked
 // Step 2: Deduct skill points
-// Step 3: Mark ability as unlocked
+// Step 3: Set the node's bit
 // Step 4: Increment unlocked count
-bool AbilityTree::unlock(const std::string& code) {
-    // Step 1: Check if can unlock
-    if (!canUnlock(code)) {
-        AbilityNode* node = findNode(root, code);
-        if (node == nullptr) {
-            std::cout << "Ability not found: " << code << std::endl;
-        } else if (node->ability.unlocked) {
-            std::cout << "Ability already unlocked: " << node->ability.name << std::endl;
-        } else if (node->parent != nullptr && !node->parent->ability.unlocked) {
-            std::cout << "Must unlock prerequisite first: " << node->parent->ability.name << std::endl;
-        } else {
-            std::cout << "Not enough skill points! Need: " << node->ability.cost
-                      << ", Have: " << skillPoints << std::endl;
-        }
+// Step 5: Release dependents whose last prerequisite this was
+bool AbilityTree::unlock(AbilityProgress& state, int index) const {
+    // Step 1: Check
+    if (!canUnlock(state, index)) {
         return false;
     }
 
-    // Find the node
-    AbilityNode* node = findNode(root, code);
-
     // Step 2: Deduct points
-    skillPoints -= node->ability.cost;
+    state.skillPoints -= nodes[index].ability.cost;
 
     // Step 3: Mark as unlocked
-    node->ability.unlocked = true;
+    removeEligible(state, index);
+    state.setUnlocked(index);
 
     // Step 4: Increment count
-    unlockedCount++;
+    state.unlockedCount++;
 
-    std::cout << "\n*** ABILITY UNLOCKED ***" << std::endl;
-    std::cout << node->ability.name << ": " << node->ability.description << std::endl;
-    std::cout << "Remaining skill points: " << skillPoints << std::endl;
+    // Step 5: Dependents
+    for (int e = nodes[index].firstDependent; e >= 0; e = edgeNext[e]) {
+        int dependent = edgeNode[e];
+        if (--state.unmetPrereqs[dependent] == 0 && !state.isUnlocked(dependent)) {
+            makeEligible(state, dependent);
+        }
+    }
+    updateAvailable(state);
 
     return true;
 }
 
-// Helper: Display node with indentation
-void AbilityTree::displayNode(AbilityNode* node, int depth) const {
-    if (node == nullptr) return;
+// UNLOCK: Attempt to unlock an ability for the current player
+bool AbilityTree::unlock(const std::string& code) {
+    int index = findIndex(code);
 
-    // Print indentation
-    for (int i = 0; i < depth; i++) {
-        std::cout << "  ";
+    if (index < 0) {
+        std::cout << "Ability not found: " << code << std::endl;
+        return false;
     }
 
-    // Print node info
-    std::cout << (node->ability.unlocked ? "[X] " : "[ ] ");
-    std::cout << node->ability.name;
-    std::cout << " (Cost: " << node->ability.cost << ", Power: " << node->ability.power << ")";
+    const Ability& ability = nodes[index].ability;
+    if (!unlock(progress, index)) {
+        if (progress.isUnlocked(index)) {
+            std::cout << "Ability already unlocked: " << ability.name << std::endl;
+        } else if (progress.unmetPrereqs[index] > 0) {
+            std::cout << "Must unlock prerequisite first: "
+                      << nodes[firstUnmetPrerequisite(progress, index)].ability.name << std::endl;
+        } else {
+            std::cout << "Not enough skill points! Need: " << ability.cost
+                      << ", Have: " << progress.skillPoints << std::endl;
+        }
+        return false;
+    }
 
-    if (!node->ability.unlocked && canUnlock(node->ability.code)) {
-        std::cout << " <-- CAN UNLOCK";
+    std::cout << "\n*** ABILITY UNLOCKED ***" << std::endl;
+    std::cout << ability.name << ": " << ability.description << std::endl;
+    std::cout << "Remaining skill points: " << progress.skillPoints << std::endl;
+
+    return true;
+}
+
+// REBUILD PREORDER: Iterative DFS with an explicit index stack
+// Step 1: Push the root
+// Step 2: Pop a node, emit it, push right then left (left is visited first)
+void AbilityTree::rebuildPreorder() const {
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+    delete[] preorder;
+    preorder = new int[totalAbilities > 0 ? totalAbilities : 1];
+    preorderDirty = false;
+
+    if (totalAbilities == 0) return;
+
+    int* stack = new int[totalAbilities];
+    int top = 0;
+    int emitted = 0;
+
+    // Step 1: Root
+    stack[top++] = 0;
+
+    // Step 2: Walk
+    while (top > 0) {
+        int index = stack[--top];
+        preorder[emitted++] = index;
+
+        if (nodes[index].right >= 0) stack[top++] = nodes[index].right;
+        if (nodes[index].left >= 0) stack[top++] = nodes[index].left;
     }
-    std::cout << std::endl;
 
-    // Recursively display children
-    displayNode(node->left, depth + 1);
-    displayNode(node->right, depth + 1);
+    delete[] stack;
 }
 
-// Display entire tree
+// Display entire tree (pre-order scan, indentation from depth)
 void AbilityTree::displayTree() const {
     std::cout << "\n=== ABILITY TREE ===" << std::endl;
-    std::cout << "Skill Points: " << skillPoints << std::endl;
-    std::cout << "Unlocked: " << unlockedCount << "/" << totalAbilities << std::endl;
+    std::cout << "Skill Points: " << progress.skillPoints << std::endl;
+    std::cout << "Unlocked: " << progress.unlockedCount << "/" << totalAbilities << std::endl;
     std::cout << "-------------------" << std::endl;
 
-    if (root == nullptr) {
+    if (totalAbilities == 0) {
         std::cout << "No abilities available." << std::endl;
     } else {
-        displayNode(root, 0);
+        if (preorderDirty) rebuildPreorder();
+
+        for (int i = 0; i < totalAbilities; i++) {
+            const AbilityNode& node = nodes[preorder[i]];
+
+            // Print indentation
+            for (int d = 0; d < node.depth; d++) {
+                std::cout << "  ";
+            }
+
+            // Print node info
+            std::cout << (progress.isUnlocked(preorder[i]) ? "[X] " : "[ ] ");
+            std::cout << node.ability.name;
+            std::cout << " (Cost: " << node.ability.cost << ", Power: " << node.ability.power << ")";
+
+            // Prerequisites beyond the tree parent
+            for (int e = node.firstPrereq; e >= 0; e = edgeNext[e]) {
+                if (edgeNode[e] != node.parent) {
+                    std::cout << " +" << nodes[edgeNode[e]].ability.name;
+                }
+            }
+
+            if (canUnlock(progress, preorder[i])) {
+                std::cout << " <-- CAN UNLOCK";
+            }
+            std::cout << std::endl;
+        }
     }
 
     std::cout << "===================" << std::endl;
@@ -261,7 +773,7 @@ void AbilityTree::displayTree() const {
 // Display available abilities (can be unlocked now)
 void AbilityTree::displayAvailable() const {
     std::cout << "\n=== AVAILABLE ABILITIES ===" << std::endl;
-    std::cout << "Skill Points: " << skillPoints << std::endl;
+    std::cout << "Skill Points: " << progress.skillPoints << std::endl;
 
     int count = 0;
     Ability** available = getAvailableAbilities(count);
@@ -302,64 +814,165 @@ void AbilityTree::displayUnlocked() const {
 
 // Skill point management
 void AbilityTree::addSkillPoints(int points) {
-    skillPoints += points;
-    std::cout << "Gained " << points << " skill points! Total: " << skillPoints << std::endl;
+    addSkillPoints(progress, points);
+    std::cout << "Gained " << points << " skill points! Total: " << progress.skillPoints << std::endl;
 }
 
-int AbilityTree::getSkillPoints() const { return skillPoints; }
+void AbilityTree::addSkillPoints(AbilityProgress& state, int points) const {
+    state.skillPoints += points;
+    updateAvailable(state);
+}
+
+int AbilityTree::getSkillPoints() const { return progress.skillPoints; }
 
 // Getters
 int AbilityTree::getTotalAbilities() const { return totalAbilities; }
-int AbilityTree::getUnlockedCount() const { return unlockedCount; }
-AbilityNode* AbilityTree::getRoot() const { return root; }
-
-// Helper: Collect unlocked abilities
-void AbilityTree::collectUnlocked(AbilityNode* node, Ability** arr, int& index) const {
-    if (node == nullptr) return;
+int AbilityTree::getUnlockedCount() const { return progress.unlockedCount; }
+AbilityNode* AbilityTree::getRoot() const { return totalAbilities > 0 ? &nodes[0] : nullptr; }
 
-    if (node->ability.unlocked) {
-        arr[index++] = &(node->ability);
-    }
-
-    collectUnlocked(node->left, arr, index);
-    collectUnlocked(node->right, arr, index);
+const AbilityNode* AbilityTree::getNode(int index) const {
+    if (index < 0 || index >= totalAbilities) return nullptr;
+    return &nodes[index];
 }
 
-// Helper: Collect available abilities
-void AbilityTree::collectAvailable(AbilityNode* node, Ability** arr, int& index) const {
-    if (node == nullptr) return;
-
-    if (canUnlock(node->ability.code)) {
-        arr[index++] = &(node->ability);
-    }
+int AbilityTree::getIndex(const std::string& code) const { return findIndex(code); }
 
-    collectAvailable(node->left, arr, index);
-    collectAvailable(node->right, arr, index);
-}
-
-// Get arrays of abilities
+// Get arrays of abilities (linear pre-order scans)
 Ability** AbilityTree::getUnlockedAbilities(int& outCount) const {
-    Ability** arr = new Ability*[totalAbilities];
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+    if (preorderDirty) rebuildPreorder();
+
+    Ability** arr = new Ability*[totalAbilities > 0 ? totalAbilities : 1];
     outCount = 0;
-    collectUnlocked(root, arr, outCount);
+    for (int i = 0; i < totalAbilities; i++) {
+        if (progress.isUnlocked(preorder[i])) {
+            arr[outCount++] = &(nodes[preorder[i]].ability);
+        }
+    }
     return arr;
 }
 
+// Available abilities are the affordable prefix of eligible[] - no tree walk
 Ability** AbilityTree::getAvailableAbilities(int& outCount) const {
-    Ability** arr = new Ability*[totalAbilities];
-    outCount = 0;
-    collectAvailable(root, arr, outCount);
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+    Ability** arr = new Ability*[progress.availableCount > 0 ? progress.availableCount : 1];
+    outCount = progress.availableCount;
+    for (int i = 0; i < progress.availableCount; i++) {
+        arr[i] = &(nodes[progress.eligible[i]].ability);
+    }
     return arr;
 }
 
+int AbilityTree::getAvailableCount() const { return progress.availableCount; }
+
 // Check if ability is unlocked
 bool AbilityTree::isUnlocked(const std::string& code) const {
-    AbilityNode* node = findNode(root, code);
-    return (node != nullptr && node->ability.unlocked);
+    int index = findIndex(code);
+    return (index >= 0 && progress.isUnlocked(index));
+}
+
+/*******************************************************************************
+ * PER-PLAYER STATE
+ ******************************************************************************/
+
+// CREATE PROGRESS: Fresh state for this tree (root unlocked, no points)
+AbilityProgress* AbilityTree::createProgress() const {
+    MEM_SCOPE(MemSubsystem::ABILITIES);
+    AbilityProgress* state = new AbilityProgress();
+    state->reset(capacity);
+    if (totalAbilities > 0) {
+        state->setUnlocked(0);
+    }
+    recompute(*state);
+    return state;
+}
+
+// RECOMPUTE: Rebuild counts and eligible[] from the unlocked bits
+// Step 1: Count unlocked abilities
+// Step 2: Count each node's locked prerequisites
+// Step 3: Collect locked nodes with none left
+void AbilityTree::recompute(AbilityProgress& state) const {
+    state.resize(capacity);
+    state.unlockedCount = 0;
+    state.eligibleCount = 0;
+    state.availableCount = 0;
+
+    for (int i = 0; i < totalAbilities; i++) {
+        // Step 1: Unlocked
+        if (state.isUnlocked(i)) {
+            state.unlockedCount++;
+        }
+
+        // Step 2: Unmet prerequisites
+        state.unmetPrereqs[i] = 0;
+        for (int e = nodes[i].firstPrereq; e >= 0; e = edgeNext[e]) {
+            if (!state.isUnlocked(edgeNode[e])) {
+                state.unmetPrereqs[i]++;
+            }
+        }
+    }
+
+    // Step 3: Eligible
+    for (int i = 0; i < totalAbilities; i++) {
+        if (!state.isUnlocked(i) && state.unmetPrereqs[i] == 0) {
+            makeEligible(state, i);
+        }
+    }
+}
+
+const AbilityProgress& AbilityTree::getProgress() const { return progress; }
+
+// SET PROGRESS: Adopt a build (e.g. the winner of a simulation)
+void AbilityTree::setProgress(const AbilityProgress& state) {
+    progress = state;
+    progress.resize(capacity);
+}
+
+// RESTORE UNLOCKED: Load saved bitset words and skill points
+// Bits past the last ability are ignored; the root is always unlocked
+void AbilityTree::restoreUnlocked(const unsigned long long* bits, int words, int points) {
+    progress.reset(capacity);
+    progress.skillPoints = points;
+
+    for (int i = 0; i < totalAbilities; i++) {
+        int word = i / AbilityProgress::BITS_PER_WORD;
+        if (word < words && ((bits[word] >> (i % AbilityProgress::BITS_PER_WORD)) & 1ULL)) {
+            progress.setUnlocked(i);
+        }
+    }
+    if (totalAbilities > 0) {
+        progress.setUnlocked(0);
+    }
+
+    recompute(progress);
+}
+
+// RESTORE UNLOCKED: Same, from ability codes (original saves)
+// Returns how many codes were not found in the tree (they are skipped)
+int AbilityTree::restoreUnlocked(const std::string* codes, int count, int points) {
+    progress.reset(capacity);
+    progress.skillPoints = points;
+
+    int missing = 0;
+    for (int i = 0; i < count; i++) {
+        int index = findIndex(codes[i]);
+        if (index < 0) {
+            missing++;
+            continue;
+        }
+        progress.setUnlocked(index);
+    }
+    if (totalAbilities > 0) {
+        progress.setUnlocked(0);
+    }
+
+    recompute(progress);
+    return missing;
 }
 
 // Initialize default ability tree
 void AbilityTree::initializeDefaultTree() {
+    MEM_SCOPE(MemSubsystem::ABILITIES);
     // Root ability (always unlocked)
     Ability basicCombat("BASIC_COMBAT", "Basic Combat",
         "Fundamental combat techniques", Ability::Type::COMBAT, 0, 10);
@@ -376,7 +989,7 @@ void AbilityTree::initializeDefaultTree() {
 
     // Level 2 abilities
     Ability overdrive("OVERDRIVE", "Overdrive",
-        "Massive damage boost for one attack", Ability::Type::COMBAT, 3, 30);
+        "Massive damage surge that strikes every enemy", Ability::Type::COMBAT, 3, 30, true);
     insert(overdrive, "TIME_DILATION", true);
 
     Ability stealth("STEALTH_MODE", "Stealth Mode",
@@ -391,5 +1004,11 @@ void AbilityTree::initializeDefaultTree() {
         "Slowly recover health over time", Ability::Type::DEFENSE, 4, 15);
     insert(regen, "CODE_SHIELD", false);
 
+    // Level 3: capstone needing both branches
+    Ability override("SYSTEM_OVERRIDE", "System Override",
+        "Seize control of the Overseer's local node", Ability::Type::HACKING, 5, 40);
+    insert(override, "OVERDRIVE", true);
+    addPrerequisite("SYSTEM_OVERRIDE", "FIREWALL");
+
     std::cout << "[AbilityTree] Default tree initialized." << std::endl;
 }
\ No newline at end of file
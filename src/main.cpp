@@ -50,6 +50,8 @@
 #include <ctime>
 
 #include "../include/Game.h"
+#include "../include/Profiler.h"
+#include "../include/MemoryTracker.h"
 
 /*******************************************************************************
  * MAIN FUNCTION
@@ -71,6 +73,17 @@ int main(int argc, char* argv[]) {
     Game game;
     game.run();
 
+#ifdef DEXODUS_PROFILE
+    // Profiling build: summarise the session and keep a trace for inspection
+    Profiler::getInstance().displayReport();
+    Profiler::getInstance().exportChromeTrace("profile_trace.json");
+#endif
+
+#ifdef DEXODUS_MEMPROFILE
+    // Memprofile build: per-subsystem allocation summary for the session
+    MemoryTracker::displayReport();
+#endif
+
     std::cout << "\nDigital Exodus terminated." << std::endl;
 
     return 0;
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * LegacySaveTest.cpp - Original-Release Save Compatibility Test
+ *
+ * Writes a save the way the first release did (one raw SaveDataV1 struct,
+ * version 1, unlocked abilities as code strings) and checks that it still
+ * loads:
+ *
+ *   1. decodeSave() maps every field and keeps the unlock codes
+ *   2. verifySave() accepts it (legacy files carry no checksums)
+ *   3. SaveLoadManager::loadGame() restores the player, the inventory
+ *      (items resolved through the ItemDatabase), the unlocked abilities
+ *      (looked up by code in the default tree) and the turn counters
+ *
+ * Truncated files must be rejected by both.
+ *
+ * Exits with 1 when any check fails, so "make test" fails too.
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/SaveLoad.h"
+#include "../include/SaveFormat.h"
+#include "../include/Entity.h"
+#include "../include/HashTable.h"
+#include "../include/Iterator.h"
+#include "../include/LinkedList.h"
+#include "../include/Tree.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+namespace {
+
+const char* const TEST_DIRECTORY = "test_saves";
+const char* const TEST_SLOT = "legacy_v1";
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        std::cout << "[Test] FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+// Helper: SaveDataV1 as the original saveGame() filled it in
+void buildOriginalSave(SaveDataV1& data) {
+    memset(&data, 0, sizeof(SaveDataV1));
+    memcpy(data.signature, "DEXODUS", 7);
+    data.version = ORIGINAL_SAVE_VERSION;
+    data.saveTime = 1700000000;
+
+    strcpy(data.playerName, "Legacy Runner");
+    data.health = 72;
+    data.maxHealth = 120;
+    data.level = 4;
+    data.experience = 55;
+    data.attackPower = 18;
+    data.defense = 9;
+    data.speed = 11;
+    data.hackingSkill = 6;
+    data.skillPoints = 3;
+    strcpy(data.currentSector, "Central Hub");
+
+    data.inventoryCount = 2;
+    strcpy(data.inventoryCodes[0], "WEAPON_PULSE");
+    data.inventoryQuantities[0] = 1;
+    strcpy(data.inventoryCodes[1], "HEAL_SMALL");
+    data.inventoryQuantities[1] = 4;
+
+    data.unlockedAbilityCount = 3;
+    strcpy(data.unlockedAbilities[0], "BASIC_COMBAT");
+    strcpy(data.unlockedAbilities[1], "TIME_DILATION");
+    strcpy(data.unlockedAbilities[2], "OVERDRIVE");
+
+    data.turnCount = 310;
+    data.sectorsVisited = 5;
+    data.enemiesDefeated = 12;
+    data.eventsTriggered = 27;
+}
+
+// Step 1 + 2: Decode and verify the raw bytes
+void testDecode(const SaveDataV1& data) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&data);
+    SaveState state;
+    check(decodeSave(bytes, sizeof(SaveDataV1), state), "version 1 save decodes");
+    check(state.version == ORIGINAL_SAVE_VERSION, "version is 1");
+    check(state.playerName == "Legacy Runner", "player name");
+    check(state.health == 72 && state.maxHealth == 120, "health");
+    check(state.level == 4 && state.experience == 55, "level and experience");
+    check(state.attackPower == 18 && state.defense == 9 && state.speed == 11 &&
+          state.hackingSkill == 6, "player stats");
+    check(state.skillPoints == 3, "skill points");
+    check(state.currentSector == "Central Hub", "current sector");
+    check(state.inventoryCount == 2 && state.inventoryCodes[0] == "WEAPON_PULSE" &&
+          state.inventoryQuantities[1] == 4, "inventory codes and quantities");
+    check(state.unlockedCodeCount == 3 && state.unlockedCodes[2] == "OVERDRIVE",
+          "unlocked ability codes");
+    check(state.turnCount == 310 && state.sectorsExplored == 5 &&
+          state.enemiesDefeated == 12 && state.eventsTriggered == 27, "turn counters");
+
+    check(verifySave(bytes, sizeof(SaveDataV1)) == SaveIntegrity::UNCHECKED,
+          "version 1 save verifies as unchecked");
+    SaveState truncated;
+    check(!decodeSave(bytes, sizeof(SaveDataV1) - 1, truncated), "truncated save is rejected");
+}
+
+// Helper: Write bytes as the slot's save file
+std::string writeSave(const SaveDataV1& data, std::size_t size) {
+#ifdef _WIN32
+    _mkdir(TEST_DIRECTORY);
+#else
+    mkdir(TEST_DIRECTORY, 0755);
+#endif
+    std::string path = std::string(TEST_DIRECTORY) + "/" + TEST_SLOT + ".dat";
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&data), static_cast<std::streamsize>(size));
+    return path;
+}
+
+// Step 3: Load the file into game objects
+void testLoadGame(const SaveDataV1& data) {
+    std::string path = writeSave(data, sizeof(SaveDataV1));
+    SaveLoadManager& manager = SaveLoadManager::getInstance();
+    manager.initialize(TEST_DIRECTORY);
+
+    ItemDatabase items;
+    items.initializeDefaultItems();
+    Inventory inventory;
+    AbilityTree abilities;
+    abilities.initializeDefaultTree();
+    Player player("Placeholder");
+    SessionStats stats;
+
+    bool loaded = manager.loadGame(TEST_SLOT, &player, &inventory, &abilities,
+                                   nullptr, nullptr, stats, &items);
+    check(loaded, "loadGame accepts the version 1 file");
+    check(player.getName() == "Legacy Runner", "restored player name");
+    check(player.getHealth() == 72 && player.getLevel() == 4, "restored health and level");
+    check(player.getAttackPower() == 18, "restored attack power");
+    check(inventory.getItemCount() == 2 && inventory.hasItem("HEAL_SMALL"),
+          "restored inventory");
+    check(abilities.isUnlocked("TIME_DILATION") && abilities.isUnlocked("OVERDRIVE"),
+          "restored unlocks by code");
+    check(!abilities.isUnlocked("CODE_SHIELD"), "unlisted ability stays locked");
+    check(abilities.getSkillPoints() == 3, "restored skill points");
+    check(stats.turnCount == 310 && stats.enemiesDefeated == 12, "restored turn counters");
+
+    // Cut inside the ability codes: not a whole version 1 save
+    writeSave(data, sizeof(SaveDataV1) - 100);
+    AbilityTree fresh;
+    fresh.initializeDefaultTree();
+    check(!manager.loadGame(TEST_SLOT, &player, &inventory, &fresh, nullptr, nullptr, stats,
+                            &items),
+          "truncated save is rejected");
+
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+int main() {
+    SaveDataV1 data;
+    buildOriginalSave(data);
+    testDecode(data);
+    testLoadGame(data);
+
+    if (failures > 0) {
+        std::cout << "[Test] " << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "[Test] Legacy save tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,519 @@
+/*******************************************************************************
+ * BuildOptimizer.cpp - Ability Build Search Tool
+ *
+ * Finds, for every skill-point budget, the set of abilities that gives the
+ * most combat power, and an unlock order that reaches it under the normal
+ * AbilityTree rules (prerequisites first, one ability at a time).
+ *
+ * Search:
+ * - States are AbilityProgress snapshots cloned from one shared tree, so
+ *   the order in which abilities were unlocked never matters - only the
+ *   resulting set. A sharded memo keyed by the unlocked bitset makes every
+ *   set be expanded once, however many orders lead to it.
+ * - Branch-and-bound: a state is expanded only if unlocking everything it
+ *   could still afford might beat the best build found at its cost.
+ * - Each worker thread owns a deque of states; it works depth-first from
+ *   its own end and steals from the other end of a victim's deque when
+ *   empty.
+ *
+ * Scoring is a headless, deterministic combat model built from each
+ * ability's power and type (see evaluateBuild). The best score per budget
+ * does not depend on the thread count; when several builds tie, which one
+ * is listed can.
+ *
+ * Command line:
+ *   --budget=N      Highest budget to report (default: cost of every ability)
+ *   --threads=N     Worker threads (default: hardware concurrency)
+ *   --synthetic=N   Search a generated N-ability tree instead of the default
+ *   --seed=N        Seed for --synthetic (default 1)
+ *
+ * Author: Digital Exodus Project
+ * Course: COS30008 Data Structures and Patterns
+ ******************************************************************************/
+
+#include "../include/Tree.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+/*******************************************************************************
+ * HEADLESS COMBAT MODEL
+ *
+ * The player (base Player stats) fights an endless line of Elite Sentinels
+ * using the game's damage rule (attack - defense / 2, minimum 1). Each
+ * ability adds to one stat according to its type:
+ * - COMBAT:  +power / 2 attack
+ * - DEFENSE: +power / 2 defense
+ * - HACKING: enemy attack -power / 4 (disrupted targeting)
+ * - SUPPORT: +power / 5 health regenerated per round
+ * The score is the damage dealt before the player falls (capped rounds).
+ * Every ability only ever helps, so the score never drops when one is
+ * added - the bound below relies on that.
+ ******************************************************************************/
+const int PLAYER_HEALTH = 100;
+const int PLAYER_ATTACK = 15;
+const int PLAYER_DEFENSE = 5;
+
+const int ELITE_ATTACK = 20;
+const int ELITE_DEFENSE = 10;
+
+const int MAX_ROUNDS = 200;
+
+struct CombatStats {
+    int attack;
+    int defense;
+    int regeneration;
+    int enemyAttackCut;
+
+    CombatStats()
+        : attack(PLAYER_ATTACK), defense(PLAYER_DEFENSE),
+          regeneration(0), enemyAttackCut(0) {
+    }
+
+    void add(const Ability& ability) {
+        switch (ability.type) {
+            case Ability::Type::COMBAT:  attack += ability.power / 2; break;
+            case Ability::Type::DEFENSE: defense += ability.power / 2; break;
+            case Ability::Type::HACKING: enemyAttackCut += ability.power / 4; break;
+            case Ability::Type::SUPPORT: regeneration += ability.power / 5; break;
+        }
+    }
+};
+
+// Damage dealt before the player falls
+long long simulateCombat(const CombatStats& stats) {
+    int dealtPerRound = stats.attack - ELITE_DEFENSE / 2;
+    if (dealtPerRound < 1) dealtPerRound = 1;
+
+    int enemyAttack = ELITE_ATTACK - stats.enemyAttackCut;
+    if (enemyAttack < 1) enemyAttack = 1;
+    int takenPerRound = enemyAttack - stats.defense / 2;
+    if (takenPerRound < 1) takenPerRound = 1;
+
+    long long dealt = 0;
+    int health = PLAYER_HEALTH;
+    for (int round = 0; round < MAX_ROUNDS; round++) {
+        dealt += dealtPerRound;
+
+        health -= takenPerRound;
+        if (health <= 0) break;
+
+        health += stats.regeneration;
+        if (health > PLAYER_HEALTH) health = PLAYER_HEALTH;
+    }
+    return dealt;
+}
+
+// Score of the unlocked set in state
+long long evaluateBuild(const AbilityTree& tree, const AbilityProgress& state) {
+    CombatStats stats;
+    for (int i = 0; i < tree.getTotalAbilities(); i++) {
+        if (state.isUnlocked(i)) {
+            stats.add(tree.getNode(i)->ability);
+        }
+    }
+    return simulateCombat(stats);
+}
+
+// Upper bound: as if every still-locked ability costing <= remaining were added
+long long boundBuild(const AbilityTree& tree, const AbilityProgress& state, int remaining) {
+    CombatStats stats;
+    for (int i = 0; i < tree.getTotalAbilities(); i++) {
+        const Ability& ability = tree.getNode(i)->ability;
+        if (state.isUnlocked(i) || ability.cost <= remaining) {
+            stats.add(ability);
+        }
+    }
+    return simulateCombat(stats);
+}
+
+// Memo key: the raw unlocked bitset words
+std::string buildKey(const AbilityProgress& state) {
+    return std::string(reinterpret_cast<const char*>(state.unlockedBits),
+                       sizeof(unsigned long long) * state.wordCount);
+}
+
+/*******************************************************************************
+ * SHARED SEARCH STATE
+ ******************************************************************************/
+
+// One search node: a build and the points spent on it
+struct Task {
+    AbilityProgress state;
+    int spent;
+};
+
+// Memo of expanded builds, sharded so threads rarely contend
+class VisitedSet {
+private:
+    static const int SHARDS = 64;
+    std::unordered_set<std::string> shards[SHARDS];
+    std::mutex locks[SHARDS];
+
+public:
+    // Returns true if key was not seen before
+    bool insert(const std::string& key) {
+        size_t shard = std::hash<std::string>()(key) % SHARDS;
+        std::lock_guard<std::mutex> guard(locks[shard]);
+        return shards[shard].insert(key).second;
+    }
+
+    size_t size() {
+        size_t total = 0;
+        for (int i = 0; i < SHARDS; i++) {
+            std::lock_guard<std::mutex> guard(locks[i]);
+            total += shards[i].size();
+        }
+        return total;
+    }
+};
+
+// Best build per exact cost, plus best score at cost <= b for pruning
+class Frontier {
+private:
+    int maxBudget;
+    std::vector<long long> scoreAtCost;         // -1 = none found
+    std::vector<std::string> buildAtCost;
+    std::unique_ptr<std::atomic<long long>[]> bestUpTo;
+    std::mutex lock;
+
+public:
+    explicit Frontier(int maxBudget)
+        : maxBudget(maxBudget), scoreAtCost(maxBudget + 1, -1),
+          buildAtCost(maxBudget + 1), bestUpTo(new std::atomic<long long>[maxBudget + 1]) {
+        for (int b = 0; b <= maxBudget; b++) {
+            bestUpTo[b].store(-1);
+        }
+    }
+
+    // Record a build; raises bestUpTo for every budget >= cost
+    // (equal scores keep the smaller bitset, so reruns usually agree)
+    void record(int cost, long long score, const std::string& key) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (score < scoreAtCost[cost]) return;
+        if (score == scoreAtCost[cost] && key >= buildAtCost[cost]) return;
+
+        scoreAtCost[cost] = score;
+        buildAtCost[cost] = key;
+        for (int b = cost; b <= maxBudget && bestUpTo[b].load() < score; b++) {
+            bestUpTo[b].store(score);
+        }
+    }
+
+    long long bestWithin(int budget) const { return bestUpTo[budget].load(); }
+    long long scoreAt(int cost) const { return scoreAtCost[cost]; }
+    const std::string& buildAt(int cost) const { return buildAtCost[cost]; }
+};
+
+/*******************************************************************************
+ * WORK-STEALING SCHEDULER
+ ******************************************************************************/
+
+// Per-worker deque: owner uses the back (depth-first), thieves the front
+class WorkQueue {
+private:
+    std::deque<Task*> tasks;
+    std::mutex lock;
+
+public:
+    void push(Task* task) {
+        std::lock_guard<std::mutex> guard(lock);
+        tasks.push_back(task);
+    }
+
+    Task* popBack() {
+        std::lock_guard<std::mutex> guard(lock);
+        if (tasks.empty()) return nullptr;
+        Task* task = tasks.back();
+        tasks.pop_back();
+        return task;
+    }
+
+    Task* stealFront() {
+        std::lock_guard<std::mutex> guard(lock);
+        if (tasks.empty()) return nullptr;
+        Task* task = tasks.front();
+        tasks.pop_front();
+        return task;
+    }
+};
+
+struct SearchStats {
+    std::atomic<long long> expanded;
+    std::atomic<long long> pruned;
+    std::atomic<long long> memoHits;
+    std::atomic<long long> steals;
+
+    SearchStats() : expanded(0), pruned(0), memoHits(0), steals(0) {}
+};
+
+class BuildSearch {
+private:
+    const AbilityTree& tree;
+    int maxBudget;
+    int threadCount;
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::atomic<long long> pending;     // Tasks pushed but not finished
+    VisitedSet visited;
+
+public:
+    Frontier frontier;
+    SearchStats stats;
+
+    BuildSearch(const AbilityTree& tree, int maxBudget, int threadCount)
+        : tree(tree), maxBudget(maxBudget), threadCount(threadCount),
+          pending(0), frontier(maxBudget) {
+        for (int i = 0; i < threadCount; i++) {
+            queues.emplace_back(new WorkQueue());
+        }
+    }
+
+    size_t visitedCount() { return visited.size(); }
+
+    // RUN: Seed with the starting build, then let the workers drain the queues
+    void run() {
+        Task* root = new Task();
+        AbilityProgress* start = tree.createProgress();
+        root->state = *start;
+        root->spent = 0;
+        delete start;
+
+        visited.insert(buildKey(root->state));
+        pending.store(1);
+        queues[0]->push(root);
+
+        std::vector<std::thread> workers;
+        for (int i = 0; i < threadCount; i++) {
+            workers.emplace_back(&BuildSearch::worker, this, i);
+        }
+        for (std::thread& thread : workers) {
+            thread.join();
+        }
+    }
+
+private:
+    // WORKER: pop own work, otherwise steal, stop when nothing is pending
+    void worker(int id) {
+        while (true) {
+            Task* task = queues[id]->popBack();
+
+            for (int offset = 1; task == nullptr && offset < threadCount; offset++) {
+                task = queues[(id + offset) % threadCount]->stealFront();
+                if (task != nullptr) stats.steals++;
+            }
+
+            if (task == nullptr) {
+                if (pending.load() == 0) return;
+                std::this_thread::yield();
+                continue;
+            }
+
+            expand(*task, *queues[id]);
+            delete task;
+            pending--;
+        }
+    }
+
+    // EXPAND: Score a build, then branch on each affordable unlock
+    // Step 1: Record the build on the frontier
+    // Step 2: Bound - stop if nothing reachable can beat the best at this cost
+    // Step 3: Unlock each available ability into a cloned child state
+    // Step 4: Skip children whose ability set was already reached
+    void expand(Task& task, WorkQueue& queue) {
+        stats.expanded++;
+
+        // Step 1: Record
+        long long score = evaluateBuild(tree, task.state);
+        frontier.record(task.spent, score, buildKey(task.state));
+
+        // Step 2: Bound
+        int remaining = maxBudget - task.spent;
+        if (boundBuild(tree, task.state, remaining) <= frontier.bestWithin(task.spent)) {
+            stats.pruned++;
+            return;
+        }
+
+        // Step 3: Branch (skill points = remaining budget, so the available
+        // prefix is exactly the affordable unlocks)
+        tree.addSkillPoints(task.state, remaining - task.state.skillPoints);
+        int options = task.state.availableCount;
+        for (int i = 0; i < options; i++) {
+            Task* child = new Task();
+            child->state = task.state;
+            int index = task.state.eligible[i];
+            tree.unlock(child->state, index);
+            child->spent = task.spent + tree.getNode(index)->ability.cost;
+
+            // Step 4: Memo
+            if (!visited.insert(buildKey(child->state))) {
+                stats.memoHits++;
+                delete child;
+                continue;
+            }
+
+            pending++;
+            queue.push(child);
+        }
+    }
+};
+
+/*******************************************************************************
+ * SETUP AND REPORTING
+ ******************************************************************************/
+
+// xorshift32 (independent of rand(), like the scripted bots)
+unsigned int nextRandom(unsigned int& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Synthetic tree: heap-shaped (node i under (i - 1) / 2) plus a few extra
+// prerequisites from lower to higher indices, so it stays acyclic
+void buildSyntheticTree(AbilityTree& tree, int count, unsigned int seed) {
+    if (seed == 0) seed = 1;
+    std::vector<std::string> codes;
+    for (int i = 0; i < count; i++) {
+        codes.push_back("SYN_" + std::to_string(i));
+    }
+
+    tree.setRoot(Ability(codes[0], "Synthetic Root", "", Ability::Type::COMBAT, 0, 10));
+    for (int i = 1; i < count; i++) {
+        Ability::Type type = static_cast<Ability::Type>(nextRandom(seed) % 4);
+        int cost = 1 + static_cast<int>(nextRandom(seed) % 5);
+        int power = 5 + static_cast<int>(nextRandom(seed) % 36);
+        tree.insert(Ability(codes[i], "Synthetic " + std::to_string(i), "", type, cost, power),
+                    codes[(i - 1) / 2], (i % 2) == 1);
+    }
+
+    for (int extra = 0; extra < count / 4; extra++) {
+        int index = 2 + static_cast<int>(nextRandom(seed) % (count - 2));
+        int prereq = 1 + static_cast<int>(nextRandom(seed) % (index - 1));
+        tree.addPrerequisite(codes[index], codes[prereq]);
+    }
+}
+
+// Order the abilities of a build so each one's prerequisites come first
+// (cheapest available first, like a player would)
+std::string unlockOrder(const AbilityTree& tree, const std::string& key) {
+    AbilityProgress* state = tree.createProgress();
+    AbilityProgress target;
+    target = *state;
+    std::memcpy(target.unlockedBits, key.data(), key.size());
+
+    std::string order;
+    tree.addSkillPoints(*state, 1 << 30);
+    bool progressed = true;
+    while (progressed) {
+        progressed = false;
+        for (int i = 0; i < state->availableCount; i++) {
+            int index = state->eligible[i];
+            if (target.isUnlocked(index)) {
+                tree.unlock(*state, index);
+                if (!order.empty()) order += " > ";
+                order += tree.getNode(index)->ability.code;
+                progressed = true;
+                break;
+            }
+        }
+    }
+
+    delete state;
+    return order.empty() ? "(root only)" : order;
+}
+
+void report(const AbilityTree& tree, BuildSearch& search, int maxBudget) {
+    std::cout << "\n=== PARETO-BEST BUILDS ===" << std::endl;
+    std::cout << std::left << std::setw(8) << "Budget"
+              << std::setw(10) << "Score"
+              << "Unlock order" << std::endl;
+    std::cout << std::string(78, '-') << std::endl;
+
+    // A budget is listed only when it buys a strictly better build
+    long long previous = -1;
+    for (int budget = 0; budget <= maxBudget; budget++) {
+        long long score = search.frontier.scoreAt(budget);
+        if (score <= previous) continue;
+        previous = score;
+
+        std::cout << std::left << std::setw(8) << budget
+                  << std::setw(10) << score
+                  << unlockOrder(tree, search.frontier.buildAt(budget)) << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int maxBudget = -1;
+    int threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    int synthetic = 0;
+    unsigned int seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option.rfind("--budget=", 0) == 0) {
+            maxBudget = std::atoi(option.c_str() + 9);
+        } else if (option.rfind("--threads=", 0) == 0) {
+            threadCount = std::atoi(option.c_str() + 10);
+        } else if (option.rfind("--synthetic=", 0) == 0) {
+            synthetic = std::atoi(option.c_str() + 12);
+        } else if (option.rfind("--seed=", 0) == 0) {
+            seed = static_cast<unsigned int>(std::strtoul(option.c_str() + 7, nullptr, 10));
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--budget=N] [--threads=N] [--synthetic=N] [--seed=N]" << std::endl;
+            return 1;
+        }
+    }
+    if (threadCount < 1) threadCount = 1;
+
+    // Build the tree with its logging silenced
+    AbilityTree tree;
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    if (synthetic > 2) {
+        buildSyntheticTree(tree, synthetic, seed);
+    } else {
+        tree.initializeDefaultTree();
+    }
+    std::cout.rdbuf(original);
+
+    if (maxBudget < 0) {
+        maxBudget = 0;
+        for (int i = 0; i < tree.getTotalAbilities(); i++) {
+            maxBudget += tree.getNode(i)->ability.cost;
+        }
+    }
+
+    std::cout << "[Optimizer] " << tree.getTotalAbilities() << " abilities, budget 0-"
+              << maxBudget << ", " << threadCount << " thread(s)" << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    BuildSearch search(tree, maxBudget, threadCount);
+    search.run();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    report(tree, search, maxBudget);
+
+    std::cout << "\nBuilds expanded: " << search.stats.expanded.load()
+              << "  pruned: " << search.stats.pruned.load()
+              << "  memo hits: " << search.stats.memoHits.load()
+              << "  distinct: " << search.visitedCount()
+              << "  steals: " << search.stats.steals.load() << std::endl;
+    std::cout << "Search time: " << std::fixed << std::setprecision(3) << seconds << " s" << std::endl;
+    return 0;
+}